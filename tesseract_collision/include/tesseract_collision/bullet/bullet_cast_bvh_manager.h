@@ -91,6 +91,12 @@ public:
 
   bool disableCollisionObject(const std::string& name) override;
 
+  bool updateCollisionObjectGeometries(const std::string& name) override;
+
+  bool enableCollisionObjects(const std::vector<std::string>& names) override;
+
+  bool disableCollisionObjects(const std::vector<std::string>& names) override;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override;
 
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -145,15 +151,15 @@ private:
 
   std::unique_ptr<btCollisionDispatcher> dispatcher_; /**< @brief The bullet collision dispatcher used for getting
                                                          object to object collison algorithm */
-  btDispatcherInfo dispatch_info_;              /**< @brief The bullet collision dispatcher configuration information */
+  TesseractDispatcherInfo dispatch_info_;       /**< @brief The bullet collision dispatcher configuration information */
   TesseractCollisionConfiguration coll_config_; /**< @brief The bullet collision configuration */
   std::unique_ptr<btBroadphaseInterface> broadphase_; /**< @brief The bullet broadphase interface */
   Link2Cow link2cow_;                                 /**< @brief A map of collision objects being managed */
   Link2Cow link2castcow_;                             /**< @brief A map of cast collision objects being managed. */
 
   /**
-   * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
-   * so it can be used to exit collision checking for compound shapes.
+   * @brief This is used when contactTest is called. It is also passed to the collision algorithms through the
+   * dispatcher information so it can be used to exit collision checking for compound shapes.
    */
   ContactTestData contact_test_data_;
 
@@ -162,6 +168,14 @@ private:
 
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /**
+   * @brief Set the enabled state of several collision objects and clean their broadphase pairs in a single pass
+   * @param names The names of the collision objects
+   * @param enabled The enabled state
+   * @return True if all collision objects were found, otherwise false
+   */
+  bool setCollisionObjectsEnabled(const std::vector<std::string>& names, bool enabled);
 };
 }  // namespace tesseract_collision_bullet
 }  // namespace tesseract_collision
@@ -91,6 +91,8 @@ public:
 
   bool disableCollisionObject(const std::string& name) override;
 
+  bool updateCollisionObjectGeometries(const std::string& name) override;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override;
 
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -145,15 +147,15 @@ private:
 
   std::unique_ptr<btCollisionDispatcher> dispatcher_; /**< @brief The bullet collision dispatcher used for getting
                                                          object to object collison algorithm */
-  btDispatcherInfo dispatch_info_;              /**< @brief The bullet collision dispatcher configuration information */
+  TesseractDispatcherInfo dispatch_info_;       /**< @brief The bullet collision dispatcher configuration information */
   TesseractCollisionConfiguration coll_config_; /**< @brief The bullet collision configuration */
   Link2Cow link2cow_;                           /**< @brief A map of collision objects being managed */
   std::vector<COW::Ptr> cows_;                  /**< @brief A vector of collision objects (active followed by static) */
   Link2Cow link2castcow_;                       /**< @brief A map of cast collision objects being managed. */
 
   /**
-   * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
-   * so it can be used to exit collision checking for compound shapes.
+   * @brief This is used when contactTest is called. It is also passed to the collision algorithms through the
+   * dispatcher information so it can be used to exit collision checking for compound shapes.
    */
   ContactTestData contact_test_data_;
 
@@ -91,6 +91,12 @@ public:
 
   bool disableCollisionObject(const std::string& name) override;
 
+  bool updateCollisionObjectGeometries(const std::string& name) override;
+
+  bool enableCollisionObjects(const std::vector<std::string>& names) override;
+
+  bool disableCollisionObjects(const std::vector<std::string>& names) override;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override;
 
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -98,6 +104,13 @@ public:
 
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override;
 
+#ifndef SWIG
+  CollisionObjectsHandle createCollisionObjectsHandle(const std::vector<std::string>& names) override;
+
+  void setCollisionObjectsTransform(const CollisionObjectsHandle& handle,
+                                    const tesseract_common::VectorIsometry3d& poses) override;
+#endif  // SWIG
+
   const std::vector<std::string>& getCollisionObjects() const override;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override;
@@ -121,6 +134,87 @@ public:
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override;
 
 #ifndef SWIG
+  void contactTest(ContactResultIdMap& collisions, const ContactRequest& request) override;
+
+  void contactTest(ContactDistanceResultMap& collisions, const ContactRequest& request) override;
+#endif  // SWIG
+
+  void batchContactTest(std::vector<ContactResultMap>& collisions,
+                        const std::vector<tesseract_common::TransformMap>& states,
+                        const ContactRequest& request) override;
+
+  void batchContactTest(std::vector<ContactResultMap>& collisions,
+                        const std::vector<std::string>& names,
+                        const tesseract_common::VectorIsometry3d& poses,
+                        const ContactRequest& request) override;
+
+  /**
+   * @brief Set the number of threads used to process the overlapping pairs found by the broadphase
+   *
+   * By default the narrowphase is performed on the calling thread. If more than one thread is used the overlapping
+   * pairs are partitioned across the threads, each using its own dispatcher and results which are merged in the order
+   * of the pairs when finished, so the results are the same as when using a single thread. For ContactTestType::FIRST
+   * and LIMITED the remaining threads stop once the limit is reached.
+   *
+   * The IsContactAllowedFn and the is_valid function of the contact request are called from all threads, so they
+   * must be thread-safe.
+   *
+   * @param num_threads The number of threads, if less than one the OpenMP default number of threads is used.
+   */
+  void setNarrowphaseThreads(int num_threads);
+
+  /**
+   * @brief Get the number of threads used to process the overlapping pairs found by the broadphase
+   * @return The number of threads
+   */
+  int getNarrowphaseThreads() const;
+
+#ifndef SWIG
+  /**
+   * @brief Enable caching the narrowphase contacts of each pair of collision objects between contact tests
+   *
+   * When enabled the contacts of a pair are replayed instead of running the narrowphase if neither transform nor the
+   * contact distance changed since they were computed. The cache is cleared when collision objects are added or
+   * removed. This is disabled by default.
+   *
+   * @param enabled Indicate if the cache should be used
+   */
+  void setContactPairCacheEnabled(bool enabled);
+
+  /**
+   * @brief Enable skipping the narrowphase of pairs which can not be within the collision margin
+   *
+   * The narrowphase of a pair searches up to the search margin beyond the collision margin. The pair is skipped until
+   * the distance it was found at minus how far both objects moved since, bounded using their bounding radius, drops
+   * below the collision margin of the pair. This enables the contact pair cache, see ContactPairCache.
+   *
+   * @param enabled Indicate if the distance bound should be used
+   * @param search_margin The distance beyond the collision margin searched by the narrowphase
+   */
+  void setDistanceBoundEnabled(bool enabled, double search_margin = DEFAULT_DISTANCE_BOUND_SEARCH_MARGIN);
+
+  /**
+   * @brief Get the contact pair cache, which provides the hit and miss counters
+   * @return The contact pair cache, nullptr if it is disabled
+   */
+  ContactPairCache::ConstPtr getContactPairCache() const;
+
+  /**
+   * @brief Enable skipping the narrowphase of pairs whose sphere trees are further apart than the collision margin
+   *
+   * Each supported shape is approximated by a tree of spheres which contains it and extends at most the tolerance
+   * beyond it, see SphereTree. The sphere trees are checked before the narrowphase, so pairs which are close still
+   * produce the exact contacts. Pairs with a shape which is not supported, like planes and octrees, are never skipped.
+   * This is disabled by default.
+   *
+   * @param enabled Indicate if the sphere trees should be used
+   * @param tolerance The maximum distance the spheres extend beyond the shapes
+   */
+  void setSphereTreeEnabled(bool enabled, double tolerance = DEFAULT_SPHERE_TREE_TOLERANCE);
+
+  /** @brief Check if the narrowphase of pairs is skipped using their sphere trees */
+  bool isSphereTreeEnabled() const;
+
   /**
    * @brief A a bullet collision object to the manager
    * @param cow The tesseract bullet collision object
@@ -134,22 +228,74 @@ private:
 
   std::unique_ptr<btCollisionDispatcher> dispatcher_; /**< @brief The bullet collision dispatcher used for getting
                                                          object to object collison algorithm */
-  btDispatcherInfo dispatch_info_;              /**< @brief The bullet collision dispatcher configuration information */
+  TesseractDispatcherInfo dispatch_info_;       /**< @brief The bullet collision dispatcher configuration information */
   TesseractCollisionConfiguration coll_config_; /**< @brief The bullet collision configuration */
   std::unique_ptr<btBroadphaseInterface> broadphase_; /**< @brief The bullet broadphase interface */
   Link2Cow link2cow_; /**< @brief A map of all (static and active) collision objects being managed */
 
   /**
-   * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
-   * so it can be used to exit collision checking for compound shapes.
+   * @brief This is used when contactTest is called. It is also passed to the collision algorithms through the
+   * dispatcher information so it can be used to exit collision checking for compound shapes.
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The interned ids of the collision object names, used by the id keyed contact results */
+  ObjectIdRegistry::Ptr object_ids_{ std::make_shared<ObjectIdRegistry>() };
+
+  /** @brief The collision objects indexed by their interned id, nullptr if there is no collision object for the id */
+  std::vector<COW::Ptr> id2cow_;
+
+  /** @brief The cache of the narrowphase contacts of each pair, nullptr if disabled */
+  ContactPairCache::Ptr pair_cache_;
+
+  /** @brief The tolerance of the sphere trees of the collision objects, zero if disabled */
+  double sphere_tree_tolerance_{ 0 };
+
   /** @brief Filter collision objects before broadphase check */
   TesseractOverlapFilterCallback broadphase_overlap_cb_;
 
+  /** @brief The dispatcher and results used by a thread when processing the overlapping pairs in parallel */
+  struct NarrowphaseWorker
+  {
+    TesseractCollisionConfiguration coll_config;
+    std::unique_ptr<btCollisionDispatcher> dispatcher;
+    /** @brief The dispatcher information which passes the contact test data of the thread to the algorithms */
+    TesseractDispatcherInfo dispatch_info;
+    ContactTestData contact_test_data;
+    ContactResultMap results;
+    ContactResultIdMap results_ids;
+    ContactDistanceResultMap results_distance;
+    /** @brief The index of the overlapping pair which finished the search */
+    int done_pair_index{ -1 };
+  };
+
+  int narrowphase_threads_{ 1 }; /**< @brief The number of threads used to process the overlapping pairs */
+
+  /** @brief The workers used to process the overlapping pairs in parallel, empty if using a single thread */
+  std::vector<std::unique_ptr<NarrowphaseWorker>> narrowphase_workers_;
+
+  /** @brief The index of the worker which processed each overlapping pair, -1 if it was not processed */
+  std::vector<int> narrowphase_pair_workers_;
+
+  /** @brief Copy the configuration of the contact test data to the workers, called when it changes */
+  void updateNarrowphaseWorkers();
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /**
+   * @brief Set the enabled state of several collision objects and clean their broadphase pairs in a single pass
+   * @param names The names of the collision objects
+   * @param enabled The enabled state
+   * @return True if all collision objects were found, otherwise false
+   */
+  bool setCollisionObjectsEnabled(const std::vector<std::string>& names, bool enabled);
+
+  /**
+   * @brief Process the overlapping pairs in parallel and merge the results in to the results container of the contact
+   * test data
+   */
+  void processOverlappingPairsParallel();
 };
 
 }  // namespace tesseract_collision_bullet
@@ -91,6 +91,8 @@ public:
 
   bool disableCollisionObject(const std::string& name) override;
 
+  bool updateCollisionObjectGeometries(const std::string& name) override;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override;
 
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -98,6 +100,13 @@ public:
 
   void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override;
 
+#ifndef SWIG
+  CollisionObjectsHandle createCollisionObjectsHandle(const std::vector<std::string>& names) override;
+
+  void setCollisionObjectsTransform(const CollisionObjectsHandle& handle,
+                                    const tesseract_common::VectorIsometry3d& poses) override;
+#endif  // SWIG
+
   const std::vector<std::string>& getCollisionObjects() const override;
 
   void setActiveCollisionObjects(const std::vector<std::string>& names) override;
@@ -121,6 +130,57 @@ public:
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override;
 
 #ifndef SWIG
+  void contactTest(ContactResultIdMap& collisions, const ContactRequest& request) override;
+
+  void contactTest(ContactDistanceResultMap& collisions, const ContactRequest& request) override;
+#endif  // SWIG
+
+#ifndef SWIG
+  /**
+   * @brief Enable caching the narrowphase contacts of each pair of collision objects between contact tests
+   *
+   * When enabled the contacts of a pair are replayed instead of running the narrowphase if neither transform nor the
+   * contact distance changed since they were computed. The cache is cleared when collision objects are added or
+   * removed. This is disabled by default.
+   *
+   * @param enabled Indicate if the cache should be used
+   */
+  void setContactPairCacheEnabled(bool enabled);
+
+  /**
+   * @brief Enable skipping the narrowphase of pairs which can not be within the collision margin
+   *
+   * The narrowphase of a pair searches up to the search margin beyond the collision margin. The pair is skipped until
+   * the distance it was found at minus how far both objects moved since, bounded using their bounding radius, drops
+   * below the collision margin of the pair. This enables the contact pair cache, see ContactPairCache.
+   *
+   * @param enabled Indicate if the distance bound should be used
+   * @param search_margin The distance beyond the collision margin searched by the narrowphase
+   */
+  void setDistanceBoundEnabled(bool enabled, double search_margin = DEFAULT_DISTANCE_BOUND_SEARCH_MARGIN);
+
+  /**
+   * @brief Get the contact pair cache, which provides the hit and miss counters
+   * @return The contact pair cache, nullptr if it is disabled
+   */
+  ContactPairCache::ConstPtr getContactPairCache() const;
+
+  /**
+   * @brief Enable skipping the narrowphase of pairs whose sphere trees are further apart than the collision margin
+   *
+   * Each supported shape is approximated by a tree of spheres which contains it and extends at most the tolerance
+   * beyond it, see SphereTree. The sphere trees are checked before the narrowphase, so pairs which are close still
+   * produce the exact contacts. Pairs with a shape which is not supported, like planes and octrees, are never skipped.
+   * This is disabled by default.
+   *
+   * @param enabled Indicate if the sphere trees should be used
+   * @param tolerance The maximum distance the spheres extend beyond the shapes
+   */
+  void setSphereTreeEnabled(bool enabled, double tolerance = DEFAULT_SPHERE_TREE_TOLERANCE);
+
+  /** @brief Check if the narrowphase of pairs is skipped using their sphere trees */
+  bool isSphereTreeEnabled() const;
+
   /**
    * @brief A a bullet collision object to the manager
    * @param cow The tesseract bullet collision object
@@ -134,19 +194,34 @@ private:
 
   std::unique_ptr<btCollisionDispatcher> dispatcher_; /**< @brief The bullet collision dispatcher used for getting
                                                          object to object collison algorithm */
-  btDispatcherInfo dispatch_info_;              /**< @brief The bullet collision dispatcher configuration information */
+  TesseractDispatcherInfo dispatch_info_;       /**< @brief The bullet collision dispatcher configuration information */
   TesseractCollisionConfiguration coll_config_; /**< @brief The bullet collision configuration */
   Link2Cow link2cow_;          /**< @brief A map of all (static and active) collision objects being managed */
   std::vector<COW::Ptr> cows_; /**< @brief A vector of collision objects (active followed by static) */
 
   /**
-   * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
-   * so it can be used to exit collision checking for compound shapes.
+   * @brief This is used when contactTest is called. It is also passed to the collision algorithms through the
+   * dispatcher information so it can be used to exit collision checking for compound shapes.
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The interned ids of the collision object names, used by the id keyed contact results */
+  ObjectIdRegistry::Ptr object_ids_{ std::make_shared<ObjectIdRegistry>() };
+
+  /** @brief The collision objects indexed by their interned id, nullptr if there is no collision object for the id */
+  std::vector<COW::Ptr> id2cow_;
+
+  /** @brief The cache of the narrowphase contacts of each pair, nullptr if disabled */
+  ContactPairCache::Ptr pair_cache_;
+
+  /** @brief The tolerance of the sphere trees of the collision objects, zero if disabled */
+  double sphere_tree_tolerance_{ 0 };
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief Perform the contact test using the request and results container stored in the contact test data */
+  void runContactTest();
 };
 
 }  // namespace tesseract_collision_bullet
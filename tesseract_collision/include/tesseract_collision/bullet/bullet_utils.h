@@ -53,6 +53,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/types.h>
 #include <tesseract_collision/core/common.h>
+#include <tesseract_collision/core/contact_pair_cache.h>
+#include <tesseract_collision/core/shape_cache.h>
+#include <tesseract_collision/core/signed_distance_field.h>
+#include <tesseract_collision/core/sphere_tree.h>
 
 namespace tesseract_collision
 {
@@ -146,6 +150,12 @@ public:
   const std::string& getName() const { return m_name; }
   /** @brief Get a user defined type */
   const int& getTypeID() const { return m_type_id; }
+  /** @brief Get the interned id of the collision object name assigned by the contact manager, see ObjectIdRegistry */
+  int getObjectId() const { return m_object_id; }
+  /** @brief Set the interned id of the collision object name */
+  void setObjectId(int id) { m_object_id = id; }
+  /** @brief Get the radius of a sphere about the collision object origin which contains all of its shapes */
+  double getBoundingRadius() const { return m_bounding_radius; }
   /** \brief Check if two CollisionObjectWrapper objects point to the same source object */
   bool sameObject(const CollisionObjectWrapper& other) const
   {
@@ -162,6 +172,25 @@ public:
 
   const tesseract_common::VectorIsometry3d& getCollisionGeometriesTransforms() const { return m_shape_poses; }
 
+  /** @brief Get the sphere trees of the shapes, empty if sphere trees are not enabled */
+  const SphereTrees& getSphereTrees() const { return m_sphere_trees; }
+
+  /**
+   * @brief Set the tolerance of the sphere trees approximating the shapes
+   * @param tolerance The sphere tree tolerance, if not greater than zero the sphere trees are removed
+   */
+  void setSphereTreeTolerance(double tolerance);
+
+  /**
+   * @brief Update the bounds of the octree shapes to the current revision of the octree geometries
+   *
+   * The octree shapes are shared with the clones of the collision object, so they are only changed by the first clone
+   * updated. The contact manager must update the broadphase AABB of each clone afterwards.
+   *
+   * @return True if the collision object has octree shapes
+   */
+  bool updateOctreeShapes();
+
   /**
    * @brief Get the collision objects axis aligned bounding box
    * @param aabb_min The minimum point
@@ -185,8 +214,12 @@ public:
     auto clone_cow = std::make_shared<CollisionObjectWrapper>();
     clone_cow->m_name = m_name;
     clone_cow->m_type_id = m_type_id;
+    clone_cow->m_object_id = m_object_id;
+    clone_cow->m_bounding_radius = m_bounding_radius;
     clone_cow->m_shapes = m_shapes;
     clone_cow->m_shape_poses = m_shape_poses;
+    clone_cow->m_sphere_trees = m_sphere_trees;
+    clone_cow->m_sphere_tree_tolerance = m_sphere_tree_tolerance;
     clone_cow->m_data = m_data;
     clone_cow->setCollisionShape(getCollisionShape());
     clone_cow->setWorldTransform(getWorldTransform());
@@ -200,11 +233,21 @@ public:
   void manage(const std::shared_ptr<btCollisionShape>& t) { m_data.push_back(t); }
 
 protected:
+  /** @brief Update the bounding radius from the AABB of the collision shape */
+  void updateBoundingRadius();
+
   std::string m_name;                               /**< @brief The name of the collision object */
   int m_type_id;                                    /**< @brief A user defined type id */
+  int m_object_id{ -1 };                            /**< @brief The interned id of the name */
   CollisionShapesConst m_shapes;                    /**< @brief The shapes that define the collison object */
   tesseract_common::VectorIsometry3d m_shape_poses; /**< @brief The shpaes poses information */
 
+  /** @brief The radius of a sphere about the collision object origin which contains all of its shapes */
+  double m_bounding_radius{ std::numeric_limits<double>::max() };
+
+  SphereTrees m_sphere_trees;          /**< @brief The sphere trees of the shapes, shared between clones */
+  double m_sphere_tree_tolerance{ 0 }; /**< @brief The tolerance of the sphere trees */
+
   /** @brief This manages the collision shape pointer so they get destroyed */
   std::vector<std::shared_ptr<btCollisionShape>> m_data;
 };
@@ -213,6 +256,283 @@ using COW = CollisionObjectWrapper;
 using Link2Cow = std::map<std::string, COW::Ptr>;
 using Link2ConstCow = std::map<std::string, COW::ConstPtr>;
 
+/**
+ * @brief A static triangle mesh shape with a BVH built over the triangles of a tesseract mesh
+ *
+ * The vertex and triangle buffers of the tesseract mesh are referenced by Bullet instead of being copied in to one
+ * shape per triangle, so the mesh is kept alive for the lifetime of this shape.
+ */
+class TesseractBvhTriangleMeshShape : public btBvhTriangleMeshShape
+{
+public:
+  using Ptr = std::shared_ptr<TesseractBvhTriangleMeshShape>;
+
+  explicit TesseractBvhTriangleMeshShape(const tesseract_geometry::Mesh::ConstPtr& mesh)
+    : TesseractBvhTriangleMeshShape(mesh, createMeshInterface(*mesh))
+  {
+  }
+
+  ~TesseractBvhTriangleMeshShape() override = default;
+  TesseractBvhTriangleMeshShape(const TesseractBvhTriangleMeshShape&) = delete;
+  TesseractBvhTriangleMeshShape& operator=(const TesseractBvhTriangleMeshShape&) = delete;
+  TesseractBvhTriangleMeshShape(TesseractBvhTriangleMeshShape&&) = delete;
+  TesseractBvhTriangleMeshShape& operator=(TesseractBvhTriangleMeshShape&&) = delete;
+
+  /** @brief Get the tesseract mesh this shape was created from */
+  const tesseract_geometry::Mesh::ConstPtr& getMesh() const { return m_mesh; }
+
+private:
+  TesseractBvhTriangleMeshShape(tesseract_geometry::Mesh::ConstPtr mesh,
+                                std::unique_ptr<btTriangleIndexVertexArray> mesh_interface)
+    : btBvhTriangleMeshShape(mesh_interface.get(), true, true)
+    , m_mesh(std::move(mesh))
+    , m_mesh_interface(std::move(mesh_interface))
+  {
+  }
+
+  /**
+   * @brief Create the Bullet mesh interface referencing the vertices and triangles of the mesh
+   *
+   * The triangles are stored as the number of vertices followed by the vertex indices, so the index buffer starts at
+   * the second element and has a stride of four integers.
+   */
+  static std::unique_ptr<btTriangleIndexVertexArray> createMeshInterface(const tesseract_geometry::Mesh& mesh)
+  {
+    const tesseract_common::VectorVector3d& vertices = *(mesh.getVertices());
+    const Eigen::VectorXi& triangles = *(mesh.getTriangles());
+
+    btIndexedMesh indexed_mesh;
+    indexed_mesh.m_numTriangles = mesh.getTriangleCount();
+    indexed_mesh.m_triangleIndexBase = reinterpret_cast<const unsigned char*>(triangles.data() + 1);
+    indexed_mesh.m_triangleIndexStride = 4 * sizeof(int);
+    indexed_mesh.m_numVertices = mesh.getVerticeCount();
+    indexed_mesh.m_vertexBase = reinterpret_cast<const unsigned char*>(vertices.data());
+    indexed_mesh.m_vertexStride = sizeof(Eigen::Vector3d);
+    indexed_mesh.m_indexType = PHY_INTEGER;
+    indexed_mesh.m_vertexType = PHY_DOUBLE;
+
+    auto mesh_interface = std::make_unique<btTriangleIndexVertexArray>();
+    mesh_interface->addIndexedMesh(indexed_mesh, PHY_INTEGER);
+    return mesh_interface;
+  }
+
+  tesseract_geometry::Mesh::ConstPtr m_mesh;
+  std::unique_ptr<btTriangleIndexVertexArray> m_mesh_interface;
+};
+
+/**
+ * @brief A scaled instance of a triangle mesh shape which is shared by collision objects and contact managers
+ *
+ * The user index and margin are set on this shape, so the shared triangle mesh shape is never modified after it is
+ * created. The scaling is only different from one when the mesh is a scaled copy of the mesh the shared shape was
+ * created from.
+ */
+class TesseractScaledBvhTriangleMeshShape : public btScaledBvhTriangleMeshShape
+{
+public:
+  using Ptr = std::shared_ptr<TesseractScaledBvhTriangleMeshShape>;
+
+  TesseractScaledBvhTriangleMeshShape(TesseractBvhTriangleMeshShape::Ptr shape, const btVector3& scaling)
+    : btScaledBvhTriangleMeshShape(shape.get(), scaling), m_shape(std::move(shape))
+  {
+  }
+
+  ~TesseractScaledBvhTriangleMeshShape() override = default;
+  TesseractScaledBvhTriangleMeshShape(const TesseractScaledBvhTriangleMeshShape&) = delete;
+  TesseractScaledBvhTriangleMeshShape& operator=(const TesseractScaledBvhTriangleMeshShape&) = delete;
+  TesseractScaledBvhTriangleMeshShape(TesseractScaledBvhTriangleMeshShape&&) = delete;
+  TesseractScaledBvhTriangleMeshShape& operator=(TesseractScaledBvhTriangleMeshShape&&) = delete;
+
+  /** @brief Get the shared triangle mesh shape */
+  const TesseractBvhTriangleMeshShape::Ptr& getMeshShape() const { return m_shape; }
+
+private:
+  TesseractBvhTriangleMeshShape::Ptr m_shape;
+};
+
+/**
+ * @brief Get the process wide cache of triangle mesh shapes
+ *
+ * Meshes are looked up by the identity of their vertex and triangle buffers, so the same mesh added to several links,
+ * clones or contact managers shares one bounding volume hierarchy. Meshes loaded from the same resource with a
+ * different scale are also looked up by the resource url and share the shape through a scaled instance.
+ */
+ShapeCache<TesseractBvhTriangleMeshShape>& getMeshShapeCache();
+
+/**
+ * @brief A static triangle mesh shape which is checked against convex shapes using a signed distance field
+ *
+ * The signed distance field is computed when the shape is created and is shared by all shapes created from the same
+ * SDF mesh. Convex shapes are checked using lookups in the field instead of the triangles, see
+ * TesseractSDFConvexCollisionAlgorithm. Concave shapes are checked against the triangles of the mesh.
+ */
+class TesseractSDFMeshShape : public btConcaveShape
+{
+public:
+  using Ptr = std::shared_ptr<TesseractSDFMeshShape>;
+
+  TesseractSDFMeshShape(TesseractScaledBvhTriangleMeshShape::Ptr mesh_shape, SignedDistanceField::ConstPtr sdf)
+    : m_mesh_shape(std::move(mesh_shape)), m_sdf(std::move(sdf))
+  {
+    m_shapeType = CUSTOM_CONCAVE_SHAPE_TYPE;
+  }
+
+  ~TesseractSDFMeshShape() override = default;
+  TesseractSDFMeshShape(const TesseractSDFMeshShape&) = delete;
+  TesseractSDFMeshShape& operator=(const TesseractSDFMeshShape&) = delete;
+  TesseractSDFMeshShape(TesseractSDFMeshShape&&) = delete;
+  TesseractSDFMeshShape& operator=(TesseractSDFMeshShape&&) = delete;
+
+  /** @brief Get the signed distance field of the mesh */
+  const SignedDistanceField::ConstPtr& getSignedDistanceField() const { return m_sdf; }
+
+  void getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const override
+  {
+    m_mesh_shape->getAabb(t, aabbMin, aabbMax);
+  }
+
+  void processAllTriangles(btTriangleCallback* callback,
+                           const btVector3& aabbMin,
+                           const btVector3& aabbMax) const override
+  {
+    m_mesh_shape->processAllTriangles(callback, aabbMin, aabbMax);
+  }
+
+  void setMargin(btScalar margin) override
+  {
+    btConcaveShape::setMargin(margin);
+    m_mesh_shape->setMargin(margin);
+  }
+
+  void setLocalScaling(const btVector3& /*scaling*/) override {}
+  const btVector3& getLocalScaling() const override { return m_mesh_shape->getLocalScaling(); }
+  void calculateLocalInertia(btScalar /*mass*/, btVector3& inertia) const override { inertia.setValue(0, 0, 0); }
+  const char* getName() const override { return "TesseractSDFMesh"; }
+
+private:
+  TesseractScaledBvhTriangleMeshShape::Ptr m_mesh_shape;
+  SignedDistanceField::ConstPtr m_sdf;
+};
+
+/**
+ * @brief Get the process wide cache of signed distance fields
+ *
+ * SDF meshes are looked up by the identity of their vertex and triangle buffers, so the field of a mesh added to
+ * several links, clones or contact managers is only computed once.
+ */
+ShapeCache<const SignedDistanceField>& getSignedDistanceFieldCache();
+
+/** @brief The bullet proxy type of TesseractOctreeShape, which is not used by any bullet shape */
+const int TESSERACT_OCTREE_SHAPE_PROXYTYPE = FAST_CONCAVE_MESH_PROXYTYPE;
+
+/**
+ * @brief An octree shape which is checked by walking the octomap instead of creating a child shape per leaf
+ *
+ * Dense octomaps have millions of leafs, so no shapes are stored for them. The octree is walked from the root where
+ * nodes which do not overlap the other shape, or are not occupied, are skipped since the occupancy of an inner node is
+ * the maximum occupancy of its children. A box or sphere is only created for the occupied leafs near the other shape
+ * while it is checked, see TesseractOctreeCollisionAlgorithm.
+ *
+ * The cast shape of an octree sweeps each leaf from the origin of the shape to the cast transform, like CastHullShape.
+ */
+class TesseractOctreeShape : public btConcaveShape
+{
+public:
+  using Ptr = std::shared_ptr<TesseractOctreeShape>;
+
+  /** @brief The function called for each occupied leaf with the center and size of the leaf in the octree frame */
+  using LeafCallback = std::function<void(const btVector3& center, btScalar size)>;
+
+  /**
+   * @brief Create an octree shape
+   * @param geom The octree geometry
+   * @param cast If true the leafs are swept to the cast transform
+   */
+  explicit TesseractOctreeShape(tesseract_geometry::Octree::ConstPtr geom, bool cast = false);
+
+  ~TesseractOctreeShape() override = default;
+  TesseractOctreeShape(const TesseractOctreeShape&) = delete;
+  TesseractOctreeShape& operator=(const TesseractOctreeShape&) = delete;
+  TesseractOctreeShape(TesseractOctreeShape&&) = delete;
+  TesseractOctreeShape& operator=(TesseractOctreeShape&&) = delete;
+
+  /** @brief Get the octree geometry */
+  const tesseract_geometry::Octree::ConstPtr& getOctree() const { return m_geom; }
+
+  /** @brief Check if the leafs are swept to the cast transform */
+  bool isCast() const { return m_cast; }
+
+  /** @brief Get the transform of the end of the sweep relative to the shape, identity if not cast */
+  const btTransform& getCastTransform() const { return m_cast_transform; }
+
+  /** @brief Set the transform of the end of the sweep relative to the shape */
+  void updateCastTransform(const btTransform& cast_transform) { m_cast_transform = cast_transform; }
+
+  /**
+   * @brief Update the octomap and the bounds of the occupied leafs to the current revision of the octree geometry
+   *
+   * The bounds are only extended by the voxels changed since the last update, unless a leaf on the bounds was removed
+   * or the changes are no longer available, see tesseract_geometry::Octree::getChangedKeys.
+   *
+   * @return True if the octree geometry changed since the last update
+   */
+  bool update();
+
+  /**
+   * @brief Call a function for each occupied leaf of the octree which overlaps an axis aligned box
+   *
+   * For a cast shape the box is checked against the bounds of the nodes at both ends of the sweep.
+   *
+   * @param aabb_min The minimum point of the box in the octree frame
+   * @param aabb_max The maximum point of the box in the octree frame
+   * @param callback The function called for each leaf
+   */
+  void processOccupiedLeafs(const btVector3& aabb_min, const btVector3& aabb_max, const LeafCallback& callback) const;
+
+  void getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const override;
+
+  /** @brief Process the triangles of the boxes of the occupied leafs, spheres are approximated by their box */
+  void processAllTriangles(btTriangleCallback* callback,
+                           const btVector3& aabbMin,
+                           const btVector3& aabbMax) const override;
+
+  void setLocalScaling(const btVector3& /*scaling*/) override {}
+  const btVector3& getLocalScaling() const override
+  {
+    static btVector3 out(1, 1, 1);
+    return out;
+  }
+  void calculateLocalInertia(btScalar /*mass*/, btVector3& inertia) const override { inertia.setValue(0, 0, 0); }
+  const char* getName() const override { return "TesseractOctree"; }
+
+private:
+  tesseract_geometry::Octree::ConstPtr m_geom;
+  std::shared_ptr<const octomap::OcTree> m_octree; /**< @brief The octomap of the last revision updated */
+  bool m_cast;
+  btTransform m_cast_transform;
+  std::size_t m_revision;
+  btVector3 m_local_aabb_min; /**< @brief The minimum point of the occupied leafs */
+  btVector3 m_local_aabb_max; /**< @brief The maximum point of the occupied leafs */
+
+  /** @brief Compute the bounds of the occupied leafs */
+  void updateLocalAabb();
+
+  /**
+   * @brief Extend the bounds of the occupied leafs by the changed voxels
+   * @param previous The octomap of the previous revision
+   * @param changed_keys The keys of the voxels changed since the previous revision
+   * @return False if the bounds may shrink, then they must be computed again
+   */
+  bool updateLocalAabb(const octomap::OcTree& previous, const octomap::KeySet& changed_keys);
+
+  /** @brief Get the bounds of the shape of the leaf at a depth containing the voxel of a key */
+  void getLeafAabb(const octomap::OcTree& octree,
+                   const octomap::OcTreeKey& key,
+                   unsigned depth,
+                   btVector3& aabb_min,
+                   btVector3& aabb_max) const;
+};
+
 /** @brief This is a casted collision shape used for checking if an object is collision free between two transforms */
 struct CastHullShape : public btConvexShape
 {
@@ -370,6 +690,23 @@ inline btTransform getLinkTransformFromCOW(const btCollisionObjectWrapper* cow)
   return cow->getWorldTransform();
 }
 
+/**
+ * @brief Get the index of the shape within the link that the collision object wrapper belongs to
+ *
+ * The triangles of concave shapes are temporary shapes created during the narrowphase which do not have the shape
+ * index, so it is taken from the concave shape they belong to.
+ *
+ * @param cow The bullet collision object wrapper
+ * @return The shape index
+ */
+inline int getShapeIndex(const btCollisionObjectWrapper* cow)
+{
+  if (cow->getCollisionShape()->getUserIndex() < 0 && cow->m_parent != nullptr)
+    return cow->m_parent->getCollisionShape()->getUserIndex();
+
+  return cow->getCollisionShape()->getUserIndex();
+}
+
 /**
  * @brief This is used to check if a collision check is required between the provided two collision objects
  * @param cow1 The first collision object
@@ -395,19 +732,27 @@ inline btScalar addDiscreteSingleResult(btManifoldPoint& cp,
   const auto* cd0 = static_cast<const CollisionObjectWrapper*>(colObj0Wrap->getCollisionObject());
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(colObj1Wrap->getCollisionObject());
 
-  ObjectPairKey pc = getObjectPairKey(cd0->getName(), cd1->getName());
-
-  const auto& it = collisions.res->find(pc);
-  bool found = (it != collisions.res->end());
-
-  //    size_t l = 0;
-  //    if (found)
-  //    {
-  //      l = it->second.size();
-  //      if (m_collisions.req->type == DistanceRequestType::LIMITED && l >= m_collisions.req->max_contacts_per_body)
-  //          return 0;
+  // The distance only query does not need the transforms and local points, unless the user validation function or the
+  // contact pair cache requires the full contact result
+  if (collisions.res_distance != nullptr && !collisions.req.is_valid && collisions.pair_cache_entry == nullptr)
+  {
+    ContactDistanceResult contact{};
+    contact.distance = static_cast<double>(cp.m_distance1);
+    contact.link_ids[0] = cd0->getObjectId();
+    contact.link_ids[1] = cd1->getObjectId();
+    if (collisions.req.calculate_nearest_points)
+    {
+      const btVector3 normal = -1 * cp.m_normalWorldOnB;
+      for (int i = 0; i < 3; ++i)
+      {
+        contact.nearest_points[0][static_cast<std::size_t>(i)] = static_cast<double>(cp.m_positionWorldOnA[i]);
+        contact.nearest_points[1][static_cast<std::size_t>(i)] = static_cast<double>(cp.m_positionWorldOnB[i]);
+        contact.normal[static_cast<std::size_t>(i)] = static_cast<double>(normal[i]);
+      }
+    }
 
-  //    }
+    return processDistanceResult(collisions, contact, cd0->getName(), cd1->getName()) ? 1 : 0;
+  }
 
   btTransform tf0 = getLinkTransformFromCOW(colObj0Wrap);
   btTransform tf1 = getLinkTransformFromCOW(colObj1Wrap);
@@ -415,10 +760,10 @@ inline btScalar addDiscreteSingleResult(btManifoldPoint& cp,
   btTransform tf1_inv = tf1.inverse();
 
   ContactResult contact;
-  contact.link_names[0] = cd0->getName();
-  contact.link_names[1] = cd1->getName();
-  contact.shape_id[0] = colObj0Wrap->getCollisionShape()->getUserIndex();
-  contact.shape_id[1] = colObj1Wrap->getCollisionShape()->getUserIndex();
+  contact.link_ids[0] = cd0->getObjectId();
+  contact.link_ids[1] = cd1->getObjectId();
+  contact.shape_id[0] = getShapeIndex(colObj0Wrap);
+  contact.shape_id[1] = getShapeIndex(colObj1Wrap);
   contact.subshape_id[0] = colObj0Wrap->m_index;
   contact.subshape_id[1] = colObj1Wrap->m_index;
   contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
@@ -432,6 +777,58 @@ inline btScalar addDiscreteSingleResult(btManifoldPoint& cp,
   contact.distance = static_cast<double>(cp.m_distance1);
   contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
 
+  if (collisions.pair_cache_entry != nullptr)
+  {
+    contact.link_names[0] = cd0->getName();
+    contact.link_names[1] = cd1->getName();
+    collisions.pair_cache_entry->contacts.push_back(contact);
+  }
+
+  if (collisions.res_distance != nullptr)
+  {
+    contact.link_names[0] = cd0->getName();
+    contact.link_names[1] = cd1->getName();
+    if (collisions.req.is_valid && !collisions.req.is_valid(contact))
+      return 0;
+
+    ContactDistanceResult result = toContactDistanceResult(contact, collisions.req.calculate_nearest_points);
+    return processDistanceResult(collisions, result, cd0->getName(), cd1->getName()) ? 1 : 0;
+  }
+
+  if (collisions.res_ids != nullptr)
+  {
+    // The link names are resolved on demand from the ids, unless the user validation function needs them
+    if (collisions.req.is_valid)
+    {
+      contact.link_names[0] = cd0->getName();
+      contact.link_names[1] = cd1->getName();
+    }
+
+    ObjectPairId pc = getObjectPairId(cd0->getObjectId(), cd1->getObjectId());
+    bool found = (collisions.res_ids->find(pc) != collisions.res_ids->end());
+    if (!processResult(collisions, contact, pc, cd0->getName(), cd1->getName(), found))
+      return 0;
+
+    return 1;
+  }
+
+  ObjectPairKey pc = getObjectPairKey(cd0->getName(), cd1->getName());
+
+  const auto& it = collisions.res->find(pc);
+  bool found = (it != collisions.res->end());
+
+  //    size_t l = 0;
+  //    if (found)
+  //    {
+  //      l = it->second.size();
+  //      if (m_collisions.req->type == DistanceRequestType::LIMITED && l >= m_collisions.req->max_contacts_per_body)
+  //          return 0;
+
+  //    }
+
+  contact.link_names[0] = cd0->getName();
+  contact.link_names[1] = cd1->getName();
+
   if (!processResult(collisions, contact, pc, found))
   {
     return 0;
@@ -559,8 +956,10 @@ inline btScalar addCastSingleResult(btManifoldPoint& cp,
   ContactResult contact;
   contact.link_names[0] = cd0->getName();
   contact.link_names[1] = cd1->getName();
-  contact.shape_id[0] = colObj0Wrap->getCollisionShape()->getUserIndex();
-  contact.shape_id[1] = colObj1Wrap->getCollisionShape()->getUserIndex();
+  contact.link_ids[0] = cd0->getObjectId();
+  contact.link_ids[1] = cd1->getObjectId();
+  contact.shape_id[0] = getShapeIndex(colObj0Wrap);
+  contact.shape_id[1] = getShapeIndex(colObj1Wrap);
   contact.subshape_id[0] = colObj0Wrap->m_index;
   contact.subshape_id[1] = colObj1Wrap->m_index;
   contact.nearest_points[0] = convertBtToEigen(cp.m_positionWorldOnA);
@@ -598,6 +997,7 @@ inline btScalar addCastSingleResult(btManifoldPoint& cp,
       std::swap(col->nearest_points_local[0], col->nearest_points_local[1]);
       std::swap(col->transform[0], col->transform[1]);
       std::swap(col->link_names[0], col->link_names[1]);
+      std::swap(col->link_ids[0], col->link_ids[1]);
       std::swap(col->type_id[0], col->type_id[1]);
       std::swap(col->shape_id[0], col->shape_id[1]);
       std::swap(col->subshape_id[0], col->subshape_id[1]);
@@ -610,6 +1010,30 @@ inline btScalar addCastSingleResult(btManifoldPoint& cp,
   return 1;
 }
 
+/**
+ * @brief The dispatcher information passed to the tesseract collision algorithms
+ *
+ * The collision algorithms check if the contact test is finished using this contact test data, since the threads of
+ * the parallel narrowphase each store their contacts in their own contact test data. Every call to processCollision by
+ * the contact managers must pass this type, the algorithms cast the dispatcher information to it.
+ */
+struct TesseractDispatcherInfo : public btDispatcherInfo
+{
+  /** @brief The contact test data the contacts of the processed pair are stored in */
+  const ContactTestData* contact_test_data{ nullptr };
+};
+
+/**
+ * @brief Check if the contact test the collision algorithm is processing has finished
+ * @param dispatch_info The dispatcher information passed to the collision algorithm, see TesseractDispatcherInfo
+ */
+inline bool isContactTestDone(const btDispatcherInfo& dispatch_info)
+{
+  const ContactTestData* cdata = static_cast<const TesseractDispatcherInfo&>(dispatch_info).contact_test_data;
+  assert(cdata != nullptr);
+  return cdata->done;
+}
+
 /** @brief This is copied directly out of BulletWorld */
 struct TesseractBridgedManifoldResult : public btManifoldResult
 {
@@ -756,7 +1180,11 @@ struct TesseractBroadphaseBridgedManifoldResult : public btManifoldResult
 
   void addContactPoint(const btVector3& normalOnBInWorld, const btVector3& pointInWorld, btScalar depth) override
   {
-    if (result_callback_.collisions_.done || depth > static_cast<btScalar>(result_callback_.contact_distance_))
+    if (result_callback_.collisions_.done)
+      return;
+
+    updateContactPairCacheDistance(result_callback_.collisions_, static_cast<double>(depth));
+    if (depth > static_cast<btScalar>(result_callback_.contact_distance_))
       return;
 
     bool isSwapped = m_manifoldPtr->getBody0() != m_body0Wrap->getCollisionObject();
@@ -810,12 +1238,12 @@ struct TesseractBroadphaseBridgedManifoldResult : public btManifoldResult
  */
 class TesseractCollisionPairCallback : public btOverlapCallback
 {
-  const btDispatcherInfo& dispatch_info_;
+  const TesseractDispatcherInfo& dispatch_info_;
   btCollisionDispatcher* dispatcher_;
   BroadphaseContactResultCallback& results_callback_;
 
 public:
-  TesseractCollisionPairCallback(const btDispatcherInfo& dispatchInfo,
+  TesseractCollisionPairCallback(const TesseractDispatcherInfo& dispatchInfo,
                                  btCollisionDispatcher* dispatcher,
                                  BroadphaseContactResultCallback& results_callback)
     : dispatch_info_(dispatchInfo), dispatcher_(dispatcher), results_callback_(results_callback)
@@ -838,6 +1266,31 @@ public:
 
     if (results_callback_.needsCollision(cow0, cow1))
     {
+      ContactPairCacheScope cache_scope(results_callback_.collisions_);
+      if (cache_scope.isEnabled() && cache_scope.lookup(*cow0,
+                                                        -1,
+                                                        convertBtToEigen(cow0->getWorldTransform()),
+                                                        *cow1,
+                                                        -1,
+                                                        convertBtToEigen(cow1->getWorldTransform()),
+                                                        results_callback_.contact_distance_))
+        return false;
+
+      double sphere_tree_distance{ 0 };
+      if (isSphereTreeSeparated(results_callback_.collisions_,
+                                *cow0,
+                                -1,
+                                convertBtToEigen(cow0->getWorldTransform()),
+                                *cow1,
+                                -1,
+                                convertBtToEigen(cow1->getWorldTransform()),
+                                results_callback_.contact_distance_,
+                                sphere_tree_distance))
+      {
+        cache_scope.setDistance(sphere_tree_distance);
+        return false;
+      }
+
       btCollisionObjectWrapper obj0Wrap(nullptr, cow0->getCollisionShape(), cow0, cow0->getWorldTransform(), -1, -1);
       btCollisionObjectWrapper obj1Wrap(nullptr, cow1->getCollisionShape(), cow1, cow1->getWorldTransform(), -1, -1);
 
@@ -850,7 +1303,8 @@ public:
       if (pair.m_algorithm)
       {
         TesseractBroadphaseBridgedManifoldResult contactPointResult(&obj0Wrap, &obj1Wrap, results_callback_);
-        contactPointResult.m_closestPointDistanceThreshold = static_cast<btScalar>(results_callback_.contact_distance_);
+        contactPointResult.m_closestPointDistanceThreshold =
+            static_cast<btScalar>(cache_scope.searchDistance(results_callback_.contact_distance_));
 
         // discrete collision detection query
         pair.m_algorithm->processCollision(&obj0Wrap, &obj1Wrap, dispatch_info_, &contactPointResult);
@@ -892,28 +1346,49 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
                                                        CollisionObjectWrapper* cow,
                                                        int shape_index);
 
+/**
+ * @brief Create a compound shape with a convex child shape for each triangle of a triangle mesh shape
+ *
+ * This is used by the continuous contact managers, because only convex shapes can be casted. The child shapes are
+ * managed by the provided collision object wrapper.
+ *
+ * @param shape The scaled triangle mesh shape
+ * @param cow The collision object wrapper the triangle mesh shape is associated with
+ * @return The compound shape, where the child index is the triangle index
+ */
+std::shared_ptr<btCompoundShape> createTriangleCompoundShape(const TesseractScaledBvhTriangleMeshShape& shape,
+                                                             CollisionObjectWrapper& cow);
+
 /**
  * @brief Update a collision objects filters
- * @param active A list of active collision objects
+ * @param is_active Indicate if the collision object is active
  * @param cow The collision object to update.
+ * @return True if the filters of the collision object changed, otherwise false
  */
-inline void updateCollisionObjectFilters(const std::vector<std::string>& active, const COW::Ptr& cow)
+inline bool updateCollisionObjectFilters(bool is_active, const COW::Ptr& cow)
 {
-  cow->m_collisionFilterGroup = btBroadphaseProxy::KinematicFilter;
-
-  if (!isLinkActive(active, cow->getName()))
+  short int group = btBroadphaseProxy::KinematicFilter;
+  short int mask = btBroadphaseProxy::StaticFilter | btBroadphaseProxy::KinematicFilter;
+  if (!is_active)
   {
-    cow->m_collisionFilterGroup = btBroadphaseProxy::StaticFilter;
+    group = btBroadphaseProxy::StaticFilter;
+    mask = btBroadphaseProxy::KinematicFilter;
   }
 
-  if (cow->m_collisionFilterGroup == btBroadphaseProxy::StaticFilter)
-  {
-    cow->m_collisionFilterMask = btBroadphaseProxy::KinematicFilter;
-  }
-  else
-  {
-    cow->m_collisionFilterMask = btBroadphaseProxy::StaticFilter | btBroadphaseProxy::KinematicFilter;
-  }
+  bool changed = (cow->m_collisionFilterGroup != group || cow->m_collisionFilterMask != mask);
+  cow->m_collisionFilterGroup = group;
+  cow->m_collisionFilterMask = mask;
+  return changed;
+}
+
+/**
+ * @brief Update a collision objects filters
+ * @param active A list of active collision objects
+ * @param cow The collision object to update.
+ */
+inline void updateCollisionObjectFilters(const std::vector<std::string>& active, const COW::Ptr& cow)
+{
+  updateCollisionObjectFilters(isLinkActive(active, cow->getName()), cow);
 }
 
 inline COW::Ptr createCollisionObject(const std::string& name,
@@ -961,6 +1436,7 @@ struct DiscreteCollisionCollector : public btCollisionWorld::ContactResultCallba
                            int /*partId1*/,
                            int /*index1*/) override
   {
+    updateContactPairCacheDistance(collisions_, static_cast<double>(cp.m_distance1));
     if (cp.m_distance1 > static_cast<btScalar>(contact_distance_))
       return 0;
 
@@ -1012,6 +1488,15 @@ struct CastCollisionCollector : public btCollisionWorld::ContactResultCallback
   }
 };
 
+/** @brief Create the cast shape of an octree shape, which sweeps the leafs to the cast transform */
+inline TesseractOctreeShape::Ptr makeCastOctreeShape(const TesseractOctreeShape& octree)
+{
+  auto shape = std::make_shared<TesseractOctreeShape>(octree.getOctree(), true);
+  shape->setUserIndex(octree.getUserIndex());
+  shape->setMargin(BULLET_MARGIN);
+  return shape;
+}
+
 inline COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
 {
   COW::Ptr new_cow = cow->clone();
@@ -1019,6 +1504,16 @@ inline COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
   btTransform tf;
   tf.setIdentity();
 
+  // Only convex shapes can be casted so the triangles of a mesh are casted individually
+  if (new_cow->getCollisionShape()->getShapeType() == SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE)
+  {
+    assert(dynamic_cast<TesseractScaledBvhTriangleMeshShape*>(new_cow->getCollisionShape()) != nullptr);
+    auto compound = createTriangleCompoundShape(
+        *static_cast<TesseractScaledBvhTriangleMeshShape*>(new_cow->getCollisionShape()), *new_cow);
+    new_cow->manage(compound);
+    new_cow->setCollisionShape(compound.get());
+  }
+
   if (btBroadphaseProxy::isConvex(new_cow->getCollisionShape()->getShapeType()))
   {
     assert(dynamic_cast<btConvexShape*>(new_cow->getCollisionShape()) != nullptr);
@@ -1032,6 +1527,12 @@ inline COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
     new_cow->manage(shape);
     new_cow->setCollisionShape(shape.get());
   }
+  else if (new_cow->getCollisionShape()->getShapeType() == TESSERACT_OCTREE_SHAPE_PROXYTYPE)
+  {
+    auto shape = makeCastOctreeShape(*static_cast<TesseractOctreeShape*>(new_cow->getCollisionShape()));
+    new_cow->manage(shape);
+    new_cow->setCollisionShape(shape.get());
+  }
   else if (btBroadphaseProxy::isCompound(new_cow->getCollisionShape()->getShapeType()))
   {
     assert(dynamic_cast<btCompoundShape*>(new_cow->getCollisionShape()) != nullptr);
@@ -1041,9 +1542,19 @@ inline COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
 
     for (int i = 0; i < compound->getNumChildShapes(); ++i)
     {
-      if (btBroadphaseProxy::isConvex(compound->getChildShape(i)->getShapeType()))
+      btCollisionShape* child_shape = compound->getChildShape(i);
+      if (child_shape->getShapeType() == SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE)
+      {
+        assert(dynamic_cast<TesseractScaledBvhTriangleMeshShape*>(child_shape) != nullptr);
+        auto triangle_compound =
+            createTriangleCompoundShape(*static_cast<TesseractScaledBvhTriangleMeshShape*>(child_shape), *new_cow);
+        new_cow->manage(triangle_compound);
+        child_shape = triangle_compound.get();
+      }
+
+      if (btBroadphaseProxy::isConvex(child_shape->getShapeType()))
       {
-        auto* convex = static_cast<btConvexShape*>(compound->getChildShape(i));
+        auto* convex = static_cast<btConvexShape*>(child_shape);
         assert(convex->getShapeType() != CUSTOM_CONVEX_SHAPE_TYPE);  // This checks if already a cast collision object
 
         btTransform geomTrans = compound->getChildTransform(i);
@@ -1055,9 +1566,15 @@ inline COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
         subshape->setMargin(BULLET_MARGIN);
         new_compound->addChildShape(geomTrans, subshape.get());
       }
-      else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
+      else if (child_shape->getShapeType() == TESSERACT_OCTREE_SHAPE_PROXYTYPE)
+      {
+        auto subshape = makeCastOctreeShape(*static_cast<TesseractOctreeShape*>(child_shape));
+        new_cow->manage(subshape);
+        new_compound->addChildShape(compound->getChildTransform(i), subshape.get());
+      }
+      else if (btBroadphaseProxy::isCompound(child_shape->getShapeType()))
       {
-        auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));
+        auto* second_compound = static_cast<btCompoundShape*>(child_shape);
         auto new_second_compound =
             std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, second_compound->getNumChildShapes());
         for (int j = 0; j < second_compound->getNumChildShapes(); ++j)
@@ -1188,6 +1705,65 @@ inline void updateCollisionObjectFilters(const std::vector<std::string>& active,
   broadphase->getOverlappingPairCache()->cleanProxyFromPairs(cow->getBroadphaseHandle(), dispatcher.get());
 }
 
+/**
+ * @brief Clean the broadphase pairs of several collision objects so the BroadPhaseFilter gets called again
+ * @details This is the same as calling cleanProxyFromPairs for each collision object but only visits the overlapping
+ * pairs once.
+ * @param cows The collision objects to clean, objects without a broadphase handle are ignored
+ * @param broadphase The broadphase to update.
+ * @param dispatcher The dispatcher.
+ */
+inline void cleanCollisionObjectsFromPairs(const std::vector<COW::Ptr>& cows,
+                                           const std::unique_ptr<btBroadphaseInterface>& broadphase,
+                                           const std::unique_ptr<btCollisionDispatcher>& dispatcher)
+{
+  std::vector<const btBroadphaseProxy*> proxies;
+  proxies.reserve(cows.size());
+  for (const auto& cow : cows)
+  {
+    if (cow->getBroadphaseHandle())
+      proxies.push_back(cow->getBroadphaseHandle());
+  }
+
+  if (proxies.empty())
+    return;
+
+  btOverlappingPairCache* pair_cache = broadphase->getOverlappingPairCache();
+  if (proxies.size() == 1)
+  {
+    pair_cache->cleanProxyFromPairs(const_cast<btBroadphaseProxy*>(proxies[0]), dispatcher.get());
+    return;
+  }
+
+  std::sort(proxies.begin(), proxies.end());
+
+  struct CleanPairsCallback : public btOverlapCallback
+  {
+    CleanPairsCallback(const std::vector<const btBroadphaseProxy*>& proxies,
+                       btOverlappingPairCache* pair_cache,
+                       btDispatcher* dispatcher)
+      : proxies_(proxies), pair_cache_(pair_cache), dispatcher_(dispatcher)
+    {
+    }
+
+    bool processOverlap(btBroadphasePair& pair) override
+    {
+      if (std::binary_search(proxies_.begin(), proxies_.end(), pair.m_pProxy0) ||
+          std::binary_search(proxies_.begin(), proxies_.end(), pair.m_pProxy1))
+        pair_cache_->cleanOverlappingPair(pair, dispatcher_);
+
+      return false;
+    }
+
+    const std::vector<const btBroadphaseProxy*>& proxies_;
+    btOverlappingPairCache* pair_cache_;
+    btDispatcher* dispatcher_;
+  };
+
+  CleanPairsCallback callback(proxies, pair_cache, dispatcher.get());
+  pair_cache->processAllOverlappingPairs(&callback, dispatcher.get());
+}
+
 /**
  * @brief Refresh the broadphase data structure
  * @details When change certain properties of a collision object the broadphase is not aware so this function can be
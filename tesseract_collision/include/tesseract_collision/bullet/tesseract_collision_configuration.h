@@ -57,12 +57,32 @@ namespace tesseract_collision_bullet
  *     - Compound to Collision
  *     - Compound to Compound
  *     - Convex to Convex
+ *
+ * It also adds an algorithm for Concave to Concave which is not supported by Bullet, an algorithm for Signed
+ * Distance Field Mesh to Convex which looks up the distance in the field instead of processing the triangles, and an
+ * algorithm for Octree to any shape other than a compound which walks the octree for the leafs near the other shape.
  */
 class TesseractCollisionConfiguration : public btDefaultCollisionConfiguration
 {
 public:
   TesseractCollisionConfiguration(
       const btDefaultCollisionConstructionInfo& constructionInfo = btDefaultCollisionConstructionInfo());
+  ~TesseractCollisionConfiguration() override;
+  TesseractCollisionConfiguration(const TesseractCollisionConfiguration&) = delete;
+  TesseractCollisionConfiguration& operator=(const TesseractCollisionConfiguration&) = delete;
+  TesseractCollisionConfiguration(TesseractCollisionConfiguration&&) = delete;
+  TesseractCollisionConfiguration& operator=(TesseractCollisionConfiguration&&) = delete;
+
+  btCollisionAlgorithmCreateFunc* getCollisionAlgorithmCreateFunc(int proxyType0, int proxyType1) override;
+
+  btCollisionAlgorithmCreateFunc* getClosestPointsAlgorithmCreateFunc(int proxyType0, int proxyType1) override;
+
+protected:
+  btCollisionAlgorithmCreateFunc* m_concaveConcaveCreateFunc;
+  btCollisionAlgorithmCreateFunc* m_sdfConvexCreateFunc;
+  btCollisionAlgorithmCreateFunc* m_sdfConvexSwappedCreateFunc;
+  btCollisionAlgorithmCreateFunc* m_octreeCreateFunc;
+  btCollisionAlgorithmCreateFunc* m_octreeSwappedCreateFunc;
 };
 }  // namespace tesseract_collision_bullet
 }  // namespace tesseract_collision
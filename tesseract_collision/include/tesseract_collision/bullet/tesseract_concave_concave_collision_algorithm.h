@@ -0,0 +1,94 @@
+/**
+ * @file tesseract_concave_concave_collision_algorithm.h
+ * @brief Collision algorithm for two concave triangle mesh shapes
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_CONCAVE_CONCAVE_COLLISION_ALGORITHM_H
+#define TESSERACT_COLLISION_TESSERACT_CONCAVE_CONCAVE_COLLISION_ALGORITHM_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/BroadphaseCollision/btDispatcher.h>
+#include <BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.h>
+#include <BulletCollision/CollisionDispatch/btCollisionCreateFunc.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision
+{
+namespace tesseract_collision_bullet
+{
+/**
+ * @brief Supports collision between two concave shapes, like two btBvhTriangleMeshShape
+ *
+ * Bullet does not provide an algorithm for this case. The triangles of the first shape which overlap the bounding box
+ * of the second shape are found using the BVH of the first shape, and each triangle is then checked against the second
+ * shape using the convex to concave algorithm provided by the dispatcher.
+ */
+class TesseractConcaveConcaveCollisionAlgorithm : public btActivatingCollisionAlgorithm  // NOLINT
+{
+public:
+  TesseractConcaveConcaveCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                            const btCollisionObjectWrapper* body0Wrap,
+                                            const btCollisionObjectWrapper* body1Wrap);
+
+  void processCollision(const btCollisionObjectWrapper* body0Wrap,
+                        const btCollisionObjectWrapper* body1Wrap,
+                        const btDispatcherInfo& dispatchInfo,
+                        btManifoldResult* resultOut) override;
+
+  btScalar calculateTimeOfImpact(btCollisionObject* body0,
+                                 btCollisionObject* body1,
+                                 const btDispatcherInfo& dispatchInfo,
+                                 btManifoldResult* resultOut) override;
+
+  void getAllContactManifolds(btManifoldArray& /*manifoldArray*/) override {}
+
+  struct CreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractConcaveConcaveCollisionAlgorithm));
+      return new (mem) TesseractConcaveConcaveCollisionAlgorithm(ci, body0Wrap, body1Wrap);
+    }
+  };
+};
+}  // namespace tesseract_collision_bullet
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_TESSERACT_CONCAVE_CONCAVE_COLLISION_ALGORITHM_H
@@ -0,0 +1,120 @@
+/**
+ * @file tesseract_octree_collision_algorithm.h
+ * @brief Collision algorithm for an octree shape and another shape
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
+#define TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/BroadphaseCollision/btDispatcher.h>
+#include <BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.h>
+#include <BulletCollision/CollisionDispatch/btCollisionCreateFunc.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision
+{
+namespace tesseract_collision_bullet
+{
+/**
+ * @brief Supports collision between a TesseractOctreeShape and any other shape which is not a compound
+ *
+ * The octree is walked for the occupied leafs which overlap the other shape. A box or sphere is created on the stack
+ * for each of them and checked using the algorithm found by the dispatcher, so the collision algorithms of the leafs
+ * are not cached. Compound shapes are handled by the compound algorithm which calls this for each child shape.
+ *
+ * Since the leafs are not stored as child shapes they have no index, so the subshape id of the contacts is the index
+ * of the octree shape, not the index of the leaf.
+ */
+class TesseractOctreeCollisionAlgorithm : public btActivatingCollisionAlgorithm  // NOLINT
+{
+public:
+  TesseractOctreeCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                    const btCollisionObjectWrapper* body0Wrap,
+                                    const btCollisionObjectWrapper* body1Wrap,
+                                    bool isSwapped);
+  ~TesseractOctreeCollisionAlgorithm() override = default;
+  TesseractOctreeCollisionAlgorithm(const TesseractOctreeCollisionAlgorithm&) = delete;
+  TesseractOctreeCollisionAlgorithm& operator=(const TesseractOctreeCollisionAlgorithm&) = delete;
+  TesseractOctreeCollisionAlgorithm(TesseractOctreeCollisionAlgorithm&&) = delete;
+  TesseractOctreeCollisionAlgorithm& operator=(TesseractOctreeCollisionAlgorithm&&) = delete;
+
+  void processCollision(const btCollisionObjectWrapper* body0Wrap,
+                        const btCollisionObjectWrapper* body1Wrap,
+                        const btDispatcherInfo& dispatchInfo,
+                        btManifoldResult* resultOut) override;
+
+  btScalar calculateTimeOfImpact(btCollisionObject* body0,
+                                 btCollisionObject* body1,
+                                 const btDispatcherInfo& dispatchInfo,
+                                 btManifoldResult* resultOut) override;
+
+  /** @brief The manifolds are owned by the transient algorithms of the leafs */
+  void getAllContactManifolds(btManifoldArray& /*manifoldArray*/) override {}
+
+  /** @brief Creates the algorithm when the first body is the octree shape */
+  struct CreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractOctreeCollisionAlgorithm));
+      return new (mem) TesseractOctreeCollisionAlgorithm(ci, body0Wrap, body1Wrap, false);
+    }
+  };
+
+  /** @brief Creates the algorithm when the second body is the octree shape */
+  struct SwappedCreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractOctreeCollisionAlgorithm));
+      return new (mem) TesseractOctreeCollisionAlgorithm(ci, body0Wrap, body1Wrap, true);
+    }
+  };
+
+private:
+  bool m_isSwapped;
+};
+}  // namespace tesseract_collision_bullet
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
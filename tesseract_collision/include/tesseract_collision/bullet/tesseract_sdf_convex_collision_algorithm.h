@@ -0,0 +1,130 @@
+/**
+ * @file tesseract_sdf_convex_collision_algorithm.h
+ * @brief Collision algorithm for a signed distance field mesh shape and a convex shape
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_SDF_CONVEX_COLLISION_ALGORITHM_H
+#define TESSERACT_COLLISION_TESSERACT_SDF_CONVEX_COLLISION_ALGORITHM_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/BroadphaseCollision/btDispatcher.h>
+#include <BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.h>
+#include <BulletCollision/CollisionDispatch/btCollisionCreateFunc.h>
+#include <BulletCollision/NarrowPhaseCollision/btPersistentManifold.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision
+{
+namespace tesseract_collision_bullet
+{
+/**
+ * @brief Supports collision between a TesseractSDFMeshShape and a convex shape using the signed distance field
+ *
+ * The distance of a sphere is the distance of its center minus its radius. For other convex shapes the support point
+ * in the direction opposite to the gradient of the field is followed downhill, starting from the support points along
+ * the axes of the field, which finds the deepest point of the shape with a few lookups instead of running GJK and EPA
+ * against the triangles.
+ *
+ * The results are approximate. The distance of a sphere has the interpolation error of the field, which is bounded by
+ * sqrt(3) times its cell size, see SignedDistanceField::getDistance. The descent for other convex shapes only finds a
+ * local minimum of the field over the shape, so when several parts of the mesh are close to the shape it can miss the
+ * closest one and report a larger distance. Use a Mesh geometry when exact contacts are required.
+ */
+class TesseractSDFConvexCollisionAlgorithm : public btActivatingCollisionAlgorithm  // NOLINT
+{
+public:
+  TesseractSDFConvexCollisionAlgorithm(btPersistentManifold* mf,
+                                       const btCollisionAlgorithmConstructionInfo& ci,
+                                       const btCollisionObjectWrapper* body0Wrap,
+                                       const btCollisionObjectWrapper* body1Wrap,
+                                       bool isSwapped);
+  ~TesseractSDFConvexCollisionAlgorithm() override;
+  TesseractSDFConvexCollisionAlgorithm(const TesseractSDFConvexCollisionAlgorithm&) = delete;
+  TesseractSDFConvexCollisionAlgorithm& operator=(const TesseractSDFConvexCollisionAlgorithm&) = delete;
+  TesseractSDFConvexCollisionAlgorithm(TesseractSDFConvexCollisionAlgorithm&&) = delete;
+  TesseractSDFConvexCollisionAlgorithm& operator=(TesseractSDFConvexCollisionAlgorithm&&) = delete;
+
+  void processCollision(const btCollisionObjectWrapper* body0Wrap,
+                        const btCollisionObjectWrapper* body1Wrap,
+                        const btDispatcherInfo& dispatchInfo,
+                        btManifoldResult* resultOut) override;
+
+  btScalar calculateTimeOfImpact(btCollisionObject* body0,
+                                 btCollisionObject* body1,
+                                 const btDispatcherInfo& dispatchInfo,
+                                 btManifoldResult* resultOut) override;
+
+  void getAllContactManifolds(btManifoldArray& manifoldArray) override
+  {
+    if (m_manifoldPtr && m_ownManifold)
+      manifoldArray.push_back(m_manifoldPtr);
+  }
+
+  /** @brief Creates the algorithm when the first body is the SDF mesh shape */
+  struct CreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractSDFConvexCollisionAlgorithm));
+      return new (mem) TesseractSDFConvexCollisionAlgorithm(nullptr, ci, body0Wrap, body1Wrap, false);
+    }
+  };
+
+  /** @brief Creates the algorithm when the second body is the SDF mesh shape */
+  struct SwappedCreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractSDFConvexCollisionAlgorithm));
+      return new (mem) TesseractSDFConvexCollisionAlgorithm(nullptr, ci, body0Wrap, body1Wrap, true);
+    }
+  };
+
+private:
+  bool m_ownManifold{ false };
+  btPersistentManifold* m_manifoldPtr;
+  bool m_isSwapped;
+};
+}  // namespace tesseract_collision_bullet
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_TESSERACT_SDF_CONVEX_COLLISION_ALGORITHM_H
@@ -26,14 +26,97 @@
 #ifndef TESSERACT_COLLISION_CONVEX_DECOMPOSITION_H
 #define TESSERACT_COLLISION_CONVEX_DECOMPOSITION_H
 
-#include <vector>
+#include <atomic>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 #include <tesseract_common/types.h>
 #include <tesseract_geometry/impl/convex_mesh.h>
 
 namespace tesseract_collision
 {
-class ConvexDecomposition
+/**
+ * @brief The progress of a convex decomposition, which may be cancelled from another thread
+ * @details All methods are thread safe
+ */
+class ConvexDecompositionStatus
+{
+public:
+  using Ptr = std::shared_ptr<ConvexDecompositionStatus>;
+  using ConstPtr = std::shared_ptr<const ConvexDecompositionStatus>;
+
+  /** @brief Request the convex decomposition to stop, it returns no results once it has stopped */
+  void cancel() { cancelled_ = true; }
+
+  /** @brief Check if the convex decomposition has been cancelled */
+  bool isCancelled() const { return cancelled_; }
+
+  /**
+   * @brief Set the progress of the convex decomposition
+   * @param progress The overall progress in percent
+   * @param stage The name of the current stage
+   */
+  void setProgress(double progress, std::string stage)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    progress_ = progress;
+    stage_ = std::move(stage);
+  }
+
+  /** @brief Get the overall progress in percent */
+  double getProgress() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return progress_;
+  }
+
+  /** @brief Get the name of the current stage */
+  std::string getStage() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stage_;
+  }
+
+private:
+  std::atomic<bool> cancelled_{ false };
+  mutable std::mutex mutex_;
+  double progress_{ 0 };
+  std::string stage_;
+};
+
+/** @brief A handle of a convex decomposition running in a background thread */
+class ConvexDecompositionTask
+{
+public:
+  ConvexDecompositionTask(std::shared_future<std::vector<tesseract_geometry::ConvexMesh::Ptr>> future,
+                          ConvexDecompositionStatus::Ptr status)
+    : future_(std::move(future)), status_(std::move(status))
+  {
+  }
+
+  /** @brief Get the future of the results, which are empty if the convex decomposition failed or was cancelled */
+  const std::shared_future<std::vector<tesseract_geometry::ConvexMesh::Ptr>>& getFuture() const { return future_; }
+
+  /** @brief Check if the convex decomposition has finished without blocking */
+  bool isReady() const { return (future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready); }
+
+  /** @brief Wait for the convex decomposition and get the results */
+  const std::vector<tesseract_geometry::ConvexMesh::Ptr>& get() const { return future_.get(); }
+
+  /** @brief Request the convex decomposition to stop */
+  void cancel() { status_->cancel(); }
+
+  /** @brief Get the progress of the convex decomposition */
+  const ConvexDecompositionStatus& getStatus() const { return *status_; }
+
+private:
+  std::shared_future<std::vector<tesseract_geometry::ConvexMesh::Ptr>> future_;
+  ConvexDecompositionStatus::Ptr status_;
+};
+
+class ConvexDecomposition : public std::enable_shared_from_this<ConvexDecomposition>
 {
 public:
   using Ptr = std::shared_ptr<ConvexDecomposition>;
@@ -55,6 +138,53 @@ public:
    */
   virtual std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
                                                                    const Eigen::VectorXi& faces) const = 0;
+
+  /**
+   * @brief Run convex decomposition algorithm reporting its progress
+   * @details The default implementation only checks for cancellation before running the algorithm
+   * @param vertices The vertices
+   * @param faces A vector of triangle indicies. Every face starts with the number of vertices followed the the vertice
+   * index
+   * @param status The status which receives the progress and is checked for cancellation
+   * @return The convex meshes, empty if the algorithm failed or was cancelled
+   */
+  virtual std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
+                                                                   const Eigen::VectorXi& faces,
+                                                                   ConvexDecompositionStatus& status) const
+  {
+    if (status.isCancelled())
+      return {};
+
+    std::vector<tesseract_geometry::ConvexMesh::Ptr> output = compute(vertices, faces);
+    status.setProgress(100, "Finished");
+    return output;
+  }
+
+  /**
+   * @brief Run convex decomposition algorithm in a background thread
+   * @details The convex decomposition must be owned by a shared pointer, which the task holds until it has finished.
+   * Several tasks may run concurrently, each algorithm may use multiple threads itself.
+   * @param vertices The vertices, which are copied
+   * @param faces A vector of triangle indicies, which are copied
+   * @return The handle of the task, which reports the progress and can be used to cancel it
+   */
+  ConvexDecompositionTask computeAsync(tesseract_common::VectorVector3d vertices, Eigen::VectorXi faces) const
+  {
+    auto status = std::make_shared<ConvexDecompositionStatus>();
+    std::shared_future<std::vector<tesseract_geometry::ConvexMesh::Ptr>> future =
+        std::async(std::launch::async,
+                   [self = shared_from_this(), status, vertices = std::move(vertices), faces = std::move(faces)]() {
+                     return self->compute(vertices, faces, *status);
+                   });
+    return ConvexDecompositionTask(std::move(future), std::move(status));
+  }
+
+  /**
+   * @brief Get a string which identifies the algorithm and all parameters which affect the results
+   * @details This is used to key cached results, so two decompositions must only return the same string if they
+   * produce the same results. An empty string indicates the results should not be cached.
+   */
+  virtual std::string getCacheKey() const { return {}; }
 };
 
 }  // namespace tesseract_collision
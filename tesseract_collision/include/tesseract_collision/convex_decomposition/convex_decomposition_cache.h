@@ -0,0 +1,80 @@
+/**
+ * @file convex_decomposition_cache.h
+ * @brief A persistent on-disk cache of convex decomposition results
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CONVEX_DECOMPOSITION_CACHE_H
+#define TESSERACT_COLLISION_CONVEX_DECOMPOSITION_CACHE_H
+
+#include <tesseract_collision/convex_decomposition/convex_decomposition.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief A convex decomposition which stores the results of another convex decomposition in a cache directory
+ *
+ * The results are stored in a binary file per input, named after a hash of the vertices, faces and the cache key of
+ * the decomposition. The file also stores the full cache key and the size of the input, which are checked before the
+ * results are used. Files are written to a temporary file first and then renamed, so several processes may share the
+ * same cache directory.
+ *
+ * The cache is only used if the decomposition provides a cache key, otherwise every call is forwarded to it.
+ */
+class ConvexDecompositionCache : public ConvexDecomposition
+{
+public:
+  using Ptr = std::shared_ptr<ConvexDecompositionCache>;
+  using ConstPtr = std::shared_ptr<const ConvexDecompositionCache>;
+
+  /**
+   * @brief Constructor
+   * @param decomposition The convex decomposition used when the results are not in the cache
+   * @param cache_directory The directory the results are stored in, which is created if it does not exist
+   */
+  ConvexDecompositionCache(ConvexDecomposition::ConstPtr decomposition, std::string cache_directory);
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
+                                                           const Eigen::VectorXi& faces) const override;
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
+                                                           const Eigen::VectorXi& faces,
+                                                           ConvexDecompositionStatus& status) const override;
+
+  std::string getCacheKey() const override;
+
+  /** @brief Get the directory the results are stored in */
+  const std::string& getCacheDirectory() const;
+
+  /**
+   * @brief Get the path of the file storing the results for the provided mesh
+   * @return The path of the file, empty if the decomposition does not provide a cache key
+   */
+  std::string getCacheFilePath(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& faces) const;
+
+private:
+  ConvexDecomposition::ConstPtr decomposition_;
+  std::string cache_directory_;
+};
+
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_CONVEX_DECOMPOSITION_CACHE_H
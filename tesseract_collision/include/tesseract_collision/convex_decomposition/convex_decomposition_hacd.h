@@ -53,9 +53,13 @@ public:
   ConvexDecompositionHACD() = default;
   ConvexDecompositionHACD(const HACDParameters& params);
 
+  using ConvexDecomposition::compute;
+
   std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
                                                            const Eigen::VectorXi& faces) const override;
 
+  std::string getCacheKey() const override;
+
 private:
   HACDParameters params_;
 };
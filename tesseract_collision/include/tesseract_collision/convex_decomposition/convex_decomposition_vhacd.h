@@ -66,6 +66,12 @@ public:
   std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
                                                            const Eigen::VectorXi& faces) const override;
 
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
+                                                           const Eigen::VectorXi& faces,
+                                                           ConvexDecompositionStatus& status) const override;
+
+  std::string getCacheKey() const override;
+
 private:
   VHACDParameters params_;
 };
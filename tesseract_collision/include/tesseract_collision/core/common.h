@@ -29,6 +29,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <LinearMath/btConvexHullComputer.h>
+#include <algorithm>
 #include <cstdio>
 #include <cctype>
 #include <Eigen/Geometry>
@@ -68,6 +69,17 @@ inline bool isLinkActive(const std::vector<std::string>& active, const std::stri
   return active.empty() || (std::find(active.begin(), active.end(), name) != active.end());
 }
 
+/**
+ * @brief This will check if a link is active provided a sorted list. If the list is empty the link is active.
+ * @details This is faster than isLinkActive when many links are checked against the same list of active links.
+ * @param sorted_active Sorted list of active link names
+ * @param name The name of link to check if it is active.
+ */
+inline bool isLinkActiveSorted(const std::vector<std::string>& sorted_active, const std::string& name)
+{
+  return sorted_active.empty() || std::binary_search(sorted_active.begin(), sorted_active.end(), name);
+}
+
 /**
  * @brief Determine if contact is allowed between two objects.
  * @param name1 The name of the first object
@@ -103,45 +115,69 @@ inline bool isContactAllowed(const std::string& name1,
   return false;
 }
 
+namespace detail
+{
 /**
- * @brief processResult Processes the ContactResult based on the information in the ContactTestData
+ * @brief Count a newly stored contact and mark the search as finished if the contact limit has been reached
  * @param cdata Information used to process the results
+ */
+inline void addLimitedContact(ContactTestData& cdata)
+{
+  ++cdata.num_contacts;
+  if (cdata.req.contact_limit > 0 && cdata.num_contacts >= cdata.req.contact_limit)
+    cdata.done = true;
+}
+
+/**
+ * @brief Store the ContactResult in the provided results container based on the information in the ContactTestData
+ * @param cdata Information used to process the results
+ * @param res The results container, either a ContactResultMap or ContactResultIdMap
  * @param contact Contacts from the collision checkers that will be processed
- * @param key Link pair used as a key to look up pair specific settings
+ * @param key The key of the link pair in the results container
  * @param found Specifies whether or not a collision has already been found
  * @return Pointer to the ContactResult.
  */
-inline ContactResult* processResult(ContactTestData& cdata,
-                                    ContactResult& contact,
-                                    const std::pair<std::string, std::string>& key,
-                                    bool found)
+template <typename ResultMapType, typename KeyType>
+inline ContactResult*
+storeResult(ContactTestData& cdata, ResultMapType& res, ContactResult& contact, const KeyType& key, bool found)
 {
-  if (cdata.req.is_valid && !cdata.req.is_valid(contact))
-    return nullptr;
-
-  if ((cdata.req.calculate_distance || cdata.req.calculate_penetration) &&
-      (contact.distance > cdata.collision_margin_data.getPairCollisionMargin(key.first, key.second)))
-    return nullptr;
-
   if (!found)
   {
-    ContactResultVector data;
+    // The vector is populated in place, so containers which keep the vectors of cleared entries such as the
+    // ContactResultIdMap reuse their memory. Reserving is a no-op for a reused vector.
+    ContactResultVector& data = res[key];
     if (cdata.req.type == ContactTestType::FIRST)
     {
       data.emplace_back(contact);
       cdata.done = true;
     }
+    else if (cdata.req.type == ContactTestType::LIMITED)
+    {
+      // A pair stores at most pair_contact_limit contacts
+      if (cdata.req.pair_contact_limit > 0)
+        data.reserve(static_cast<std::size_t>(std::min(cdata.req.pair_contact_limit, 100L)));
+      else
+        data.reserve(100);
+
+      data.emplace_back(contact);
+      addLimitedContact(cdata);
+    }
+    else if (cdata.req.type == ContactTestType::CLOSEST)
+    {
+      // Only a single contact is stored for each pair
+      data.emplace_back(contact);
+    }
     else
     {
       data.reserve(100);  // TODO: Need better way to initialize this
       data.emplace_back(contact);
     }
 
-    return &(cdata.res->insert(std::make_pair(key, data)).first->second.back());
+    return &(data.back());
   }
 
   assert(cdata.req.type != ContactTestType::FIRST);
-  ContactResultVector& dr = (*cdata.res)[key];
+  ContactResultVector& dr = res[key];
   if (cdata.req.type == ContactTestType::ALL)
   {
     dr.emplace_back(contact);
@@ -156,16 +192,222 @@ inline ContactResult* processResult(ContactTestData& cdata,
       return &(dr[0]);
     }
   }
-  //    else if (cdata.cdata.condition == DistanceRequestType::LIMITED)
-  //    {
-  //      assert(dr.size() < cdata.req->max_contacts_per_body);
-  //      dr.emplace_back(contact);
-  //      return &(dr.back());
-  //    }
+  else if (cdata.req.type == ContactTestType::LIMITED)
+  {
+    if (cdata.req.pair_contact_limit < 1 || static_cast<long>(dr.size()) < cdata.req.pair_contact_limit)
+    {
+      dr.emplace_back(contact);
+      addLimitedContact(cdata);
+      return &(dr.back());
+    }
+
+    // The pair is full so replace the farthest contact if this one is closer
+    auto farthest = std::max_element(dr.begin(), dr.end(), [](const ContactResult& a, const ContactResult& b) {
+      return a.distance < b.distance;
+    });
+    if (contact.distance < farthest->distance)
+    {
+      *farthest = contact;
+      return &(*farthest);
+    }
+  }
 
   return nullptr;
 }
 
+/**
+ * @brief Store a distance only contact result, keeping the closest contact for each pair of objects
+ * @param cdata Information used to process the results
+ * @param res The results container
+ * @param contact The contact result to store
+ * @return True if the contact result was stored
+ */
+inline bool storeDistanceResult(ContactTestData& cdata,
+                                ContactDistanceResultMap& res,
+                                const ContactDistanceResult& contact)
+{
+  auto it = res.insert(contact);
+  if (it.second)
+  {
+    if (cdata.req.type == ContactTestType::FIRST)
+      cdata.done = true;
+    else if (cdata.req.type == ContactTestType::LIMITED)
+      addLimitedContact(cdata);
+
+    return true;
+  }
+
+  assert(cdata.req.type != ContactTestType::FIRST);
+  if (contact.distance < it.first->distance)
+  {
+    *it.first = contact;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Get the collision margin of a pair of objects
+ *
+ * This avoids the name pair lookup when there are no pair specific margins.
+ */
+inline double getCollisionMargin(const ContactTestData& cdata, const std::string& name1, const std::string& name2)
+{
+  const CollisionMarginData& margin_data = cdata.collision_margin_data;
+  return margin_data.getPairCollisionMargins().empty() ? margin_data.getDefaultCollisionMargin() :
+                                                         margin_data.getPairCollisionMargin(name1, name2);
+}
+
+/**
+ * @brief Get the distance a pair of objects must be within to produce contacts
+ *
+ * Contacts further apart than the collision margin of the pair are discarded when processing the results, so pairs
+ * further apart than this distance can skip the narrowphase.
+ *
+ * @param cdata The contact test data
+ * @param name1 The name of the first object
+ * @param name2 The name of the second object
+ * @param contact_distance The contact distance used by the narrowphase
+ * @return The distance bound
+ */
+inline double getContactDistanceBound(const ContactTestData& cdata,
+                                      const std::string& name1,
+                                      const std::string& name2,
+                                      double contact_distance)
+{
+  if (cdata.req.calculate_distance || cdata.req.calculate_penetration)
+    return std::min(contact_distance, getCollisionMargin(cdata, name1, name2));
+
+  return contact_distance;
+}
+}  // namespace detail
+
+/**
+ * @brief processResult Processes the ContactResult based on the information in the ContactTestData
+ * @param cdata Information used to process the results
+ * @param contact Contacts from the collision checkers that will be processed
+ * @param key Link pair used as a key to look up pair specific settings
+ * @param found Specifies whether or not a collision has already been found
+ * @return Pointer to the ContactResult.
+ */
+inline ContactResult* processResult(ContactTestData& cdata,
+                                    ContactResult& contact,
+                                    const std::pair<std::string, std::string>& key,
+                                    bool found)
+{
+  if (cdata.req.is_valid && !cdata.req.is_valid(contact))
+    return nullptr;
+
+  if ((cdata.req.calculate_distance || cdata.req.calculate_penetration) &&
+      (contact.distance > cdata.collision_margin_data.getPairCollisionMargin(key.first, key.second)))
+    return nullptr;
+
+  return detail::storeResult(cdata, *cdata.res, contact, key, found);
+}
+
+/**
+ * @brief processResult Processes the ContactResult based on the information in the ContactTestData and stores it in
+ * the id keyed results container
+ * @param cdata Information used to process the results
+ * @param contact Contacts from the collision checkers that will be processed
+ * @param key Link pair id used as a key in the results container
+ * @param name1 The name of the first link, used to look up pair specific settings
+ * @param name2 The name of the second link, used to look up pair specific settings
+ * @param found Specifies whether or not a collision has already been found
+ * @return Pointer to the ContactResult.
+ */
+inline ContactResult* processResult(ContactTestData& cdata,
+                                    ContactResult& contact,
+                                    ObjectPairId key,
+                                    const std::string& name1,
+                                    const std::string& name2,
+                                    bool found)
+{
+  if (cdata.req.is_valid && !cdata.req.is_valid(contact))
+    return nullptr;
+
+  if ((cdata.req.calculate_distance || cdata.req.calculate_penetration) &&
+      (contact.distance > detail::getCollisionMargin(cdata, name1, name2)))
+    return nullptr;
+
+  return detail::storeResult(cdata, *cdata.res_ids, contact, key, found);
+}
+
+/**
+ * @brief Create a collision objects handle using the interned ids of the names
+ *
+ * Names which have never been added to the contact manager get an invalid id of -1 and are skipped by the handle.
+ *
+ * @param names The names of the collision objects, in the order of the poses
+ * @param registry The registry of the contact manager
+ * @return The collision objects handle
+ */
+inline CollisionObjectsHandle createCollisionObjectsHandle(const std::vector<std::string>& names,
+                                                           const ObjectIdRegistry& registry)
+{
+  CollisionObjectsHandle handle;
+  handle.names = names;
+  handle.ids.reserve(names.size());
+  for (const auto& name : names)
+    handle.ids.push_back(registry.getId(name));
+
+  return handle;
+}
+
+/**
+ * @brief Processes the distance only contact result based on the information in the ContactTestData and stores it in
+ * the distance results container, only the closest contact of each pair of objects is kept
+ * @param cdata Information used to process the results
+ * @param contact Contact from the collision checkers that will be processed
+ * @param name1 The name of the first link, used to look up pair specific settings
+ * @param name2 The name of the second link, used to look up pair specific settings
+ * @return True if the contact result was stored
+ */
+inline bool processDistanceResult(ContactTestData& cdata,
+                                  const ContactDistanceResult& contact,
+                                  const std::string& name1,
+                                  const std::string& name2)
+{
+  if ((cdata.req.calculate_distance || cdata.req.calculate_penetration) &&
+      (contact.distance > detail::getCollisionMargin(cdata, name1, name2)))
+    return false;
+
+  return detail::storeDistanceResult(cdata, *cdata.res_distance, contact);
+}
+
+/**
+ * @brief Processes a contact result based on the information in the ContactTestData and stores it in the results
+ * container used by the contact test data
+ * @param cdata Information used to process the results
+ * @param contact Contact from the collision checkers that will be processed, the link ids and names must be set
+ * @return True if the contact result was stored
+ */
+inline bool processContactResult(ContactTestData& cdata, ContactResult& contact)
+{
+  if (cdata.res_distance != nullptr)
+  {
+    if (cdata.req.is_valid && !cdata.req.is_valid(contact))
+      return false;
+
+    return processDistanceResult(cdata,
+                                 toContactDistanceResult(contact, cdata.req.calculate_nearest_points),
+                                 contact.link_names[0],
+                                 contact.link_names[1]);
+  }
+
+  if (cdata.res_ids != nullptr)
+  {
+    ObjectPairId pc = getObjectPairId(contact.link_ids[0], contact.link_ids[1]);
+    bool found = (cdata.res_ids->find(pc) != cdata.res_ids->end());
+    return (processResult(cdata, contact, pc, contact.link_names[0], contact.link_names[1], found) != nullptr);
+  }
+
+  ObjectPairKey pc = getObjectPairKey(contact.link_names[0], contact.link_names[1]);
+  bool found = (cdata.res->find(pc) != cdata.res->end());
+  return (processResult(cdata, contact, pc, found) != nullptr);
+}
+
 /**
  * @brief Create a convex hull from vertices using Bullet Convex Hull Computer
  * @param (Output) vertices A vector of vertices
@@ -0,0 +1,409 @@
+/**
+ * @file contact_pair_cache.h
+ * @brief A cache of the narrowphase contacts of each pair of collision objects between contact tests
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CONTACT_PAIR_CACHE_H
+#define TESSERACT_COLLISION_CONTACT_PAIR_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+#include <tesseract_collision/core/common.h>
+
+namespace tesseract_collision
+{
+/**
+ * @brief The key of a pair in the contact pair cache
+ *
+ * It stores the object id and shape index of both sides ordered by object id, { id1, shape1, id2, shape2 }. Contact
+ * managers which run the narrowphase for the whole collision object use -1 for the shape index.
+ */
+using ContactPairCacheKey = std::array<int, 4>;
+
+/** @brief The hash function of the contact pair cache key */
+struct ContactPairCacheKeyHash
+{
+  std::size_t operator()(const ContactPairCacheKey& key) const
+  {
+    const ObjectPairId shapes = (static_cast<ObjectPairId>(static_cast<std::uint32_t>(key[1])) << 32U) |
+                                static_cast<ObjectPairId>(static_cast<std::uint32_t>(key[3]));
+    return hashObjectPairId(getObjectPairId(key[0], key[2]) ^ hashObjectPairId(shapes));
+  }
+};
+
+/** @brief The default distance beyond the contact distance searched by the narrowphase when using the distance bound */
+static const double DEFAULT_DISTANCE_BOUND_SEARCH_MARGIN = 0.1;
+
+/** @brief The narrowphase contacts of a pair of collision objects and the state they were computed for */
+struct ContactPairCacheEntry
+{
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /** @brief The transforms of the collision objects, ordered by object id */
+  std::array<Eigen::Isometry3d, 2> transforms{ Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity() };
+
+  /** @brief The contact distance used by the narrowphase */
+  double contact_distance{ 0 };
+
+  /** @brief Contact manager specific narrowphase settings the contacts depend on */
+  std::size_t settings{ 0 };
+
+  /** @brief Indicate if the contacts are complete and can be replayed */
+  bool valid{ false };
+
+  /** @brief A lower bound of the distance between the collision objects at the stored transforms */
+  double distance{ std::numeric_limits<double>::max() };
+
+  /** @brief The contacts found by the narrowphase, the link ids and names are set */
+  ContactResultVector contacts;
+};
+
+/**
+ * @brief Get an upper bound of how far any point of a collision object moved between two transforms
+ *
+ * A point at distance r from the origin of the collision object moves at most the translation plus the rotation angle
+ * times r.
+ *
+ * @param tf1 The previous transform of the collision object
+ * @param tf2 The current transform of the collision object
+ * @param radius The radius of a sphere about the origin of the collision object which contains all of its shapes
+ * @return The distance bound
+ */
+inline double getMotionBound(const Eigen::Isometry3d& tf1, const Eigen::Isometry3d& tf2, double radius)
+{
+  const double translation = (tf2.translation() - tf1.translation()).norm();
+  const double angle = std::abs(Eigen::AngleAxisd(tf1.linear().transpose() * tf2.linear()).angle());
+  return (angle > 0) ? translation + angle * radius : translation;
+}
+
+/**
+ * @brief A thread safe cache of the narrowphase contacts of each pair of collision objects
+ *
+ * Successive contact tests often only move a few collision objects. The contact managers store the contacts found by
+ * the narrowphase for a pair together with the transforms and contact distance they were computed with, and replay
+ * them through the regular result processing when neither transform nor the contact distance changed. The contacts
+ * are stored before they are filtered by the contact request, so the results are the same as running the narrowphase.
+ * Pairs which finish the search, for example with ContactTestType::FIRST, are not cached since their contacts may be
+ * incomplete.
+ *
+ * With the distance bound enabled the cache also skips pairs which moved but can not be within the contact distance.
+ * The narrowphase searches up to the search margin beyond the contact distance, which provides a lower bound d of the
+ * distance of the pair. If the objects moved by at most delta since, see getMotionBound, the pair is skipped while
+ * d - delta is larger than the contact distance.
+ *
+ * The contact managers clear the cache when collision objects are added or removed.
+ */
+class ContactPairCache
+{
+public:
+  using Ptr = std::shared_ptr<ContactPairCache>;
+  using ConstPtr = std::shared_ptr<const ContactPairCache>;
+  using Entry = ContactPairCacheEntry;
+
+  /** @brief The result of looking up a pair */
+  enum class Status
+  {
+    MISS, /**< The narrowphase must be run and its contacts stored in the entry */
+    HIT,  /**< The contacts of the entry can be replayed */
+    SKIP  /**< The pair can not be within the contact distance so the narrowphase is skipped */
+  };
+
+  /**
+   * @brief Look up the entry of a pair of collision objects and count the result
+   *
+   * On a miss the entry is reset to the provided state and its contacts are cleared. The caller stores the contacts
+   * found by the narrowphase and marks the entry valid once the narrowphase of the pair has completed. Each pair must
+   * only be processed by one thread at a time.
+   *
+   * @param id1 The object id of the first collision object
+   * @param shape1 The shape index of the first collision object
+   * @param tf1 The world transform of the first collision object
+   * @param radius1 The bounding radius of the first collision object, see getMotionBound
+   * @param id2 The object id of the second collision object
+   * @param shape2 The shape index of the second collision object
+   * @param tf2 The world transform of the second collision object
+   * @param radius2 The bounding radius of the second collision object, see getMotionBound
+   * @param contact_distance The contact distance used by the narrowphase
+   * @param bound_distance The distance a pair must be within to produce contacts, used by the distance bound
+   * @param settings Contact manager specific narrowphase settings the contacts depend on
+   * @return The entry and the result of the lookup
+   */
+  std::pair<Entry*, Status> lookup(int id1,
+                                   int shape1,
+                                   const Eigen::Isometry3d& tf1,
+                                   double radius1,
+                                   int id2,
+                                   int shape2,
+                                   const Eigen::Isometry3d& tf2,
+                                   double radius2,
+                                   double contact_distance,
+                                   double bound_distance,
+                                   std::size_t settings = 0)
+  {
+    const bool swap = (id2 < id1);
+    const Eigen::Isometry3d& first_tf = (swap) ? tf2 : tf1;
+    const Eigen::Isometry3d& second_tf = (swap) ? tf1 : tf2;
+    const ContactPairCacheKey key =
+        (swap) ? ContactPairCacheKey{ id2, shape2, id1, shape1 } : ContactPairCacheKey{ id1, shape1, id2, shape2 };
+
+    Entry* entry{ nullptr };
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      entry = &entries_[key];
+    }
+
+    if (entry->valid && entry->contact_distance == contact_distance && entry->settings == settings &&
+        entry->transforms[0].matrix() == first_tf.matrix() && entry->transforms[1].matrix() == second_tf.matrix())
+    {
+      ++hits_;
+      return std::make_pair(entry, Status::HIT);
+    }
+
+    // The entry keeps the transforms of the last narrowphase so the motion bound accumulates over skipped tests
+    if (distance_bound_ && entry->valid)
+    {
+      const double motion = getMotionBound(entry->transforms[0], first_tf, (swap) ? radius2 : radius1) +
+                            getMotionBound(entry->transforms[1], second_tf, (swap) ? radius1 : radius2);
+      if (entry->distance - motion > bound_distance)
+      {
+        ++skips_;
+        return std::make_pair(entry, Status::SKIP);
+      }
+    }
+
+    ++misses_;
+    entry->transforms[0] = first_tf;
+    entry->transforms[1] = second_tf;
+    entry->contact_distance = contact_distance;
+    entry->settings = settings;
+    entry->valid = false;
+    entry->distance = std::numeric_limits<double>::max();
+    entry->contacts.clear();
+    return std::make_pair(entry, Status::MISS);
+  }
+
+  /**
+   * @brief Enable skipping the narrowphase of pairs which can not be within the contact distance
+   * @param enabled Indicate if the distance bound is used
+   * @param search_margin The distance beyond the contact distance searched by the narrowphase. Larger values allow
+   * the objects to move further before the narrowphase is run again at the cost of a slower narrowphase.
+   */
+  void setDistanceBound(bool enabled, double search_margin = DEFAULT_DISTANCE_BOUND_SEARCH_MARGIN)
+  {
+    distance_bound_ = enabled;
+    search_margin_ = search_margin;
+  }
+
+  /** @brief Check if the distance bound is enabled */
+  bool isDistanceBoundEnabled() const { return distance_bound_; }
+
+  /** @brief The distance beyond the contact distance searched by the narrowphase when using the distance bound */
+  double getSearchMargin() const { return (distance_bound_) ? search_margin_ : 0; }
+
+  /** @brief Remove all entries, this does not reset the counters */
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+  }
+
+  /** @brief The number of entries */
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  /** @brief The number of pairs whose contacts were replayed from the cache */
+  std::size_t getHits() const { return hits_.load(); }
+
+  /** @brief The number of pairs which required running the narrowphase */
+  std::size_t getMisses() const { return misses_.load(); }
+
+  /** @brief The number of pairs skipped by the distance bound */
+  std::size_t getSkips() const { return skips_.load(); }
+
+  /** @brief Reset the hit, miss and skip counters */
+  void resetCounters()
+  {
+    hits_ = 0;
+    misses_ = 0;
+    skips_ = 0;
+  }
+
+private:
+  std::unordered_map<ContactPairCacheKey,
+                     Entry,
+                     ContactPairCacheKeyHash,
+                     std::equal_to<>,
+                     Eigen::aligned_allocator<std::pair<const ContactPairCacheKey, Entry>>>
+      entries_;
+  mutable std::mutex mutex_;
+  std::atomic<std::size_t> hits_{ 0 };
+  std::atomic<std::size_t> misses_{ 0 };
+  std::atomic<std::size_t> skips_{ 0 };
+  bool distance_bound_{ false };
+  double search_margin_{ DEFAULT_DISTANCE_BOUND_SEARCH_MARGIN };
+};
+
+/** @brief Update the distance bound of the pair being recorded in the contact pair cache with a narrowphase distance */
+inline void updateContactPairCacheDistance(ContactTestData& cdata, double distance)
+{
+  if (cdata.pair_cache_entry != nullptr)
+    cdata.pair_cache_entry->distance = std::min(cdata.pair_cache_entry->distance, distance);
+}
+
+/**
+ * @brief Uses the contact pair cache of the contact test data for the narrowphase of a single pair
+ *
+ * If lookup returns true the cached contacts were stored in the results, or the pair can not be within the contact
+ * distance, and the narrowphase must be skipped. Otherwise the contacts and distances found by the narrowphase are
+ * recorded in the cache until the scope ends. The scope does nothing if the contact test data has no contact pair
+ * cache.
+ */
+class ContactPairCacheScope
+{
+public:
+  explicit ContactPairCacheScope(ContactTestData& cdata) : cdata_(cdata) {}
+  ~ContactPairCacheScope()
+  {
+    if (entry_ == nullptr)
+      return;
+
+    // If the search finished while processing the pair the contacts may be incomplete
+    cdata_.pair_cache_entry = nullptr;
+    entry_->valid = !cdata_.done;
+    entry_->distance = std::min(entry_->distance, search_distance_);
+  }
+  ContactPairCacheScope(const ContactPairCacheScope&) = delete;
+  ContactPairCacheScope& operator=(const ContactPairCacheScope&) = delete;
+  ContactPairCacheScope(ContactPairCacheScope&&) = delete;
+  ContactPairCacheScope& operator=(ContactPairCacheScope&&) = delete;
+
+  /** @brief Check if the contact test data has a contact pair cache */
+  bool isEnabled() const { return (cdata_.pair_cache != nullptr); }
+
+  /**
+   * @brief Look up the pair in the cache, see ContactPairCache::lookup for the parameters
+   * @param cow1 The first collision object, which provides the object id, name and bounding radius
+   * @param cow2 The second collision object, which provides the object id, name and bounding radius
+   * @return True if the narrowphase must be skipped
+   */
+  template <typename CollisionObjectWrapperType>
+  bool lookup(const CollisionObjectWrapperType& cow1,
+              int shape1,
+              const Eigen::Isometry3d& tf1,
+              const CollisionObjectWrapperType& cow2,
+              int shape2,
+              const Eigen::Isometry3d& tf2,
+              double contact_distance,
+              std::size_t settings = 0)
+  {
+    assert(isEnabled() && entry_ == nullptr);
+
+    double bound_distance = contact_distance;
+    if (cdata_.pair_cache->isDistanceBoundEnabled())
+      bound_distance = detail::getContactDistanceBound(cdata_, cow1.getName(), cow2.getName(), contact_distance);
+
+    auto result = cdata_.pair_cache->lookup(cow1.getObjectId(),
+                                            shape1,
+                                            tf1,
+                                            cow1.getBoundingRadius(),
+                                            cow2.getObjectId(),
+                                            shape2,
+                                            tf2,
+                                            cow2.getBoundingRadius(),
+                                            contact_distance,
+                                            bound_distance,
+                                            settings);
+    if (result.second == ContactPairCache::Status::HIT)
+    {
+      ContactResult contact;
+      for (const auto& cached_contact : result.first->contacts)
+      {
+        if (cdata_.done)
+          break;
+
+        contact = cached_contact;
+        processContactResult(cdata_, contact);
+      }
+      return true;
+    }
+
+    if (result.second == ContactPairCache::Status::SKIP)
+      return true;
+
+    entry_ = result.first;
+    cdata_.pair_cache_entry = entry_;
+    return false;
+  }
+
+  /**
+   * @brief Get the contact distance the narrowphase uses for the pair
+   *
+   * While recording with the distance bound enabled the narrowphase searches beyond the contact distance by the search
+   * margin. If it reports nothing closer the pair is known to be at least this far apart, otherwise the distance bound
+   * of the pair is unknown unless the narrowphase updates it, see updateContactPairCacheDistance.
+   *
+   * @param contact_distance The contact distance of the contact test
+   * @return The contact distance for the narrowphase
+   */
+  double searchDistance(double contact_distance)
+  {
+    if (entry_ == nullptr)
+      return contact_distance;
+
+    search_distance_ = contact_distance + cdata_.pair_cache->getSearchMargin();
+    return search_distance_;
+  }
+
+  /**
+   * @brief Record that the narrowphase was skipped because the pair is known to be at least the distance apart
+   * @param distance A lower bound of the distance of the pair
+   */
+  void setDistance(double distance)
+  {
+    if (entry_ != nullptr)
+      search_distance_ = distance;
+  }
+
+private:
+  ContactTestData& cdata_;
+  ContactPairCache::Entry* entry_{ nullptr };
+  double search_distance_{ std::numeric_limits<double>::lowest() };
+};
+
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_CONTACT_PAIR_CACHE_H
@@ -128,6 +128,49 @@ public:
    */
   virtual bool disableCollisionObject(const std::string& name) = 0;
 
+  /**
+   * @brief Enable several objects
+   * @details The broadphase is only updated once for all objects instead of once per object.
+   * @param names The names of the objects
+   * @return True if all objects were found, otherwise false
+   */
+  virtual bool enableCollisionObjects(const std::vector<std::string>& names)
+  {
+    bool found = true;
+    for (const auto& name : names)
+      found = enableCollisionObject(name) && found;
+
+    return found;
+  }
+
+  /**
+   * @brief Disable several objects
+   * @details The broadphase is only updated once for all objects instead of once per object.
+   * @param names The names of the objects
+   * @return True if all objects were found, otherwise false
+   */
+  virtual bool disableCollisionObjects(const std::vector<std::string>& names)
+  {
+    bool found = true;
+    for (const auto& name : names)
+      found = disableCollisionObject(name) && found;
+
+    return found;
+  }
+
+  /**
+   * @brief Update the collision object after a new revision of its geometries was published
+   *
+   * Only octrees can be updated, see tesseract_geometry::Octree::update. The collision object switches to the current
+   * octomap, only processing the voxels changed since its last update where possible, and its bounding volumes are
+   * updated. Some contact managers share the octree shapes with their clones, so this must be called for every contact
+   * manager containing the collision object and not while any of them runs a contact test.
+   *
+   * @param name The name of the object
+   * @return True if the collision object was found and updated, otherwise false
+   */
+  virtual bool updateCollisionObjectGeometries(const std::string& /*name*/) { return false; }
+
   /**
    * @brief Set a single static collision object's tansforms
    * @param name The name of the object
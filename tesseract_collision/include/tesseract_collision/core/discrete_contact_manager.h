@@ -30,7 +30,10 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cassert>
 #include <memory>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/types.h>
@@ -119,6 +122,49 @@ public:
    */
   virtual bool disableCollisionObject(const std::string& name) = 0;
 
+  /**
+   * @brief Enable several objects
+   * @details The broadphase is only updated once for all objects instead of once per object.
+   * @param names The names of the objects
+   * @return True if all objects were found, otherwise false
+   */
+  virtual bool enableCollisionObjects(const std::vector<std::string>& names)
+  {
+    bool found = true;
+    for (const auto& name : names)
+      found = enableCollisionObject(name) && found;
+
+    return found;
+  }
+
+  /**
+   * @brief Disable several objects
+   * @details The broadphase is only updated once for all objects instead of once per object.
+   * @param names The names of the objects
+   * @return True if all objects were found, otherwise false
+   */
+  virtual bool disableCollisionObjects(const std::vector<std::string>& names)
+  {
+    bool found = true;
+    for (const auto& name : names)
+      found = disableCollisionObject(name) && found;
+
+    return found;
+  }
+
+  /**
+   * @brief Update the collision object after a new revision of its geometries was published
+   *
+   * Only octrees can be updated, see tesseract_geometry::Octree::update. The collision object switches to the current
+   * octomap, only processing the voxels changed since its last update where possible, and its bounding volumes are
+   * updated. Some contact managers share the octree shapes with their clones, so this must be called for every contact
+   * manager containing the collision object and not while any of them runs a contact test.
+   *
+   * @param name The name of the object
+   * @return True if the collision object was found and updated, otherwise false
+   */
+  virtual bool updateCollisionObjectGeometries(const std::string& /*name*/) { return false; }
+
   /**
    * @brief Set a single collision object's tansforms
    * @param name The name of the object
@@ -140,6 +186,36 @@ public:
    */
   virtual void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) = 0;
 
+#ifndef SWIG
+  /**
+   * @brief Create a handle for setting the transforms of an ordered list of collision objects
+   *
+   * The names are resolved once, so setting the transforms using the handle avoids looking up each name. Names which
+   * are not collision objects are skipped when setting the transforms. The handle stays valid when collision objects
+   * are removed and added back, but objects added for the first time after the handle was created require a new handle.
+   *
+   * @param names The names of the collision objects, in the order of the poses
+   * @return The handle used by setCollisionObjectsTransform
+   */
+  virtual CollisionObjectsHandle createCollisionObjectsHandle(const std::vector<std::string>& names)
+  {
+    CollisionObjectsHandle handle;
+    handle.names = names;
+    return handle;
+  }
+
+  /**
+   * @brief Set the transforms of the collision objects of a handle
+   * @param handle The handle created by createCollisionObjectsHandle
+   * @param poses The tranformation in world of each collision object of the handle
+   */
+  virtual void setCollisionObjectsTransform(const CollisionObjectsHandle& handle,
+                                            const tesseract_common::VectorIsometry3d& poses)
+  {
+    setCollisionObjectsTransform(handle.names, poses);
+  }
+#endif  // SWIG
+
   /**
    * @brief Get all collision objects
    * @return A list of collision object names
@@ -205,6 +281,130 @@ public:
    * @param request The contact request data
    */
   virtual void contactTest(ContactResultMap& collisions, const ContactRequest& request) = 0;
+
+#ifndef SWIG
+  /**
+   * @brief Perform a contact test for all objects based storing the results keyed by interned object ids
+   *
+   * This avoids the string comparisons and copies associated with ContactResultMap. The link names of the contact
+   * results are not populated, they are resolved on demand using ContactResultIdMap::toContactResultMap or the registry
+   * assigned to the results container.
+   *
+   * The default implementation performs a regular contact test and converts the results.
+   *
+   * @param collisions The contact results keyed by object pair ids
+   * @param request The contact request data
+   */
+  virtual void contactTest(ContactResultIdMap& collisions, const ContactRequest& request)
+  {
+    ContactResultMap results;
+    contactTest(results, request);
+
+    auto registry = (collisions.getObjectIdRegistry() != nullptr) ?
+                        std::make_shared<ObjectIdRegistry>(*collisions.getObjectIdRegistry()) :
+                        std::make_shared<ObjectIdRegistry>();
+    for (auto& pair : results)
+    {
+      ContactResultVector& rv =
+          collisions[getObjectPairId(registry->intern(pair.first.first), registry->intern(pair.first.second))];
+      for (auto& r : pair.second)
+      {
+        r.link_ids[0] = registry->intern(r.link_names[0]);
+        r.link_ids[1] = registry->intern(r.link_names[1]);
+        rv.push_back(std::move(r));
+      }
+    }
+    collisions.setObjectIdRegistry(registry);
+  }
+
+  /**
+   * @brief Perform a distance only contact test for all objects
+   *
+   * Only the signed distance, and the nearest points and normal if ContactRequest::calculate_nearest_points is set, of
+   * the closest contact between each pair of objects is stored in a contiguous array. The contact managers skip
+   * computing the transforms, local points and link names required by the full contact results, which makes this
+   * suited for evaluating distance costs. For ContactTestType::LIMITED the contact limit applies to the number of
+   * pairs.
+   *
+   * The default implementation performs a contact test keyed by object ids and converts the results.
+   *
+   * @param collisions The closest contact result of each pair of objects
+   * @param request The contact request data
+   */
+  virtual void contactTest(ContactDistanceResultMap& collisions, const ContactRequest& request)
+  {
+    ContactResultIdMap results(collisions.getObjectIdRegistry());
+    contactTest(results, request);
+
+    for (const auto& pair : results)
+    {
+      for (const auto& r : pair.second)
+      {
+        const ContactDistanceResult result = toContactDistanceResult(r, request.calculate_nearest_points);
+        auto it = collisions.insert(result);
+        if (!it.second && result.distance < it.first->distance)
+          *it.first = result;
+      }
+    }
+    collisions.setObjectIdRegistry(results.getObjectIdRegistry());
+  }
+#endif  // SWIG
+
+  /**
+   * @brief Perform a contact test for a batch of states
+   *
+   * For each state the provided transforms are applied and a contact test is performed. When finished the collision
+   * objects are left at the transforms of the last state.
+   *
+   * @param collisions The contact results for each state, this is resized to the number of states
+   * @param states A vector of transform maps <name, pose>, one for each state
+   * @param request The contact request data
+   */
+  virtual void batchContactTest(std::vector<ContactResultMap>& collisions,
+                                const std::vector<tesseract_common::TransformMap>& states,
+                                const ContactRequest& request)
+  {
+    collisions.resize(states.size());
+    for (std::size_t i = 0; i < states.size(); ++i)
+    {
+      collisions[i].clear();
+      setCollisionObjectsTransform(states[i]);
+      contactTest(collisions[i], request);
+    }
+  }
+
+  /**
+   * @brief Perform a contact test for a batch of states stored in a dense transform array
+   *
+   * The poses are stored state by state, so the pose of names[j] for state i is poses[i * names.size() + j]. When
+   * finished the collision objects are left at the transforms of the last state.
+   *
+   * @param collisions The contact results for each state, this is resized to the number of states
+   * @param names The collision object names, shared by all states
+   * @param poses The tranformations in world for all states, must be a multiple of the length of names
+   * @param request The contact request data
+   */
+  virtual void batchContactTest(std::vector<ContactResultMap>& collisions,
+                                const std::vector<std::string>& names,
+                                const tesseract_common::VectorIsometry3d& poses,
+                                const ContactRequest& request)
+  {
+    assert(!names.empty() && (poses.size() % names.size()) == 0);
+    const std::size_t num_states = (names.empty()) ? 0 : poses.size() / names.size();
+
+    tesseract_common::VectorIsometry3d state_poses(names.size());
+    collisions.resize(num_states);
+    for (std::size_t i = 0; i < num_states; ++i)
+    {
+      std::copy(poses.begin() + static_cast<long>(i * names.size()),
+                poses.begin() + static_cast<long>((i + 1) * names.size()),
+                state_poses.begin());
+
+      collisions[i].clear();
+      setCollisionObjectsTransform(names, state_poses);
+      contactTest(collisions[i], request);
+    }
+  }
 };
 
 }  // namespace tesseract_collision
@@ -0,0 +1,210 @@
+/**
+ * @file shape_cache.h
+ * @brief A thread safe cache of collision shapes shared between contact managers
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SHAPE_CACHE_H
+#define TESSERACT_COLLISION_SHAPE_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_collision
+{
+/**
+ * @brief The key used to look up a shape in the shape cache
+ *
+ * A key is either the identity of the data buffers a geometry was created from or a name, for example the url of the
+ * resource a mesh was loaded from. The key only holds weak references to the data buffers, so the cache does not keep
+ * the geometry data alive. Two keys of data buffers are only equal if they refer to the same buffers, so a key of
+ * released buffers never matches a new buffer which reuses their address.
+ */
+struct ShapeCacheKey
+{
+  ShapeCacheKey() = default;
+  ShapeCacheKey(const std::shared_ptr<const void>& data0, const std::shared_ptr<const void>& data1)
+    : data0(data0), data1(data1), address0(data0.get()), address1(data1.get())
+  {
+  }
+  explicit ShapeCacheKey(std::string name) : name(std::move(name)) {}
+
+  std::weak_ptr<const void> data0;
+  std::weak_ptr<const void> data1;
+  const void* address0{ nullptr };
+  const void* address1{ nullptr };
+  std::string name;
+
+  bool operator==(const ShapeCacheKey& rhs) const
+  {
+    return (address0 == rhs.address0 && address1 == rhs.address1 && name == rhs.name && sameOwner(data0, rhs.data0) &&
+            sameOwner(data1, rhs.data1));
+  }
+
+private:
+  static bool sameOwner(const std::weak_ptr<const void>& a, const std::weak_ptr<const void>& b)
+  {
+    return (!a.owner_before(b) && !b.owner_before(a));
+  }
+};
+
+/** @brief The hash function of the shape cache key */
+struct ShapeCacheKeyHash
+{
+  std::size_t operator()(const ShapeCacheKey& key) const
+  {
+    std::size_t seed = std::hash<const void*>()(key.address0);
+    seed ^= std::hash<const void*>()(key.address1) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= std::hash<std::string>()(key.name) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+/**
+ * @brief A thread safe cache of collision shapes which are not modified after they are created
+ *
+ * The cache only holds a weak reference to each shape. The shapes returned by insert remove their entries from the
+ * cache when the last collision object using them is destroyed, so the cache only contains shapes which are in use.
+ * The contact managers own the shapes and the cache only allows them to be shared between collision objects, clones
+ * and contact managers.
+ */
+template <typename ShapeType>
+class ShapeCache
+{
+public:
+  using ShapePtr = std::shared_ptr<ShapeType>;
+
+  ShapeCache() = default;
+  ~ShapeCache() = default;
+  ShapeCache(const ShapeCache&) = delete;
+  ShapeCache& operator=(const ShapeCache&) = delete;
+  ShapeCache(ShapeCache&&) = delete;
+  ShapeCache& operator=(ShapeCache&&) = delete;
+
+  /**
+   * @brief Get a shape from the cache
+   * @param key The key of the shape
+   * @return The shape, nullptr if it is not in the cache or it has been released
+   */
+  ShapePtr get(const ShapeCacheKey& key) const
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto it = state_->shapes.find(key);
+    if (it == state_->shapes.end())
+      return nullptr;
+
+    return it->second.lock();
+  }
+
+  /**
+   * @brief Add a shape to the cache
+   *
+   * If another thread added a shape with the same key which has not been released, the shape already in the cache is
+   * returned so all users end up sharing the same shape. Otherwise the returned shape shares the object of the
+   * provided shape and removes its entries from the cache when it is released, so it must be used instead of the
+   * provided shape. A shape returned by insert may be added again with another key.
+   *
+   * @param key The key of the shape
+   * @param shape The shape to add
+   * @return The shape stored in the cache
+   */
+  ShapePtr insert(const ShapeCacheKey& key, const ShapePtr& shape)
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto it = state_->shapes.find(key);
+    if (it != state_->shapes.end())
+    {
+      ShapePtr existing = it->second.lock();
+      if (existing != nullptr)
+        return existing;
+    }
+
+    ShapePtr cached_shape = shape;
+    const auto* deleter = std::get_deleter<ReleaseDeleter>(shape);
+    if (deleter == nullptr || deleter->state.owner_before(state_) || state_.owner_before(deleter->state))
+      cached_shape = ShapePtr(shape.get(), ReleaseDeleter{ state_, shape });
+
+    state_->shapes[key] = cached_shape;
+    return cached_shape;
+  }
+
+  /** @brief Remove all entries, this does not affect shapes which are in use */
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->shapes.clear();
+  }
+
+  /** @brief The number of entries in the cache */
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->shapes.size();
+  }
+
+private:
+  /** @brief The entries of the cache, shared with the deleters of the cached shapes */
+  struct State
+  {
+    std::mutex mutex;
+    std::unordered_map<ShapeCacheKey, std::weak_ptr<ShapeType>, ShapeCacheKeyHash> shapes;
+
+    /** @brief Remove the entries of shapes which have been released */
+    void prune()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (auto it = shapes.begin(); it != shapes.end();)
+      {
+        if (it->second.expired())
+          it = shapes.erase(it);
+        else
+          ++it;
+      }
+    }
+  };
+
+  /** @brief Releases the shape and removes its entries once the last user of a cached shape is destroyed */
+  struct ReleaseDeleter
+  {
+    std::weak_ptr<State> state;
+    ShapePtr shape;
+
+    void operator()(ShapeType* /*ptr*/)
+    {
+      shape.reset();
+      if (auto locked_state = state.lock())
+        locked_state->prune();
+    }
+  };
+
+  std::shared_ptr<State> state_{ std::make_shared<State>() };
+};
+
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_SHAPE_CACHE_H
@@ -0,0 +1,474 @@
+/**
+ * @file signed_distance_field.h
+ * @brief A voxelized signed distance field of a closed triangle mesh
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SIGNED_DISTANCE_FIELD_H
+#define TESSERACT_COLLISION_SIGNED_DISTANCE_FIELD_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+
+namespace tesseract_collision
+{
+/** @brief The default number of cells along the longest side of the mesh bounding box */
+static const int SDF_DEFAULT_CELL_COUNT = 100;
+
+/** @brief The default number of cells added around the mesh bounding box */
+static const int SDF_DEFAULT_PADDING = 2;
+
+/**
+ * @brief A dense voxelized signed distance field of a closed triangle mesh
+ *
+ * The distance to the mesh is stored at the nodes of a regular grid covering the bounding box of the mesh and looked up
+ * using trilinear interpolation, so a query costs the same regardless of the number of triangles. The distance is
+ * negative inside the mesh.
+ *
+ * The grid is computed when the field is created. The exact distance is computed for the nodes near each triangle and
+ * propagated to the other nodes by fast sweeping, and the sign is found by counting the triangles crossed by the grid
+ * lines along the x axis. The mesh should be closed, otherwise the sign is only reliable near the surface.
+ */
+class SignedDistanceField
+{
+public:
+  using Ptr = std::shared_ptr<SignedDistanceField>;
+  using ConstPtr = std::shared_ptr<const SignedDistanceField>;
+
+  /**
+   * @brief Create the signed distance field of a triangle mesh
+   * @param vertices The vertices of the mesh
+   * @param triangles The faces of the mesh stored as the number of vertices, which must be three, followed by the
+   * vertex indices
+   * @param cell_size The distance between the grid nodes, if not positive the longest side of the mesh bounding box is
+   * divided in to SDF_DEFAULT_CELL_COUNT cells
+   * @param padding The number of cells added around the mesh bounding box
+   */
+  SignedDistanceField(const tesseract_common::VectorVector3d& vertices,
+                      const Eigen::VectorXi& triangles,
+                      double cell_size = 0,
+                      int padding = SDF_DEFAULT_PADDING)
+  {
+    assert(!vertices.empty());
+    Eigen::Vector3d mesh_min = vertices.front();
+    Eigen::Vector3d mesh_max = vertices.front();
+    for (const auto& v : vertices)
+    {
+      mesh_min = mesh_min.cwiseMin(v);
+      mesh_max = mesh_max.cwiseMax(v);
+    }
+
+    if (cell_size <= 0)
+      cell_size = std::max((mesh_max - mesh_min).maxCoeff(), 1e-6) / static_cast<double>(SDF_DEFAULT_CELL_COUNT);
+
+    cell_size_ = cell_size;
+    origin_ = mesh_min - Eigen::Vector3d::Constant(static_cast<double>(padding) * cell_size_);
+    for (std::size_t a = 0; a < 3; ++a)
+    {
+      const double extent = mesh_max(static_cast<Eigen::Index>(a)) - mesh_min(static_cast<Eigen::Index>(a));
+      size_[a] = static_cast<int>(std::ceil(extent / cell_size_)) + (2 * padding) + 1;
+    }
+
+    compute(vertices, triangles);
+  }
+
+  /** @brief The distance between the grid nodes */
+  double getCellSize() const { return cell_size_; }
+
+  /** @brief The position of the first grid node */
+  const Eigen::Vector3d& getOrigin() const { return origin_; }
+
+  /** @brief The number of grid nodes along each axis */
+  const std::array<int, 3>& getSize() const { return size_; }
+
+  /** @brief The signed distance stored at a grid node */
+  double getNodeDistance(int i, int j, int k) const { return static_cast<double>(distances_[index(i, j, k)]); }
+
+  /**
+   * @brief Get the signed distance of a point using trilinear interpolation
+   *
+   * Outside of the grid the distance to the grid is added to the distance at the closest point of the grid, which
+   * approximates the distance to the mesh since the grid covers the mesh.
+   *
+   * The node distances are distances to triangles of the mesh, so they are exact near the surface and may be larger
+   * than the true distance far from it. Since the distance changes by at most as much as the point moves, the
+   * interpolated distance differs from the true distance by at most sqrt(3) times the cell size plus the error of the
+   * node distances. It is exact where the closest points of the whole cell are on the same face of the mesh, and the
+   * error is largest near edges and corners and where two parts of the mesh are about equally close.
+   *
+   * @param point The point in the frame of the mesh
+   * @param gradient If not null it is set to the normalized gradient of the distance, which points away from the mesh
+   * @return The signed distance
+   */
+  double getDistance(const Eigen::Vector3d& point, Eigen::Vector3d* gradient = nullptr) const
+  {
+    Eigen::Vector3d g = (point - origin_) / cell_size_;
+    Eigen::Vector3d clamped_g;
+    std::array<int, 3> cell{};
+    Eigen::Vector3d f;
+    for (std::size_t a = 0; a < 3; ++a)
+    {
+      const auto e = static_cast<Eigen::Index>(a);
+      clamped_g(e) = std::min(std::max(g(e), 0.0), static_cast<double>(size_[a] - 1));
+      cell[a] = std::min(static_cast<int>(clamped_g(e)), size_[a] - 2);
+      f(e) = clamped_g(e) - static_cast<double>(cell[a]);
+    }
+
+    // Trilinear interpolation of the eight nodes of the cell and its partial derivatives
+    const double d000 = getNodeDistance(cell[0], cell[1], cell[2]);
+    const double d100 = getNodeDistance(cell[0] + 1, cell[1], cell[2]);
+    const double d010 = getNodeDistance(cell[0], cell[1] + 1, cell[2]);
+    const double d110 = getNodeDistance(cell[0] + 1, cell[1] + 1, cell[2]);
+    const double d001 = getNodeDistance(cell[0], cell[1], cell[2] + 1);
+    const double d101 = getNodeDistance(cell[0] + 1, cell[1], cell[2] + 1);
+    const double d011 = getNodeDistance(cell[0], cell[1] + 1, cell[2] + 1);
+    const double d111 = getNodeDistance(cell[0] + 1, cell[1] + 1, cell[2] + 1);
+
+    const double d00 = d000 + f.x() * (d100 - d000);
+    const double d10 = d010 + f.x() * (d110 - d010);
+    const double d01 = d001 + f.x() * (d101 - d001);
+    const double d11 = d011 + f.x() * (d111 - d011);
+    const double d0 = d00 + f.y() * (d10 - d00);
+    const double d1 = d01 + f.y() * (d11 - d01);
+    double distance = d0 + f.z() * (d1 - d0);
+
+    const Eigen::Vector3d outside = (g - clamped_g) * cell_size_;
+    const double outside_distance = outside.norm();
+    distance += outside_distance;
+
+    if (gradient != nullptr)
+    {
+      if (outside_distance > 0)
+      {
+        *gradient = outside / outside_distance;
+      }
+      else
+      {
+        const double dx0 = (d100 - d000) + f.y() * ((d110 - d010) - (d100 - d000));
+        const double dx1 = (d101 - d001) + f.y() * ((d111 - d011) - (d101 - d001));
+        gradient->x() = dx0 + f.z() * (dx1 - dx0);
+        gradient->y() = (d10 - d00) + f.z() * ((d11 - d01) - (d10 - d00));
+        gradient->z() = d1 - d0;
+
+        const double norm = gradient->norm();
+        if (norm > 0)
+          *gradient /= norm;
+        else
+          *gradient = Eigen::Vector3d::UnitZ();
+      }
+    }
+
+    return distance;
+  }
+
+private:
+  double cell_size_{ 0 };
+  Eigen::Vector3d origin_{ Eigen::Vector3d::Zero() };
+  std::array<int, 3> size_{ { 0, 0, 0 } };
+  std::vector<float> distances_;
+
+  std::size_t index(int i, int j, int k) const
+  {
+    return static_cast<std::size_t>(i) +
+           (static_cast<std::size_t>(size_[0]) *
+            (static_cast<std::size_t>(j) + (static_cast<std::size_t>(size_[1]) * static_cast<std::size_t>(k))));
+  }
+
+  Eigen::Vector3d getNodePosition(int i, int j, int k) const
+  {
+    return origin_ + (cell_size_ * Eigen::Vector3d(i, j, k));
+  }
+
+  /** @brief The distance from a point to a triangle */
+  static double pointTriangleDistance(const Eigen::Vector3d& p,
+                                      const Eigen::Vector3d& a,
+                                      const Eigen::Vector3d& b,
+                                      const Eigen::Vector3d& c)
+  {
+    // Find the closest point by the Voronoi region of the triangle containing the point
+    const Eigen::Vector3d ab = b - a;
+    const Eigen::Vector3d ac = c - a;
+    const Eigen::Vector3d ap = p - a;
+    const double d1 = ab.dot(ap);
+    const double d2 = ac.dot(ap);
+    if (d1 <= 0 && d2 <= 0)
+      return ap.norm();
+
+    const Eigen::Vector3d bp = p - b;
+    const double d3 = ab.dot(bp);
+    const double d4 = ac.dot(bp);
+    if (d3 >= 0 && d4 <= d3)
+      return bp.norm();
+
+    const double vc = (d1 * d4) - (d3 * d2);
+    if (vc <= 0 && d1 >= 0 && d3 <= 0)
+      return (p - (a + (d1 / (d1 - d3)) * ab)).norm();
+
+    const Eigen::Vector3d cp = p - c;
+    const double d5 = ab.dot(cp);
+    const double d6 = ac.dot(cp);
+    if (d6 >= 0 && d5 <= d6)
+      return cp.norm();
+
+    const double vb = (d5 * d2) - (d1 * d6);
+    if (vb <= 0 && d2 >= 0 && d6 <= 0)
+      return (p - (a + (d2 / (d2 - d6)) * ac)).norm();
+
+    const double va = (d3 * d6) - (d5 * d4);
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+      return (p - (b + ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b))).norm();
+
+    const double denom = 1.0 / (va + vb + vc);
+    return (p - (a + (ab * (vb * denom)) + (ac * (vc * denom)))).norm();
+  }
+
+  /**
+   * @brief The orientation of the 2D triangle of the origin and two points, with consistent tie breaking so an edge
+   * shared by two triangles is only counted once
+   */
+  static int orientation(double x1, double y1, double x2, double y2, double& twice_signed_area)
+  {
+    twice_signed_area = (y1 * x2) - (x1 * y2);
+    if (twice_signed_area > 0)
+      return 1;
+    if (twice_signed_area < 0)
+      return -1;
+    if (y2 > y1)
+      return 1;
+    if (y2 < y1)
+      return -1;
+    if (x1 > x2)
+      return 1;
+    if (x1 < x2)
+      return -1;
+    return 0;
+  }
+
+  /** @brief Check if a 2D point is inside a 2D triangle and get its barycentric coordinates */
+  static bool pointInTriangle2D(const Eigen::Vector2d& p,
+                                Eigen::Vector2d a,
+                                Eigen::Vector2d b,
+                                Eigen::Vector2d c,
+                                Eigen::Vector3d& barycentric)
+  {
+    a -= p;
+    b -= p;
+    c -= p;
+    const int sign_a = orientation(b.x(), b.y(), c.x(), c.y(), barycentric.x());
+    if (sign_a == 0)
+      return false;
+
+    const int sign_b = orientation(c.x(), c.y(), a.x(), a.y(), barycentric.y());
+    if (sign_b != sign_a)
+      return false;
+
+    const int sign_c = orientation(a.x(), a.y(), b.x(), b.y(), barycentric.z());
+    if (sign_c != sign_a)
+      return false;
+
+    barycentric /= barycentric.sum();
+    return true;
+  }
+
+  /** @brief Update the distance of a node from the closest triangle of a neighboring node */
+  void checkNeighbor(const tesseract_common::VectorVector3d& vertices,
+                     const std::vector<std::array<int, 3>>& faces,
+                     std::vector<int>& closest,
+                     int i0,
+                     int j0,
+                     int k0,
+                     int i1,
+                     int j1,
+                     int k1)
+  {
+    const int face = closest[index(i1, j1, k1)];
+    const std::size_t idx = index(i0, j0, k0);
+    if (face < 0 || face == closest[idx])
+      return;
+
+    const std::array<int, 3>& f = faces[static_cast<std::size_t>(face)];
+    const double d = pointTriangleDistance(getNodePosition(i0, j0, k0),
+                                           vertices[static_cast<std::size_t>(f[0])],
+                                           vertices[static_cast<std::size_t>(f[1])],
+                                           vertices[static_cast<std::size_t>(f[2])]);
+    if (d < static_cast<double>(distances_[idx]))
+    {
+      distances_[idx] = static_cast<float>(d);
+      closest[idx] = face;
+    }
+  }
+
+  /** @brief Propagate the closest triangles through the grid in one of the eight sweep directions */
+  void sweep(const tesseract_common::VectorVector3d& vertices,
+             const std::vector<std::array<int, 3>>& faces,
+             std::vector<int>& closest,
+             int di,
+             int dj,
+             int dk)
+  {
+    const int i0 = (di > 0) ? 1 : size_[0] - 2;
+    const int i1 = (di > 0) ? size_[0] : -1;
+    const int j0 = (dj > 0) ? 1 : size_[1] - 2;
+    const int j1 = (dj > 0) ? size_[1] : -1;
+    const int k0 = (dk > 0) ? 1 : size_[2] - 2;
+    const int k1 = (dk > 0) ? size_[2] : -1;
+    for (int k = k0; k != k1; k += dk)
+    {
+      for (int j = j0; j != j1; j += dj)
+      {
+        for (int i = i0; i != i1; i += di)
+        {
+          checkNeighbor(vertices, faces, closest, i, j, k, i - di, j, k);
+          checkNeighbor(vertices, faces, closest, i, j, k, i, j - dj, k);
+          checkNeighbor(vertices, faces, closest, i, j, k, i - di, j - dj, k);
+          checkNeighbor(vertices, faces, closest, i, j, k, i, j, k - dk);
+          checkNeighbor(vertices, faces, closest, i, j, k, i - di, j, k - dk);
+          checkNeighbor(vertices, faces, closest, i, j, k, i, j - dj, k - dk);
+          checkNeighbor(vertices, faces, closest, i, j, k, i - di, j - dj, k - dk);
+        }
+      }
+    }
+  }
+
+  void compute(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& triangles)
+  {
+    std::vector<std::array<int, 3>> faces;
+    faces.reserve(static_cast<std::size_t>(triangles.size() / 4));
+    for (Eigen::Index t = 0; t + 3 < triangles.size(); t += 4)
+    {
+      assert(triangles[t] == 3);
+      faces.push_back({ triangles[t + 1], triangles[t + 2], triangles[t + 3] });
+    }
+
+    const std::size_t node_count = static_cast<std::size_t>(size_[0]) * static_cast<std::size_t>(size_[1]) *
+                                   static_cast<std::size_t>(size_[2]);
+    const auto upper_bound = static_cast<float>(cell_size_ * static_cast<double>(size_[0] + size_[1] + size_[2]));
+    distances_.assign(node_count, upper_bound);
+    std::vector<int> closest(node_count, -1);
+    std::vector<int> intersections(node_count, 0);
+
+    for (std::size_t t = 0; t < faces.size(); ++t)
+    {
+      const Eigen::Vector3d& a = vertices[static_cast<std::size_t>(faces[t][0])];
+      const Eigen::Vector3d& b = vertices[static_cast<std::size_t>(faces[t][1])];
+      const Eigen::Vector3d& c = vertices[static_cast<std::size_t>(faces[t][2])];
+      const Eigen::Vector3d ga = (a - origin_) / cell_size_;
+      const Eigen::Vector3d gb = (b - origin_) / cell_size_;
+      const Eigen::Vector3d gc = (c - origin_) / cell_size_;
+
+      // Exact distances for the nodes within one cell of the triangle
+      std::array<int, 3> lower{};
+      std::array<int, 3> upper{};
+      for (std::size_t ax = 0; ax < 3; ++ax)
+      {
+        const auto e = static_cast<Eigen::Index>(ax);
+        const double min_g = std::min({ ga(e), gb(e), gc(e) });
+        const double max_g = std::max({ ga(e), gb(e), gc(e) });
+        lower[ax] = std::max(static_cast<int>(std::floor(min_g)) - 1, 0);
+        upper[ax] = std::min(static_cast<int>(std::ceil(max_g)) + 1, size_[ax] - 1);
+      }
+
+      for (int k = lower[2]; k <= upper[2]; ++k)
+      {
+        for (int j = lower[1]; j <= upper[1]; ++j)
+        {
+          for (int i = lower[0]; i <= upper[0]; ++i)
+          {
+            const double d = pointTriangleDistance(getNodePosition(i, j, k), a, b, c);
+            const std::size_t idx = index(i, j, k);
+            if (d < static_cast<double>(distances_[idx]))
+            {
+              distances_[idx] = static_cast<float>(d);
+              closest[idx] = static_cast<int>(t);
+            }
+          }
+        }
+      }
+
+      // Count the crossings of the grid lines along the x axis, stored at the first node past the crossing
+      const int j_min = std::max(static_cast<int>(std::ceil(std::min({ ga.y(), gb.y(), gc.y() }))), 0);
+      const int j_max = std::min(static_cast<int>(std::floor(std::max({ ga.y(), gb.y(), gc.y() }))), size_[1] - 1);
+      const int k_min = std::max(static_cast<int>(std::ceil(std::min({ ga.z(), gb.z(), gc.z() }))), 0);
+      const int k_max = std::min(static_cast<int>(std::floor(std::max({ ga.z(), gb.z(), gc.z() }))), size_[2] - 1);
+      for (int k = k_min; k <= k_max; ++k)
+      {
+        for (int j = j_min; j <= j_max; ++j)
+        {
+          Eigen::Vector3d barycentric;
+          if (pointInTriangle2D(Eigen::Vector2d(j, k),
+                                Eigen::Vector2d(ga.y(), ga.z()),
+                                Eigen::Vector2d(gb.y(), gb.z()),
+                                Eigen::Vector2d(gc.y(), gc.z()),
+                                barycentric))
+          {
+            const double x = (barycentric.x() * ga.x()) + (barycentric.y() * gb.x()) + (barycentric.z() * gc.x());
+            const int i = std::max(static_cast<int>(std::ceil(x)), 0);
+            if (i < size_[0])
+              ++intersections[index(i, j, k)];
+          }
+        }
+      }
+    }
+
+    // Propagate the closest triangles to the nodes far from the mesh
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      sweep(vertices, faces, closest, +1, +1, +1);
+      sweep(vertices, faces, closest, -1, -1, -1);
+      sweep(vertices, faces, closest, +1, +1, -1);
+      sweep(vertices, faces, closest, -1, -1, +1);
+      sweep(vertices, faces, closest, +1, -1, +1);
+      sweep(vertices, faces, closest, -1, +1, -1);
+      sweep(vertices, faces, closest, +1, -1, -1);
+      sweep(vertices, faces, closest, -1, +1, +1);
+    }
+
+    // A node is inside the mesh if the grid line reaching it crossed the mesh an odd number of times
+    for (int k = 0; k < size_[2]; ++k)
+    {
+      for (int j = 0; j < size_[1]; ++j)
+      {
+        int count = 0;
+        for (int i = 0; i < size_[0]; ++i)
+        {
+          const std::size_t idx = index(i, j, k);
+          count += intersections[idx];
+          if (count % 2 == 1)
+            distances_[idx] = -distances_[idx];
+        }
+      }
+    }
+  }
+};
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_SIGNED_DISTANCE_FIELD_H
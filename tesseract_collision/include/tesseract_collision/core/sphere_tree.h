@@ -0,0 +1,813 @@
+/**
+ * @file sphere_tree.h
+ * @brief A hierarchical bounding sphere approximation of collision geometry
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_SPHERE_TREE_H
+#define TESSERACT_COLLISION_SPHERE_TREE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/types.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+/** @brief The default distance the spheres of a sphere tree may extend beyond the geometry */
+static const double DEFAULT_SPHERE_TREE_TOLERANCE = 0.02;
+
+/** @brief The maximum number of spheres of a leaf node, which are checked together by the packed distance kernels */
+static const int SPHERE_TREE_LEAF_SIZE = 16;
+
+/**
+ * @brief A hierarchical bounding sphere approximation of a collision shape
+ *
+ * The surface of the shape is covered by spheres which extend at most the tolerance beyond it, so the distance between
+ * two sphere trees is a lower bound of the distance between the shapes which underestimates it by at most the sum of
+ * the tolerances. This holds while the shapes are separated; a shape completely inside another has no overlapping
+ * spheres, which is detected using containsPoint.
+ *
+ * The spheres are stored as packed arrays of their x, y, z and radius and ordered so every node of the binary tree
+ * covers a contiguous range. Leaf nodes hold up to SPHERE_TREE_LEAF_SIZE spheres which are checked together.
+ *
+ * Spheres are represented exactly by a single sphere. Boxes and capsules are also covered by spheres, but are checked
+ * against the spheres of the other tree using their exact distance.
+ */
+class SphereTree
+{
+public:
+  using Ptr = std::shared_ptr<SphereTree>;
+  using ConstPtr = std::shared_ptr<const SphereTree>;
+
+  /** @brief The primitive shapes checked using their exact distance */
+  enum class PrimitiveType
+  {
+    NONE,   /**< The shape is only represented by its spheres */
+    BOX,    /**< A box centered at the primitive pose */
+    CAPSULE /**< A capsule along the z axis of the primitive pose */
+  };
+
+  /** @brief A node of the tree */
+  struct Node
+  {
+    Eigen::Vector3d center{ Eigen::Vector3d::Zero() }; /**< @brief The center of the bounding sphere */
+    double radius{ 0 };                                /**< @brief The radius of the bounding sphere */
+    int begin{ 0 };                                    /**< @brief The first sphere covered by the node */
+    int end{ 0 };                                      /**< @brief One past the last sphere covered by the node */
+    int left{ -1 };                                    /**< @brief The first child, -1 for a leaf */
+    int right{ -1 };                                   /**< @brief The second child, -1 for a leaf */
+  };
+
+  /**
+   * @brief Build the sphere tree of a shape, see createSphereTree
+   * @param shape The shape, which must be supported
+   * @param shape_pose The pose of the shape in the frame of the collision object
+   * @param tolerance The maximum distance the spheres extend beyond the shape
+   */
+  SphereTree(const CollisionShapeConstPtr& shape,
+             const Eigen::Isometry3d& shape_pose,
+             double tolerance = DEFAULT_SPHERE_TREE_TOLERANCE)
+    : tolerance_(tolerance), shape_type_(shape->getType()), shape_pose_inverse_(shape_pose.inverse())
+  {
+    tesseract_common::VectorVector4d spheres;
+    switch (shape->getType())
+    {
+      case tesseract_geometry::GeometryType::SPHERE:
+      {
+        const auto& sphere = static_cast<const tesseract_geometry::Sphere&>(*shape);
+        spheres.emplace_back(shape_pose.translation().x(),
+                             shape_pose.translation().y(),
+                             shape_pose.translation().z(),
+                             sphere.getRadius());
+        solid_size_.x() = sphere.getRadius();
+        break;
+      }
+      case tesseract_geometry::GeometryType::BOX:
+      {
+        const auto& box = static_cast<const tesseract_geometry::Box&>(*shape);
+        primitive_type_ = PrimitiveType::BOX;
+        primitive_pose_ = shape_pose;
+        primitive_size_ = 0.5 * Eigen::Vector3d(box.getX(), box.getY(), box.getZ());
+        solid_size_ = primitive_size_;
+
+        std::vector<Triangle> triangles;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          for (double sign : { -1.0, 1.0 })
+          {
+            // The four corners of the face normal to the axis
+            std::array<Eigen::Vector3d, 4> corners;
+            for (std::size_t c = 0; c < 4; ++c)
+            {
+              Eigen::Vector3d corner;
+              corner(axis) = sign;
+              corner((axis + 1) % 3) = (c == 1 || c == 2) ? 1.0 : -1.0;
+              corner((axis + 2) % 3) = (c >= 2) ? 1.0 : -1.0;
+              corners[c] = shape_pose * primitive_size_.cwiseProduct(corner);
+            }
+            triangles.push_back({ corners[0], corners[1], corners[2] });
+            triangles.push_back({ corners[0], corners[2], corners[3] });
+          }
+        }
+        addTriangleSpheres(triangles, 0.5 * tolerance_, 0, spheres);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CAPSULE:
+      {
+        const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(*shape);
+        primitive_type_ = PrimitiveType::CAPSULE;
+        primitive_pose_ = shape_pose;
+        primitive_size_ = Eigen::Vector3d(capsule.getRadius(), 0, 0.5 * capsule.getLength());
+        solid_size_ = primitive_size_;
+
+        // Spheres centered on the axis with spacing s and radius sqrt(r^2 + (s/2)^2) cover the capsule, including the
+        // caps
+        const double r = capsule.getRadius();
+        const double half_spacing = std::sqrt(((r + tolerance_) * (r + tolerance_)) - (r * r));
+        const auto count = std::max(static_cast<int>(std::ceil(capsule.getLength() / (2 * half_spacing))), 1);
+        const double spacing = capsule.getLength() / static_cast<double>(count);
+        const double radius = std::sqrt((r * r) + (0.25 * spacing * spacing));
+        for (int i = 0; i <= count; ++i)
+        {
+          const double z = (-0.5 * capsule.getLength()) + (static_cast<double>(i) * spacing);
+          const Eigen::Vector3d center = shape_pose * Eigen::Vector3d(0, 0, z);
+          spheres.emplace_back(center.x(), center.y(), center.z(), radius);
+        }
+        break;
+      }
+      case tesseract_geometry::GeometryType::CYLINDER:
+      {
+        const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(*shape);
+        const double gap = 0.5 * tolerance_;
+        solid_size_ = Eigen::Vector3d(cylinder.getRadius(), 0, 0.5 * cylinder.getLength());
+        std::vector<Eigen::Vector3d> top;
+        std::vector<Eigen::Vector3d> bottom;
+        for (const Eigen::Vector2d& p : getCircle(cylinder.getRadius(), gap))
+        {
+          top.push_back(shape_pose * Eigen::Vector3d(p.x(), p.y(), 0.5 * cylinder.getLength()));
+          bottom.push_back(shape_pose * Eigen::Vector3d(p.x(), p.y(), -0.5 * cylinder.getLength()));
+        }
+
+        std::vector<Triangle> triangles;
+        const Eigen::Vector3d top_center = shape_pose * Eigen::Vector3d(0, 0, 0.5 * cylinder.getLength());
+        const Eigen::Vector3d bottom_center = shape_pose * Eigen::Vector3d(0, 0, -0.5 * cylinder.getLength());
+        for (std::size_t i = 0; i < top.size(); ++i)
+        {
+          const std::size_t j = (i + 1) % top.size();
+          triangles.push_back({ top_center, top[i], top[j] });
+          triangles.push_back({ bottom_center, bottom[j], bottom[i] });
+          triangles.push_back({ top[i], bottom[i], bottom[j] });
+          triangles.push_back({ top[i], bottom[j], top[j] });
+        }
+        addTriangleSpheres(triangles, 0.5 * (tolerance_ - gap), gap, spheres);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CONE:
+      {
+        const auto& cone = static_cast<const tesseract_geometry::Cone&>(*shape);
+        const double gap = 0.5 * tolerance_;
+        solid_size_ = Eigen::Vector3d(cone.getRadius(), 0, 0.5 * cone.getLength());
+        const Eigen::Vector3d apex = shape_pose * Eigen::Vector3d(0, 0, 0.5 * cone.getLength());
+        const Eigen::Vector3d base_center = shape_pose * Eigen::Vector3d(0, 0, -0.5 * cone.getLength());
+        std::vector<Eigen::Vector3d> base;
+        for (const Eigen::Vector2d& p : getCircle(cone.getRadius(), gap))
+          base.push_back(shape_pose * Eigen::Vector3d(p.x(), p.y(), -0.5 * cone.getLength()));
+
+        std::vector<Triangle> triangles;
+        for (std::size_t i = 0; i < base.size(); ++i)
+        {
+          const std::size_t j = (i + 1) % base.size();
+          triangles.push_back({ apex, base[i], base[j] });
+          triangles.push_back({ base_center, base[j], base[i] });
+        }
+        addTriangleSpheres(triangles, 0.5 * (tolerance_ - gap), gap, spheres);
+        break;
+      }
+      case tesseract_geometry::GeometryType::MESH:
+      {
+        const auto& mesh = static_cast<const tesseract_geometry::Mesh&>(*shape);
+        addTriangleSpheres(
+            getTriangles(*mesh.getVertices(), *mesh.getTriangles(), shape_pose), 0.5 * tolerance_, 0, spheres);
+        break;
+      }
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      {
+        const auto& mesh = static_cast<const tesseract_geometry::ConvexMesh&>(*shape);
+        addTriangleSpheres(
+            getTriangles(*mesh.getVertices(), *mesh.getFaces(), shape_pose), 0.5 * tolerance_, 0, spheres);
+        addFacePlanes(*mesh.getVertices(), *mesh.getFaces());
+        break;
+      }
+      case tesseract_geometry::GeometryType::SDF_MESH:
+      {
+        const auto& mesh = static_cast<const tesseract_geometry::SDFMesh&>(*shape);
+        addTriangleSpheres(
+            getTriangles(*mesh.getVertices(), *mesh.getTriangles(), shape_pose), 0.5 * tolerance_, 0, spheres);
+        for (const Eigen::Vector3d& v : *mesh.getVertices())
+          solid_bounds_.extend(v);
+        break;
+      }
+      default:
+      {
+        throw std::runtime_error("SphereTree, unsupported geometry type: " +
+                                 std::to_string(static_cast<int>(shape->getType())));
+      }
+    }
+
+    if (spheres.empty())
+      throw std::runtime_error("SphereTree, the shape has no surface");
+
+    buildNodes(spheres);
+  }
+
+  /**
+   * @brief Check if a shape type is supported
+   *
+   * Planes are unbounded and octrees are not supported.
+   */
+  static bool isSupported(const tesseract_geometry::Geometry& shape)
+  {
+    switch (shape.getType())
+    {
+      case tesseract_geometry::GeometryType::SPHERE:
+      case tesseract_geometry::GeometryType::BOX:
+      case tesseract_geometry::GeometryType::CAPSULE:
+      case tesseract_geometry::GeometryType::CYLINDER:
+      case tesseract_geometry::GeometryType::CONE:
+      case tesseract_geometry::GeometryType::MESH:
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+      case tesseract_geometry::GeometryType::SDF_MESH:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /** @brief The maximum distance the spheres extend beyond the shape */
+  double getTolerance() const { return tolerance_; }
+
+  /** @brief The nodes of the tree, the first node is the root */
+  const std::vector<Node>& getNodes() const { return nodes_; }
+
+  /** @brief The spheres stored as packed columns of x, y, z and radius, in the frame of the collision object */
+  const Eigen::ArrayX4d& getSpheres() const { return spheres_; }
+
+  /** @brief The type of primitive checked using its exact distance */
+  PrimitiveType getPrimitiveType() const { return primitive_type_; }
+
+  /** @brief The pose of the primitive in the frame of the collision object */
+  const Eigen::Isometry3d& getPrimitivePose() const { return primitive_pose_; }
+
+  /** @brief The half extents of a box primitive, or the radius and half length stored in x and z of a capsule */
+  const Eigen::Vector3d& getPrimitiveSize() const { return primitive_size_; }
+
+  /** @brief The center of the first sphere, which is within its radius of the surface of the shape */
+  Eigen::Vector3d getSurfacePoint() const { return spheres_.row(0).head<3>().transpose().matrix(); }
+
+  /**
+   * @brief Check if a point may be inside the solid shape, allowing for the tolerance
+   *
+   * The check is exact for primitive shapes and convex meshes. Signed distance field meshes report every point inside
+   * their bounding box, and meshes are only a surface which contains no points.
+   *
+   * @param point The point in the frame of the collision object
+   */
+  bool containsPoint(const Eigen::Vector3d& point) const
+  {
+    const Eigen::Vector3d p = shape_pose_inverse_ * point;
+    switch (shape_type_)
+    {
+      case tesseract_geometry::GeometryType::SPHERE:
+        return p.norm() <= solid_size_.x() + tolerance_;
+      case tesseract_geometry::GeometryType::BOX:
+        return ((p.cwiseAbs() - solid_size_).array() <= tolerance_).all();
+      case tesseract_geometry::GeometryType::CAPSULE:
+        return (p - Eigen::Vector3d(0, 0, std::max(std::min(p.z(), solid_size_.z()), -solid_size_.z()))).norm() <=
+               solid_size_.x() + tolerance_;
+      case tesseract_geometry::GeometryType::CYLINDER:
+        return std::abs(p.z()) <= solid_size_.z() + tolerance_ && p.head<2>().norm() <= solid_size_.x() + tolerance_;
+      case tesseract_geometry::GeometryType::CONE:
+      {
+        // The radius shrinks linearly from the base at -z to the apex at +z
+        const double radius = solid_size_.x() * std::max(0.5 * (1.0 - (p.z() / solid_size_.z())), 0.0);
+        return std::abs(p.z()) <= solid_size_.z() + tolerance_ && p.head<2>().norm() <= radius + tolerance_;
+      }
+      case tesseract_geometry::GeometryType::CONVEX_MESH:
+        return ((solid_planes_.leftCols<3>() * p).array() - solid_planes_.col(3).array() <= tolerance_).all();
+      case tesseract_geometry::GeometryType::SDF_MESH:
+        return solid_bounds_.exteriorDistance(p) <= tolerance_;
+      default:
+        return false;
+    }
+  }
+
+private:
+  using Triangle = std::array<Eigen::Vector3d, 3>;
+
+  double tolerance_;
+  std::vector<Node> nodes_;
+  Eigen::ArrayX4d spheres_;
+  PrimitiveType primitive_type_{ PrimitiveType::NONE };
+  Eigen::Isometry3d primitive_pose_{ Eigen::Isometry3d::Identity() };
+  Eigen::Vector3d primitive_size_{ Eigen::Vector3d::Zero() };
+  tesseract_geometry::GeometryType shape_type_;
+  Eigen::Isometry3d shape_pose_inverse_;
+  Eigen::Vector3d solid_size_{ Eigen::Vector3d::Zero() };
+  Eigen::Matrix<double, Eigen::Dynamic, 4> solid_planes_;
+  Eigen::AlignedBox3d solid_bounds_;
+
+  /** @brief The vertices of a polygon inscribed in a circle which deviates at most the gap from the circle */
+  static std::vector<Eigen::Vector2d> getCircle(double radius, double gap)
+  {
+    const double ratio = std::min(gap / radius, 1.0);
+    const auto count = std::max(static_cast<int>(std::ceil(M_PI / std::acos(1.0 - ratio))), 8);
+    std::vector<Eigen::Vector2d> points;
+    points.reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i)
+    {
+      const double angle = (2.0 * M_PI * static_cast<double>(i)) / static_cast<double>(count);
+      points.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    return points;
+  }
+
+  /** @brief Get the triangles of polygon faces stored as the number of vertices followed by the vertex indices */
+  static std::vector<Triangle> getTriangles(const tesseract_common::VectorVector3d& vertices,
+                                            const Eigen::VectorXi& faces,
+                                            const Eigen::Isometry3d& shape_pose)
+  {
+    std::vector<Triangle> triangles;
+    for (Eigen::Index f = 0; f < faces.size(); f += faces[f] + 1)
+    {
+      const Eigen::Vector3d first = shape_pose * vertices[static_cast<std::size_t>(faces[f + 1])];
+      for (Eigen::Index v = 2; v < faces[f]; ++v)
+      {
+        triangles.push_back({ first,
+                              shape_pose * vertices[static_cast<std::size_t>(faces[f + v])],
+                              shape_pose * vertices[static_cast<std::size_t>(faces[f + v + 1])] });
+      }
+    }
+    return triangles;
+  }
+
+  /** @brief Store the outward normals and offsets of the faces of a convex mesh, in the frame of the shape */
+  void addFacePlanes(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& faces)
+  {
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    for (const Eigen::Vector3d& v : vertices)
+      centroid += v;
+    centroid /= static_cast<double>(std::max(vertices.size(), std::size_t(1)));
+
+    std::vector<Eigen::Vector4d> planes;
+    for (Eigen::Index f = 0; f < faces.size(); f += faces[f] + 1)
+    {
+      const Eigen::Vector3d& v0 = vertices[static_cast<std::size_t>(faces[f + 1])];
+      const Eigen::Vector3d& v1 = vertices[static_cast<std::size_t>(faces[f + 2])];
+      const Eigen::Vector3d& v2 = vertices[static_cast<std::size_t>(faces[f + 3])];
+      Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
+      if (normal.norm() < std::numeric_limits<double>::epsilon())
+        continue;
+
+      normal.normalize();
+      if (normal.dot(centroid - v0) > 0)
+        normal = -normal;
+      planes.emplace_back(normal.x(), normal.y(), normal.z(), normal.dot(v0));
+    }
+
+    solid_planes_.resize(static_cast<Eigen::Index>(planes.size()), 4);
+    for (std::size_t i = 0; i < planes.size(); ++i)
+      solid_planes_.row(static_cast<Eigen::Index>(i)) = planes[i].transpose();
+  }
+
+  /**
+   * @brief Cover triangles with spheres no larger than the radius, which are enlarged by the gap
+   *
+   * Nearby triangles are grouped while their vertices fit in a sphere of the radius, and triangles which are too large
+   * are subdivided.
+   */
+  static void addTriangleSpheres(std::vector<Triangle> triangles,
+                                 double radius,
+                                 double gap,
+                                 tesseract_common::VectorVector4d& spheres)
+  {
+    std::vector<std::pair<std::size_t, std::size_t>> ranges{ { 0, triangles.size() } };
+    while (!ranges.empty())
+    {
+      const std::pair<std::size_t, std::size_t> range = ranges.back();
+      ranges.pop_back();
+
+      Eigen::Vector3d min = triangles[range.first][0];
+      Eigen::Vector3d max = min;
+      for (std::size_t t = range.first; t < range.second; ++t)
+      {
+        for (const Eigen::Vector3d& v : triangles[t])
+        {
+          min = min.cwiseMin(v);
+          max = max.cwiseMax(v);
+        }
+      }
+
+      const Eigen::Vector3d center = 0.5 * (min + max);
+      double sphere_radius = 0;
+      for (std::size_t t = range.first; t < range.second; ++t)
+      {
+        for (const Eigen::Vector3d& v : triangles[t])
+          sphere_radius = std::max(sphere_radius, (v - center).norm());
+      }
+
+      if (sphere_radius <= radius)
+      {
+        spheres.emplace_back(center.x(), center.y(), center.z(), sphere_radius + gap);
+      }
+      else if (range.second - range.first == 1)
+      {
+        const Triangle& t = triangles[range.first];
+        const Eigen::Vector3d ab = 0.5 * (t[0] + t[1]);
+        const Eigen::Vector3d bc = 0.5 * (t[1] + t[2]);
+        const Eigen::Vector3d ca = 0.5 * (t[2] + t[0]);
+        addTriangleSpheres(
+            { { t[0], ab, ca }, { ab, t[1], bc }, { ca, bc, t[2] }, { ab, bc, ca } }, radius, gap, spheres);
+      }
+      else
+      {
+        // Split the triangles at the median of their centroids along the longest axis
+        Eigen::Index axis{ 0 };
+        (max - min).maxCoeff(&axis);
+        const std::size_t middle = (range.first + range.second) / 2;
+        std::nth_element(triangles.begin() + static_cast<long>(range.first),
+                         triangles.begin() + static_cast<long>(middle),
+                         triangles.begin() + static_cast<long>(range.second),
+                         [axis](const Triangle& a, const Triangle& b) {
+                           return (a[0](axis) + a[1](axis) + a[2](axis)) < (b[0](axis) + b[1](axis) + b[2](axis));
+                         });
+        ranges.emplace_back(range.first, middle);
+        ranges.emplace_back(middle, range.second);
+      }
+    }
+  }
+
+  /** @brief Build the binary tree over the spheres and store them in tree order */
+  void buildNodes(tesseract_common::VectorVector4d& spheres)
+  {
+    nodes_.reserve(((2 * spheres.size()) / static_cast<std::size_t>(SPHERE_TREE_LEAF_SIZE)) + 1);
+    buildNode(spheres, 0, static_cast<int>(spheres.size()));
+
+    spheres_.resize(static_cast<Eigen::Index>(spheres.size()), 4);
+    for (std::size_t i = 0; i < spheres.size(); ++i)
+      spheres_.row(static_cast<Eigen::Index>(i)) = spheres[i].transpose().array();
+  }
+
+  int buildNode(tesseract_common::VectorVector4d& spheres, int begin, int end)
+  {
+    const auto index = static_cast<int>(nodes_.size());
+    nodes_.emplace_back();
+
+    Eigen::Vector3d min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+    Eigen::Vector3d max = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+    for (int i = begin; i < end; ++i)
+    {
+      const Eigen::Vector4d& s = spheres[static_cast<std::size_t>(i)];
+      min = min.cwiseMin(s.head<3>() - Eigen::Vector3d::Constant(s(3)));
+      max = max.cwiseMax(s.head<3>() + Eigen::Vector3d::Constant(s(3)));
+    }
+
+    Node node;
+    node.center = 0.5 * (min + max);
+    node.begin = begin;
+    node.end = end;
+    for (int i = begin; i < end; ++i)
+    {
+      const Eigen::Vector4d& s = spheres[static_cast<std::size_t>(i)];
+      node.radius = std::max(node.radius, (s.head<3>() - node.center).norm() + s(3));
+    }
+
+    if (end - begin > SPHERE_TREE_LEAF_SIZE)
+    {
+      Eigen::Index axis{ 0 };
+      (max - min).maxCoeff(&axis);
+      const int middle = (begin + end) / 2;
+      std::nth_element(spheres.begin() + begin,
+                       spheres.begin() + middle,
+                       spheres.begin() + end,
+                       [axis](const Eigen::Vector4d& a, const Eigen::Vector4d& b) { return a(axis) < b(axis); });
+      node.left = buildNode(spheres, begin, middle);
+      node.right = buildNode(spheres, middle, end);
+    }
+
+    nodes_[static_cast<std::size_t>(index)] = node;
+    return index;
+  }
+};
+
+/** @brief The sphere trees of the shapes of a collision object, null for shapes which are not supported */
+using SphereTrees = std::vector<SphereTree::ConstPtr>;
+
+/**
+ * @brief Create the sphere trees of the shapes of a collision object
+ * @param shapes The shapes of the collision object
+ * @param shape_poses The poses of the shapes in the frame of the collision object
+ * @param tolerance The maximum distance the spheres extend beyond the shapes
+ * @return The sphere tree of each shape, null if the shape is not supported
+ */
+inline SphereTrees createSphereTrees(const CollisionShapesConst& shapes,
+                                     const tesseract_common::VectorIsometry3d& shape_poses,
+                                     double tolerance = DEFAULT_SPHERE_TREE_TOLERANCE)
+{
+  SphereTrees trees;
+  trees.reserve(shapes.size());
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    if (SphereTree::isSupported(*shapes[i]))
+      trees.push_back(std::make_shared<const SphereTree>(shapes[i], shape_poses[i], tolerance));
+    else
+      trees.push_back(nullptr);
+  }
+  return trees;
+}
+
+namespace detail
+{
+/** @brief The packed spheres of a leaf node transformed in to another frame */
+using SphereTreeLeafArray = Eigen::Array<double, Eigen::Dynamic, 1, Eigen::ColMajor, SPHERE_TREE_LEAF_SIZE, 1>;
+
+/** @brief Computes the distance between two sphere trees by traversing both trees */
+class SphereTreeDistance
+{
+public:
+  /**
+   * @param a The first sphere tree, which is only checked using its spheres
+   * @param b The second sphere tree, which is checked using its primitive if it has one
+   * @param tf The transform from the frame of a to the frame of b
+   * @param threshold The traversal stops once a distance not larger than the threshold is found, and does not descend
+   * in to nodes further apart than the threshold. If it is the lowest double the minimum distance is computed.
+   */
+  SphereTreeDistance(const SphereTree& a, const SphereTree& b, const Eigen::Isometry3d& tf, double threshold)
+    : a_(a), b_(b), tf_(tf), threshold_(threshold)
+  {
+    if (b_.getPrimitiveType() != SphereTree::PrimitiveType::NONE)
+      primitive_tf_ = b_.getPrimitivePose().inverse() * tf_;
+  }
+
+  double compute()
+  {
+    distance(0, 0);
+    return std::min(distance_, pruned_distance_);
+  }
+
+private:
+  const SphereTree& a_;
+  const SphereTree& b_;
+  Eigen::Isometry3d tf_;
+  Eigen::Isometry3d primitive_tf_{ Eigen::Isometry3d::Identity() };
+  double threshold_;
+  bool prune_{ threshold_ > std::numeric_limits<double>::lowest() };
+  double distance_{ std::numeric_limits<double>::max() };
+  double pruned_distance_{ std::numeric_limits<double>::max() };
+
+  double getLowerBound(int na, int nb) const
+  {
+    const SphereTree::Node& node_a = a_.getNodes()[static_cast<std::size_t>(na)];
+    const SphereTree::Node& node_b = b_.getNodes()[static_cast<std::size_t>(nb)];
+    return (tf_ * node_a.center - node_b.center).norm() - node_a.radius - node_b.radius;
+  }
+
+  void distance(int na, int nb)
+  {
+    if (distance_ <= threshold_)
+      return;
+
+    const double lower_bound = getLowerBound(na, nb);
+    if (lower_bound >= distance_)
+      return;
+
+    // Nodes further apart than the threshold only contribute their lower bound
+    if (prune_ && lower_bound > threshold_)
+    {
+      pruned_distance_ = std::min(pruned_distance_, lower_bound);
+      return;
+    }
+
+    const SphereTree::Node& node_a = a_.getNodes()[static_cast<std::size_t>(na)];
+    const SphereTree::Node& node_b = b_.getNodes()[static_cast<std::size_t>(nb)];
+    const bool primitive = (b_.getPrimitiveType() != SphereTree::PrimitiveType::NONE);
+    const bool leaf_a = (node_a.left < 0);
+    const bool leaf_b = (node_b.left < 0) || primitive;
+    if (leaf_a && leaf_b)
+    {
+      if (primitive)
+        distance_ = std::min(distance_, getPrimitiveDistance(node_a));
+      else
+        distance_ = std::min(distance_, getSphereDistance(node_a, node_b));
+      return;
+    }
+
+    // Descend the larger node and visit the closer child first
+    std::array<std::pair<int, int>, 2> children;
+    if (leaf_b || (!leaf_a && node_a.radius >= node_b.radius))
+      children = { std::make_pair(node_a.left, nb), std::make_pair(node_a.right, nb) };
+    else
+      children = { std::make_pair(na, node_b.left), std::make_pair(na, node_b.right) };
+
+    if (getLowerBound(children[1].first, children[1].second) < getLowerBound(children[0].first, children[0].second))
+      std::swap(children[0], children[1]);
+
+    distance(children[0].first, children[0].second);
+    distance(children[1].first, children[1].second);
+  }
+
+  /** @brief The distance between the spheres of two leaf nodes */
+  double getSphereDistance(const SphereTree::Node& node_a, const SphereTree::Node& node_b) const
+  {
+    const Eigen::ArrayX4d& spheres_a = a_.getSpheres();
+    const Eigen::ArrayX4d& spheres_b = b_.getSpheres();
+    const Eigen::Index begin = node_b.begin;
+    const Eigen::Index count = node_b.end - node_b.begin;
+    double d = std::numeric_limits<double>::max();
+    for (Eigen::Index i = node_a.begin; i < node_a.end; ++i)
+    {
+      const Eigen::Vector3d c = tf_ * Eigen::Vector3d(spheres_a(i, 0), spheres_a(i, 1), spheres_a(i, 2));
+      const double sphere_d = (((spheres_b.col(0).segment(begin, count) - c.x()).square() +
+                                (spheres_b.col(1).segment(begin, count) - c.y()).square() +
+                                (spheres_b.col(2).segment(begin, count) - c.z()).square())
+                                   .sqrt() -
+                               spheres_b.col(3).segment(begin, count))
+                                  .minCoeff();
+      d = std::min(d, sphere_d - spheres_a(i, 3));
+    }
+    return d;
+  }
+
+  /** @brief The distance between the spheres of a leaf node and the primitive of the second tree */
+  double getPrimitiveDistance(const SphereTree::Node& node_a) const
+  {
+    const Eigen::ArrayX4d& spheres_a = a_.getSpheres();
+    const Eigen::Index begin = node_a.begin;
+    const Eigen::Index count = node_a.end - node_a.begin;
+    const auto x = spheres_a.col(0).segment(begin, count);
+    const auto y = spheres_a.col(1).segment(begin, count);
+    const auto z = spheres_a.col(2).segment(begin, count);
+    const auto r = spheres_a.col(3).segment(begin, count);
+
+    // The sphere centers in the frame of the primitive
+    const Eigen::Matrix4d& m = primitive_tf_.matrix();
+    const SphereTreeLeafArray px = (m(0, 0) * x) + (m(0, 1) * y) + (m(0, 2) * z) + m(0, 3);
+    const SphereTreeLeafArray py = (m(1, 0) * x) + (m(1, 1) * y) + (m(1, 2) * z) + m(1, 3);
+    const SphereTreeLeafArray pz = (m(2, 0) * x) + (m(2, 1) * y) + (m(2, 2) * z) + m(2, 3);
+
+    const Eigen::Vector3d& size = b_.getPrimitiveSize();
+    if (b_.getPrimitiveType() == SphereTree::PrimitiveType::BOX)
+    {
+      const SphereTreeLeafArray qx = px.abs() - size.x();
+      const SphereTreeLeafArray qy = py.abs() - size.y();
+      const SphereTreeLeafArray qz = pz.abs() - size.z();
+      return ((qx.max(0.0).square() + qy.max(0.0).square() + qz.max(0.0).square()).sqrt() +
+              qx.max(qy).max(qz).min(0.0) - r)
+          .minCoeff();
+    }
+
+    return ((px.square() + py.square() + (pz - pz.max(-size.z()).min(size.z())).square()).sqrt() - size.x() - r)
+        .minCoeff();
+  }
+};
+}  // namespace detail
+
+/**
+ * @brief Compute the distance between two sphere trees
+ *
+ * This is a lower bound of the distance between the shapes of the trees while they are separated.
+ *
+ * @param a The first sphere tree
+ * @param tf_a The world transform of the collision object of the first tree
+ * @param b The second sphere tree
+ * @param tf_b The world transform of the collision object of the second tree
+ * @param threshold The search stops once a distance not larger than the threshold is found, and nodes further apart
+ * than the threshold are not searched, so a returned distance larger than the threshold is a lower bound. By default
+ * the minimum distance is computed.
+ * @return The distance between the spheres of the trees
+ */
+inline double computeSphereTreeDistance(const SphereTree& a,
+                                        const Eigen::Isometry3d& tf_a,
+                                        const SphereTree& b,
+                                        const Eigen::Isometry3d& tf_b,
+                                        double threshold = std::numeric_limits<double>::lowest())
+{
+  // Only the second tree is checked using its primitive
+  if (a.getPrimitiveType() != SphereTree::PrimitiveType::NONE &&
+      b.getPrimitiveType() == SphereTree::PrimitiveType::NONE)
+    return detail::SphereTreeDistance(b, a, tf_a.inverse() * tf_b, threshold).compute();
+
+  return detail::SphereTreeDistance(a, b, tf_b.inverse() * tf_a, threshold).compute();
+}
+
+/**
+ * @brief Check if the sphere trees of two collision objects are further apart than the contact distance
+ *
+ * If so the narrowphase can be skipped, since the sphere trees underestimate the distance. The check is not performed
+ * if either collision object has no sphere trees or a shape which is not supported.
+ *
+ * Separated sphere trees only separate the shapes if neither is inside the other. Since the spheres of a tree do not
+ * touch the spheres of the other tree, the first sphere of a tree is either completely inside or outside the other
+ * shape, so checking whether its center is inside the other shape detects a contained shape.
+ *
+ * @param cdata The contact test data
+ * @param cow1 The first collision object, which provides the name and sphere trees
+ * @param shape1 The shape index of the first collision object, -1 to check all shapes
+ * @param tf1 The world transform of the first collision object
+ * @param cow2 The second collision object, which provides the name and sphere trees
+ * @param shape2 The shape index of the second collision object, -1 to check all shapes
+ * @param tf2 The world transform of the second collision object
+ * @param contact_distance The contact distance used by the narrowphase
+ * @param distance Set to the distance between the sphere trees if they are separated
+ * @return True if the sphere trees are further apart than the contact distance
+ */
+template <typename CollisionObjectWrapperType>
+inline bool isSphereTreeSeparated(const ContactTestData& cdata,
+                                  const CollisionObjectWrapperType& cow1,
+                                  int shape1,
+                                  const Eigen::Isometry3d& tf1,
+                                  const CollisionObjectWrapperType& cow2,
+                                  int shape2,
+                                  const Eigen::Isometry3d& tf2,
+                                  double contact_distance,
+                                  double& distance)
+{
+  const SphereTrees& trees1 = cow1.getSphereTrees();
+  const SphereTrees& trees2 = cow2.getSphereTrees();
+  if (trees1.empty() || trees2.empty())
+    return false;
+
+  // Overlapping sphere trees do not bound the penetration depth, so only separated trees can be culled
+  const double bound_distance =
+      std::max(detail::getContactDistanceBound(cdata, cow1.getName(), cow2.getName(), contact_distance), 0.0);
+  const std::size_t begin1 = (shape1 < 0) ? 0 : static_cast<std::size_t>(shape1);
+  const std::size_t end1 = (shape1 < 0) ? trees1.size() : begin1 + 1;
+  const std::size_t begin2 = (shape2 < 0) ? 0 : static_cast<std::size_t>(shape2);
+  const std::size_t end2 = (shape2 < 0) ? trees2.size() : begin2 + 1;
+  assert(end1 <= trees1.size() && end2 <= trees2.size());
+
+  double min_distance = std::numeric_limits<double>::max();
+  for (std::size_t i = begin1; i < end1; ++i)
+  {
+    for (std::size_t j = begin2; j < end2; ++j)
+    {
+      if (trees1[i] == nullptr || trees2[j] == nullptr)
+        return false;
+
+      min_distance =
+          std::min(min_distance, computeSphereTreeDistance(*trees1[i], tf1, *trees2[j], tf2, bound_distance));
+      if (min_distance <= bound_distance)
+        return false;
+    }
+  }
+
+  // A shape inside the other has no overlapping spheres
+  const Eigen::Isometry3d tf12 = tf1.inverse() * tf2;
+  const Eigen::Isometry3d tf21 = tf12.inverse();
+  for (std::size_t i = begin1; i < end1; ++i)
+  {
+    for (std::size_t j = begin2; j < end2; ++j)
+    {
+      if (trees1[i]->containsPoint(tf12 * trees2[j]->getSurfacePoint()) ||
+          trees2[j]->containsPoint(tf21 * trees1[i]->getSurfacePoint()))
+        return false;
+    }
+  }
+
+  distance = min_distance;
+  return true;
+}
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_SPHERE_TREE_H
@@ -33,7 +33,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <vector>
 #include <memory>
 #include <map>
+#include <algorithm>
 #include <array>
+#include <cassert>
+#include <cstdint>
+#include <string>
 #include <unordered_map>
 #include <functional>
 #include <boost/bind.hpp>
@@ -96,9 +100,16 @@ struct ContactResult
   std::array<int, 2> type_id;
   /** @brief The two links that are in contact */
   std::array<std::string, 2> link_names;
+  /** @brief The interned ids of the two links that are in contact, see ObjectIdRegistry */
+  std::array<int, 2> link_ids;
   /** @brief The two shapes that are in contact. Each link can be made up of multiple shapes */
   std::array<int, 2> shape_id;
-  /** @brief Some shapes like octomap and mesh have subshape (boxes and triangles) */
+  /**
+   * @brief Some shapes like mesh have subshape (triangles)
+   *
+   * The Bullet contact managers do not store the leafs of octomaps as separate shapes, so octomap contacts report the
+   * index of the octomap shape instead of a leaf.
+   */
   std::array<int, 2> subshape_id;
   /** @brief The nearest point on both links in world coordinates */
   std::array<Eigen::Vector3d, 2> nearest_points;
@@ -143,6 +154,8 @@ struct ContactResult
     transform[1] = Eigen::Isometry3d::Identity();
     link_names[0] = "";
     link_names[1] = "";
+    link_ids[0] = -1;
+    link_ids[1] = -1;
     shape_id[0] = -1;
     shape_id[1] = -1;
     subshape_id[0] = -1;
@@ -169,6 +182,486 @@ using ContactResultMap = tesseract_common::AlignedMap<std::pair<std::string, std
 %tesseract_aligned_map_of_aligned_vector_using(ContactResultMap, %arg(std::pair<std::string,std::string>), tesseract_collision::ContactResult);
 // clang-format on
 #endif
+
+#ifndef SWIG
+/**
+ * @brief An append only table which interns collision object names as integer ids
+ *
+ * The ids are dense starting at zero and never change for the lifetime of the registry, so they may be stored on the
+ * collision objects and used in place of the names when bookkeeping contact results.
+ */
+class ObjectIdRegistry
+{
+public:
+  using Ptr = std::shared_ptr<ObjectIdRegistry>;
+  using ConstPtr = std::shared_ptr<const ObjectIdRegistry>;
+
+  /**
+   * @brief Get the id of a name, adding it to the registry if it does not exist
+   * @param name The collision object name
+   * @return The id of the name
+   */
+  int intern(const std::string& name)
+  {
+    auto it = name_to_id_.find(name);
+    if (it != name_to_id_.end())
+      return it->second;
+
+    const auto id = static_cast<int>(id_to_name_.size());
+    name_to_id_[name] = id;
+    id_to_name_.push_back(name);
+    return id;
+  }
+
+  /**
+   * @brief Get the id of a name
+   * @param name The collision object name
+   * @return The id of the name, -1 if it has not been interned
+   */
+  int getId(const std::string& name) const
+  {
+    auto it = name_to_id_.find(name);
+    return (it != name_to_id_.end()) ? it->second : -1;
+  }
+
+  /**
+   * @brief Get the name associated with an id
+   * @param id The id returned by intern
+   * @return The collision object name
+   */
+  const std::string& getName(int id) const { return id_to_name_.at(static_cast<std::size_t>(id)); }
+
+  /** @brief Get the number of interned names */
+  std::size_t size() const { return id_to_name_.size(); }
+
+private:
+  std::unordered_map<std::string, int> name_to_id_;
+  std::vector<std::string> id_to_name_;
+};
+
+/** @brief A pair of interned object ids packed in a single integer, see getObjectPairId */
+using ObjectPairId = std::uint64_t;
+
+/**
+ * @brief Get a key for two interned object ids, the order of the ids does not matter
+ * @param id1 First collision object id
+ * @param id2 Second collision object id
+ * @return The collision pair id
+ */
+inline ObjectPairId getObjectPairId(int id1, int id2)
+{
+  const auto a = static_cast<std::uint32_t>(std::min(id1, id2));
+  const auto b = static_cast<std::uint32_t>(std::max(id1, id2));
+  return (static_cast<ObjectPairId>(a) << 32U) | static_cast<ObjectPairId>(b);
+}
+
+/** @brief Hash an object pair id for the open addressing contact result containers */
+inline std::size_t hashObjectPairId(ObjectPairId key)
+{
+  // splitmix64 finalizer
+  key ^= key >> 30U;
+  key *= 0xbf58476d1ce4e5b9ULL;
+  key ^= key >> 27U;
+  key *= 0x94d049bb133111ebULL;
+  key ^= key >> 31U;
+  return static_cast<std::size_t>(key);
+}
+
+/**
+ * @brief The open addressing index shared by the containers keyed by interned object pair ids
+ *
+ * It maps object pair ids to the positions of the entries in the dense array of the container, which stores the keys.
+ * The key function returns the object pair id of the entry at a position.
+ */
+class ObjectPairIdIndex
+{
+public:
+  /** @brief Remove all positions, the allocated memory is kept */
+  void clear() { std::fill(slots_.begin(), slots_.end(), -1); }
+
+  /**
+   * @brief Find the position of an entry
+   * @param key The object pair id
+   * @param key_fn Returns the object pair id of the entry at a position
+   * @return The position of the entry, -1 if not found
+   */
+  template <typename KeyFn>
+  long find(ObjectPairId key, const KeyFn& key_fn) const
+  {
+    if (slots_.empty())
+      return -1;
+
+    const std::size_t mask = slots_.size() - 1;
+    for (std::size_t i = hashObjectPairId(key) & mask;; i = (i + 1) & mask)
+    {
+      const long index = slots_[i];
+      if (index < 0)
+        return -1;
+
+      if (key_fn(static_cast<std::size_t>(index)) == key)
+        return index;
+    }
+  }
+
+  /**
+   * @brief Add the position of a new entry, the key must not have been added already
+   * @param key The object pair id
+   * @param index The position of the entry, which must be the number of entries before it is added
+   * @param key_fn Returns the object pair id of the entry at a position, used if the index grows
+   */
+  template <typename KeyFn>
+  void insert(ObjectPairId key, long index, const KeyFn& key_fn)
+  {
+    // Keep the load factor at or below one half
+    if (2 * static_cast<std::size_t>(index + 1) > slots_.size())
+      rehash(std::max<std::size_t>(16, 2 * slots_.size()), static_cast<std::size_t>(index), key_fn);
+
+    slots_[findFreeSlot(key)] = index;
+  }
+
+private:
+  std::vector<long> slots_;
+
+  std::size_t findFreeSlot(ObjectPairId key) const
+  {
+    const std::size_t mask = slots_.size() - 1;
+    std::size_t i = hashObjectPairId(key) & mask;
+    while (slots_[i] >= 0)
+      i = (i + 1) & mask;
+
+    return i;
+  }
+
+  template <typename KeyFn>
+  void rehash(std::size_t num_slots, std::size_t size, const KeyFn& key_fn)
+  {
+    slots_.assign(num_slots, -1);
+    for (std::size_t j = 0; j < size; ++j)
+      slots_[findFreeSlot(key_fn(j))] = static_cast<long>(j);
+  }
+};
+
+/**
+ * @brief A contact result container keyed by interned object pair ids
+ *
+ * This is an open addressing hash table where the entries are stored densely in insertion order, so iteration is a
+ * linear scan and clear keeps the allocated memory, including the contact result vectors of the entries. Entries
+ * cannot be erased individually. The object names are only
+ * resolved when requested using the registry of the contact manager which populated it.
+ */
+class ContactResultIdMap
+{
+public:
+  using key_type = ObjectPairId;
+  using mapped_type = ContactResultVector;
+  using value_type = std::pair<ObjectPairId, ContactResultVector>;
+  using container_type = std::vector<value_type>;
+  using iterator = container_type::iterator;
+  using const_iterator = container_type::const_iterator;
+
+  ContactResultIdMap() = default;
+  ContactResultIdMap(ObjectIdRegistry::ConstPtr registry) : registry_(std::move(registry)) {}
+
+  iterator begin() { return data_.begin(); }
+  iterator end() { return data_.begin() + static_cast<long>(size_); }
+  const_iterator begin() const { return data_.begin(); }
+  const_iterator end() const { return data_.begin() + static_cast<long>(size_); }
+  const_iterator cbegin() const { return data_.cbegin(); }
+  const_iterator cend() const { return data_.cbegin() + static_cast<long>(size_); }
+
+  std::size_t size() const { return size_; }
+  bool empty() const { return (size_ == 0); }
+
+  /**
+   * @brief Remove all entries, the allocated memory is kept
+   *
+   * The contact result vectors of the removed entries are kept with their capacity and reused by entries added later,
+   * so repeatedly clearing and populating the container does not allocate once it has grown to the number of pairs.
+   */
+  void clear()
+  {
+    for (std::size_t i = 0; i < size_; ++i)
+      data_[i].second.clear();
+
+    size_ = 0;
+    index_.clear();
+  }
+
+  iterator find(ObjectPairId key)
+  {
+    const long index = findIndex(key);
+    return (index < 0) ? end() : data_.begin() + index;
+  }
+
+  const_iterator find(ObjectPairId key) const
+  {
+    const long index = findIndex(key);
+    return (index < 0) ? end() : data_.begin() + index;
+  }
+
+  /**
+   * @brief Insert an entry if the key does not exist
+   * @param value The key and contact results
+   * @return The iterator to the entry and true if it was inserted
+   */
+  std::pair<iterator, bool> insert(value_type value)
+  {
+    const long index = findIndex(value.first);
+    if (index >= 0)
+      return std::make_pair(data_.begin() + index, false);
+
+    const long new_index = insertNew(value.first);
+    data_[static_cast<std::size_t>(new_index)].second = std::move(value.second);
+    return std::make_pair(data_.begin() + new_index, true);
+  }
+
+  ContactResultVector& operator[](ObjectPairId key)
+  {
+    const long index = findIndex(key);
+    if (index >= 0)
+      return data_[static_cast<std::size_t>(index)].second;
+
+    return data_[static_cast<std::size_t>(insertNew(key))].second;
+  }
+
+  /** @brief Set the registry used to resolve the object names */
+  void setObjectIdRegistry(ObjectIdRegistry::ConstPtr registry) { registry_ = std::move(registry); }
+
+  /** @brief Get the registry used to resolve the object names */
+  const ObjectIdRegistry::ConstPtr& getObjectIdRegistry() const { return registry_; }
+
+  /**
+   * @brief Get the ordered pair of object names for a key
+   * @param key The object pair id
+   * @return The object names ordered the same way as getObjectPairKey
+   */
+  std::pair<std::string, std::string> getObjectNames(ObjectPairId key) const
+  {
+    assert(registry_ != nullptr);
+    const std::string& name1 = registry_->getName(static_cast<int>(key >> 32U));
+    const std::string& name2 = registry_->getName(static_cast<int>(key & 0xFFFFFFFFU));
+    return name1 < name2 ? std::make_pair(name1, name2) : std::make_pair(name2, name1);
+  }
+
+  /**
+   * @brief Convert to a name keyed contact result map, the link names of the contact results are resolved
+   * @param results The name keyed results to populate, existing entries are kept
+   */
+  void toContactResultMap(ContactResultMap& results) const
+  {
+    assert(registry_ != nullptr);
+    for (const auto& entry : *this)
+    {
+      ContactResultVector& rv = results[getObjectNames(entry.first)];
+      rv.reserve(rv.size() + entry.second.size());
+      for (const auto& r : entry.second)
+      {
+        rv.push_back(r);
+        ContactResult& cr = rv.back();
+        if (cr.link_ids[0] >= 0)
+          cr.link_names[0] = registry_->getName(cr.link_ids[0]);
+
+        if (cr.link_ids[1] >= 0)
+          cr.link_names[1] = registry_->getName(cr.link_ids[1]);
+      }
+    }
+  }
+
+private:
+  container_type data_;
+  std::size_t size_{ 0 };
+  ObjectPairIdIndex index_;
+  ObjectIdRegistry::ConstPtr registry_;
+
+  long findIndex(ObjectPairId key) const
+  {
+    return index_.find(key, [this](std::size_t i) { return data_[i].first; });
+  }
+
+  /** @brief Add an entry with an empty contact result vector, reusing a removed entry if available */
+  long insertNew(ObjectPairId key)
+  {
+    const auto index = static_cast<long>(size_);
+    index_.insert(key, index, [this](std::size_t i) { return data_[i].first; });
+    if (size_ < data_.size())
+      data_[size_].first = key;
+    else
+      data_.emplace_back(key, ContactResultVector());
+
+    ++size_;
+    return index;
+  }
+};
+
+/**
+ * @brief The result of a distance only contact test
+ *
+ * This is a plain data type so the results of a distance query are stored in a contiguous array without an allocation
+ * per contact. The nearest points and normal are only populated if requested, see
+ * ContactRequest::calculate_nearest_points, otherwise they are zero.
+ */
+struct ContactDistanceResult
+{
+  /** @brief The signed distance between the two objects, negative if they are in collision */
+  double distance;
+  /** @brief The interned ids of the two objects, see ObjectIdRegistry */
+  std::array<int, 2> link_ids;
+  /** @brief The nearest point on each object in world coordinates */
+  std::array<std::array<double, 3>, 2> nearest_points;
+  /** @brief The normal in world coordinates pointing from link_ids[0] to link_ids[1] */
+  std::array<double, 3> normal;
+
+  /** @brief Get the nearest point on an object as an Eigen vector */
+  Eigen::Map<const Eigen::Vector3d> getNearestPoint(std::size_t i) const
+  {
+    return Eigen::Map<const Eigen::Vector3d>(nearest_points[i].data());
+  }
+
+  /** @brief Get the normal as an Eigen vector */
+  Eigen::Map<const Eigen::Vector3d> getNormal() const { return Eigen::Map<const Eigen::Vector3d>(normal.data()); }
+};
+
+/**
+ * @brief Convert a contact result to a distance only contact result
+ * @param contact The contact result, the link ids must be set
+ * @param calculate_nearest_points If false the nearest points and normal are left zero
+ * @return The distance only contact result
+ */
+inline ContactDistanceResult toContactDistanceResult(const ContactResult& contact, bool calculate_nearest_points = true)
+{
+  ContactDistanceResult result{};
+  result.distance = contact.distance;
+  result.link_ids = contact.link_ids;
+  if (calculate_nearest_points)
+  {
+    Eigen::Map<Eigen::Vector3d>(result.nearest_points[0].data()) = contact.nearest_points[0];
+    Eigen::Map<Eigen::Vector3d>(result.nearest_points[1].data()) = contact.nearest_points[1];
+    Eigen::Map<Eigen::Vector3d>(result.normal.data()) = contact.normal;
+  }
+  return result;
+}
+
+/**
+ * @brief A container of distance only contact results storing the closest contact for each pair of objects
+ *
+ * The results are stored densely in the order the pairs were found and are looked up by object pair id using the same
+ * ObjectPairIdIndex as ContactResultIdMap, so clear keeps the allocated memory.
+ */
+class ContactDistanceResultMap
+{
+public:
+  using value_type = ContactDistanceResult;
+  using container_type = std::vector<ContactDistanceResult>;
+  using iterator = container_type::iterator;
+  using const_iterator = container_type::const_iterator;
+
+  ContactDistanceResultMap() = default;
+  ContactDistanceResultMap(ObjectIdRegistry::ConstPtr registry) : registry_(std::move(registry)) {}
+
+  iterator begin() { return data_.begin(); }
+  iterator end() { return data_.end(); }
+  const_iterator begin() const { return data_.begin(); }
+  const_iterator end() const { return data_.end(); }
+  const_iterator cbegin() const { return data_.cbegin(); }
+  const_iterator cend() const { return data_.cend(); }
+
+  std::size_t size() const { return data_.size(); }
+  bool empty() const { return data_.empty(); }
+
+  /** @brief Remove all entries, the allocated memory is kept */
+  void clear()
+  {
+    data_.clear();
+    index_.clear();
+  }
+
+  /** @brief Get the contiguous array of results */
+  const container_type& getResults() const { return data_; }
+
+  iterator find(ObjectPairId key)
+  {
+    const long index = findIndex(key);
+    return (index < 0) ? data_.end() : data_.begin() + index;
+  }
+
+  const_iterator find(ObjectPairId key) const
+  {
+    const long index = findIndex(key);
+    return (index < 0) ? data_.end() : data_.begin() + index;
+  }
+
+  /**
+   * @brief Insert a result if there is no result for its pair of objects
+   * @param value The contact result
+   * @return The iterator to the result of the pair of objects and true if it was inserted
+   */
+  std::pair<iterator, bool> insert(const ContactDistanceResult& value)
+  {
+    const ObjectPairId key = getKey(value);
+    const long index = findIndex(key);
+    if (index >= 0)
+      return std::make_pair(data_.begin() + index, false);
+
+    return std::make_pair(data_.begin() + insertNew(key, value), true);
+  }
+
+  /** @brief Set the registry used to resolve the object names */
+  void setObjectIdRegistry(ObjectIdRegistry::ConstPtr registry) { registry_ = std::move(registry); }
+
+  /** @brief Get the registry used to resolve the object names */
+  const ObjectIdRegistry::ConstPtr& getObjectIdRegistry() const { return registry_; }
+
+  /**
+   * @brief Get the object names of a result
+   * @param result The contact result
+   * @return The object names in the same order as the link ids of the result
+   */
+  std::pair<std::string, std::string> getObjectNames(const ContactDistanceResult& result) const
+  {
+    assert(registry_ != nullptr);
+    return std::make_pair(registry_->getName(result.link_ids[0]), registry_->getName(result.link_ids[1]));
+  }
+
+private:
+  container_type data_;
+  ObjectPairIdIndex index_;
+  ObjectIdRegistry::ConstPtr registry_;
+
+  static ObjectPairId getKey(const ContactDistanceResult& value)
+  {
+    return getObjectPairId(value.link_ids[0], value.link_ids[1]);
+  }
+
+  long findIndex(ObjectPairId key) const
+  {
+    return index_.find(key, [this](std::size_t i) { return getKey(data_[i]); });
+  }
+
+  long insertNew(ObjectPairId key, const ContactDistanceResult& value)
+  {
+    const auto index = static_cast<long>(data_.size());
+    index_.insert(key, index, [this](std::size_t i) { return getKey(data_[i]); });
+    data_.push_back(value);
+    return index;
+  }
+};
+
+/**
+ * @brief An ordered list of collision objects whose transforms are set together from a contiguous array of poses
+ *
+ * It is created once by the contact manager, which resolves the names so setting the transforms does not require any
+ * name lookups. The ids are only valid for the contact manager which created the handle and its clones.
+ */
+struct CollisionObjectsHandle
+{
+  /** @brief The names of the collision objects, in the order of the poses */
+  std::vector<std::string> names;
+
+  /** @brief The interned ids of the collision objects, -1 for unknown names, empty if the manager does not use them */
+  std::vector<int> ids;
+};
+#endif  // SWIG
+
 /**
  * @brief Should return true if contact results are valid, otherwise false.
  *
@@ -192,7 +685,19 @@ struct ContactRequest
    * reach this limit */
   long contact_limit = 0;
 
-  /** @brief This provides a user defined function approve/reject contact results */
+  /** @brief This is used if the ContactTestType is set to LIMITED, where at most this number of contacts are stored
+   * for each pair of objects keeping the closest. If less than one the number of contacts per pair is not limited */
+  long pair_contact_limit = 0;
+
+  /** @brief This is used by the distance only contact test, it enables populating the nearest points and normal of
+   * the results. If false only the distance is calculated */
+  bool calculate_nearest_points = true;
+
+  /**
+   * @brief This provides a user defined function approve/reject contact results
+   *
+   * Contact managers which process pairs in parallel call it from multiple threads, so it must be thread-safe.
+   */
   IsContactResultValidFn is_valid = nullptr;
 
   ContactRequest(ContactTestType type = ContactTestType::ALL) : type(type) {}
@@ -225,6 +730,9 @@ inline std::size_t flattenResults(ContactResultMap&& m, ContactResultVector& v)
 }
 
 #ifndef SWIG
+class ContactPairCache;
+struct ContactPairCacheEntry;
+
 /**
  * @brief This data is intended only to be used internal to the collision checkers as a container and should not
  *        be externally used by other libraries or packages.
@@ -247,6 +755,32 @@ struct ContactTestData
   {
   }
 
+  ContactTestData(const std::vector<std::string>& active,
+                  CollisionMarginData collision_margin_data,
+                  IsContactAllowedFn fn,
+                  ContactRequest req,
+                  ContactResultIdMap& res_ids)
+    : active(&active)
+    , collision_margin_data(std::move(collision_margin_data))
+    , fn(std::move(fn))
+    , req(std::move(req))
+    , res_ids(&res_ids)
+  {
+  }
+
+  ContactTestData(const std::vector<std::string>& active,
+                  CollisionMarginData collision_margin_data,
+                  IsContactAllowedFn fn,
+                  ContactRequest req,
+                  ContactDistanceResultMap& res_distance)
+    : active(&active)
+    , collision_margin_data(std::move(collision_margin_data))
+    , fn(std::move(fn))
+    , req(std::move(req))
+    , res_distance(&res_distance)
+  {
+  }
+
   /** @brief A vector of active links */
   const std::vector<std::string>* active = nullptr;
 
@@ -262,8 +796,23 @@ struct ContactTestData
   /** @brief Destance query results information */
   ContactResultMap* res = nullptr;
 
+  /** @brief Destance query results information keyed by interned object ids, used instead of res when not null */
+  ContactResultIdMap* res_ids = nullptr;
+
+  /** @brief Distance only query results information, used instead of res and res_ids when not null */
+  ContactDistanceResultMap* res_distance = nullptr;
+
   /** @brief Indicate if search is finished */
   bool done = false;
+
+  /** @brief The number of contacts stored, used to check the contact limit when the ContactTestType is LIMITED */
+  long num_contacts = 0;
+
+  /** @brief The cache of the narrowphase contacts of each pair, nullptr if the contact manager does not use it */
+  ContactPairCache* pair_cache = nullptr;
+
+  /** @brief If not null the contacts and distances found by the narrowphase are also stored in this cache entry */
+  ContactPairCacheEntry* pair_cache_entry = nullptr;
 };
 #endif  // SWIG
 
@@ -0,0 +1,174 @@
+/**
+ * @file fcl_cast_managers.h
+ * @brief Tesseract FCL continuous contact manager implementation.
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_FCL_CAST_MANAGERS_H
+#define TESSERACT_COLLISION_FCL_CAST_MANAGERS_H
+
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/fcl/fcl_utils.h>
+
+#ifdef SWIG
+%shared_ptr(tesseract_collision::tesseract_collision_fcl::FCLCastBVHManager)
+#endif  // SWIG
+
+namespace tesseract_collision
+{
+namespace tesseract_collision_fcl
+{
+/**
+ * @brief A FCL implementation of the continuous contact manager
+ *
+ * The broadphase uses the AABB of each active collision object over its whole motion. The narrowphase uses conservative
+ * advancement along the motion, where the translation is interpolated linearly and the rotation spherically, and
+ * reports the contact at the first time the pair comes within the collision margin, see castCallback. The contact
+ * time is provided by ContactResult::cc_time of the moving collision objects.
+ *
+ * This differs from the BulletCastBVHManager, which reports the closest points between the convex hull swept by the
+ * shapes and the other shapes. Concave shapes like meshes and octrees are supported directly instead of being swept
+ * as their convex hull.
+ */
+class FCLCastBVHManager : public ContinuousContactManager
+{
+public:
+  using Ptr = std::shared_ptr<FCLCastBVHManager>;
+  using ConstPtr = std::shared_ptr<const FCLCastBVHManager>;
+
+  FCLCastBVHManager();
+  ~FCLCastBVHManager() override = default;
+  FCLCastBVHManager(const FCLCastBVHManager&) = delete;
+  FCLCastBVHManager& operator=(const FCLCastBVHManager&) = delete;
+  FCLCastBVHManager(FCLCastBVHManager&&) = delete;
+  FCLCastBVHManager& operator=(FCLCastBVHManager&&) = delete;
+
+  static std::string name() { return "FCLCastBVHManager"; }
+  static ContinuousContactManager::Ptr create() { return std::make_shared<FCLCastBVHManager>(); }
+
+  ContinuousContactManager::Ptr clone() const override;
+
+  bool addCollisionObject(const std::string& name,
+                          const int& mask_id,
+                          const CollisionShapesConst& shapes,
+                          const tesseract_common::VectorIsometry3d& shape_poses,
+                          bool enabled = true) override;
+
+  const CollisionShapesConst& getCollisionObjectGeometries(const std::string& name) const override;
+
+  const tesseract_common::VectorIsometry3d&
+  getCollisionObjectGeometriesTransforms(const std::string& name) const override;
+
+  bool hasCollisionObject(const std::string& name) const override;
+
+  bool removeCollisionObject(const std::string& name) override;
+
+  bool enableCollisionObject(const std::string& name) override;
+
+  bool disableCollisionObject(const std::string& name) override;
+
+  bool updateCollisionObjectGeometries(const std::string& name) override;
+
+  void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& poses) override;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms) override;
+
+  void setCollisionObjectsTransform(const std::string& name,
+                                    const Eigen::Isometry3d& pose1,
+                                    const Eigen::Isometry3d& pose2) override;
+
+  void setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                    const tesseract_common::VectorIsometry3d& pose1,
+                                    const tesseract_common::VectorIsometry3d& pose2) override;
+
+  void setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
+                                    const tesseract_common::TransformMap& pose2) override;
+
+  const std::vector<std::string>& getCollisionObjects() const override;
+
+  void setActiveCollisionObjects(const std::vector<std::string>& names) override;
+
+  const std::vector<std::string>& getActiveCollisionObjects() const override;
+
+  void
+  setCollisionMarginData(CollisionMarginData collision_margin_data,
+                         CollisionMarginOverrideType override_type = CollisionMarginOverrideType::REPLACE) override;
+
+  void setDefaultCollisionMarginData(double default_collision_margin) override;
+
+  void setPairCollisionMarginData(const std::string& name1, const std::string& name2, double collision_margin) override;
+
+  const CollisionMarginData& getCollisionMarginData() const override;
+
+  void setIsContactAllowedFn(IsContactAllowedFn fn) override;
+
+  IsContactAllowedFn getIsContactAllowedFn() const override;
+
+  void contactTest(ContactResultMap& collisions, const ContactRequest& request) override;
+
+#ifndef SWIG
+  /**
+   * @brief Add a fcl collision object to the manager
+   * @param cow The tesseract fcl collision object
+   */
+  void addCollisionObject(COW::Ptr cow);
+#endif  // SWIG
+
+private:
+  /** @brief Broadphase Collision Manager for static collision objects */
+  std::unique_ptr<fcl::BroadPhaseCollisionManagerd> static_manager_;
+
+  /** @brief Broadphase Collision Manager for active collision objects */
+  std::unique_ptr<fcl::BroadPhaseCollisionManagerd> dynamic_manager_;
+
+  Link2COW link2cow_;               /**< @brief A map of all (static and active) collision objects being managed */
+  std::vector<std::string> active_; /**< @brief A list of the active collision objects */
+  std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
+  CollisionMarginData collision_margin_data_;  /**< @brief The contact distance threshold */
+  IsContactAllowedFn fn_;                      /**< @brief The is allowed collision function */
+  std::size_t fcl_co_count_{ 0 };              /**< @brief The number fcl collision objects */
+
+  /** @brief The interned ids of the collision object names */
+  ObjectIdRegistry::Ptr object_ids_{ std::make_shared<ObjectIdRegistry>() };
+
+  /** @brief This is used to store static collision objects to update */
+  std::vector<CollisionObjectRawPtr> static_update_;
+
+  /** @brief This is used to store dynamic collision objects to update */
+  std::vector<CollisionObjectRawPtr> dynamic_update_;
+
+  /** @brief This function will update internal data when margin data has changed */
+  void onCollisionMarginDataChanged();
+
+  /** @brief Set the cast transforms of a collision object and add its fcl objects to the objects to update */
+  void queueCollisionObjectTransform(COW& cow, const Eigen::Isometry3d& pose1, const Eigen::Isometry3d& pose2);
+
+  /** @brief Update the broadphase managers for the collision objects added by queueCollisionObjectTransform */
+  void updateQueuedCollisionObjects();
+};
+
+}  // namespace tesseract_collision_fcl
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_FCL_CAST_MANAGERS_H
@@ -67,6 +67,15 @@ public:
    */
   double getContactDistanceThreshold() const;
 
+  /**
+   * @brief Replace the collision geometry, keeping the transform and the contact distance threshold
+   *
+   * This lets an octree switch to a new octomap without creating a new collision object, so it stays registered in the
+   * broadphase. The AABB must be updated afterwards.
+   * @param collision_geometry The new collision geometry
+   */
+  void setCollisionGeometry(const std::shared_ptr<fcl::CollisionGeometry<double>>& collision_geometry);
+
   /**
    * @brief Update the internal AABB. This must be called instead of the base class computeAABB().
    *
@@ -74,6 +83,16 @@ public:
    */
   void updateAABB();
 
+  /**
+   * @brief Update the internal AABB so it contains the object along a motion from its transform to the cast transform
+   *
+   * After setting the collision objects transform this must be called instead of updateAABB() for moving objects.
+   * @param cast_tf The transform at the end of the motion
+   * @param sweep_distance The distance the object may deviate from the straight line between the start and end
+   * location, for example caused by a rotation about another origin
+   */
+  void updateCastAABB(const fcl::Transform3<double>& cast_tf, double sweep_distance);
+
 protected:
   double contact_distance_{ 0 }; /**< @brief The contact distance threshold. */
 };
@@ -53,6 +53,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/types.h>
 #include <tesseract_collision/core/common.h>
+#include <tesseract_collision/core/contact_pair_cache.h>
+#include <tesseract_collision/core/shape_cache.h>
+#include <tesseract_collision/core/sphere_tree.h>
 #include <tesseract_collision/fcl/fcl_collision_object_wrapper.h>
 
 namespace tesseract_collision
@@ -64,6 +67,12 @@ using CollisionObjectPtr = std::shared_ptr<FCLCollisionObjectWrapper>;
 using CollisionObjectRawPtr = fcl::CollisionObjectd*;
 using CollisionObjectConstPtr = std::shared_ptr<const fcl::CollisionObjectd>;
 
+/** @brief The minimum distance the conservative advancement of a cast pair moves the objects closer per step */
+static const double FCL_CAST_TOLERANCE = 1e-5;
+
+/** @brief The number of conservative advancement steps of a cast pair after which its minimum step grows tenfold */
+static const int FCL_CAST_MAX_ITERATIONS = 100;
+
 enum CollisionFilterGroups
 {
   DefaultFilter = 1,
@@ -96,6 +105,12 @@ public:
 
   const std::string& getName() const { return name_; }
   const int& getTypeID() const { return type_id_; }
+  /** @brief Get the interned id of the collision object name assigned by the contact manager, see ObjectIdRegistry */
+  int getObjectId() const { return object_id_; }
+  /** @brief Set the interned id of the collision object name */
+  void setObjectId(int id) { object_id_ = id; }
+  /** @brief Get the radius of a sphere about the collision object origin which contains all of its shapes */
+  double getBoundingRadius() const { return bounding_radius_; }
   /** \brief Check if two objects point to the same source object */
   bool sameObject(const CollisionObjectWrapper& other) const
   {
@@ -112,26 +127,72 @@ public:
 
   const tesseract_common::VectorIsometry3d& getCollisionGeometriesTransforms() const { return shape_poses_; }
 
+  /** @brief Get the sphere trees of the shapes, empty if sphere trees are not enabled */
+  const SphereTrees& getSphereTrees() const { return sphere_trees_; }
+
+  /**
+   * @brief Set the tolerance of the sphere trees approximating the shapes
+   * @param tolerance The sphere tree tolerance, if not greater than zero the sphere trees are removed
+   */
+  void setSphereTreeTolerance(double tolerance);
+
+  /**
+   * @brief Switch the fcl collision objects of the octrees updated since the last call to the current octomap
+   *
+   * The fcl octree reads the octomap directly, so only the collision geometry of the changed octrees is replaced. The
+   * fcl collision objects are kept and the contact manager must update their AABB in its broadphase.
+   *
+   * @return True if the octree of any shape changed
+   */
+  bool updateOctreeGeometries();
+
   void setCollisionObjectsTransform(const Eigen::Isometry3d& pose)
   {
     world_pose_ = pose;
+    world_cast_pose_ = pose;
+    cast_ = false;
     for (unsigned i = 0; i < collision_objects_.size(); ++i)
     {
       CollisionObjectPtr& co = collision_objects_[i];
-      co->setTransform(pose * shape_poses_[i]);
+      co->setTransform(pose * shape_poses_[shape_indices_[i]]);
       co->updateAABB();  // This a tesseract function that updates abb to take into account contact distance
     }
   }
 
+  /**
+   * @brief Set the transforms at the start and end of a cast motion
+   *
+   * The fcl collision objects are placed at the start transform and their AABB contains the shapes along the whole
+   * motion, see getCastTransform().
+   *
+   * @param pose1 The start transform in world
+   * @param pose2 The end transform in world
+   */
+  void setCollisionObjectsTransform(const Eigen::Isometry3d& pose1, const Eigen::Isometry3d& pose2);
+
   void setContactDistanceThreshold(double contact_distance)
   {
     contact_distance_ = contact_distance;
     for (auto& co : collision_objects_)
       co->setContactDistanceThreshold(contact_distance_);
+
+    if (cast_)
+      setCollisionObjectsTransform(world_pose_, world_cast_pose_);
   }
 
   double getContactDistanceThreshold() const { return contact_distance_; }
   const Eigen::Isometry3d& getCollisionObjectsTransform() const { return world_pose_; }
+  /** @brief Get the transform at the end of the cast motion, equal to the transform if the object is not moving */
+  const Eigen::Isometry3d& getCollisionObjectsCastTransform() const { return world_cast_pose_; }
+  /**
+   * @brief Get the transform of the collision object along the cast motion
+   *
+   * The translation is interpolated linearly and the rotation spherically between the start and end transform.
+   *
+   * @param time The time between 0 and 1 along the motion
+   * @return The transform in world
+   */
+  Eigen::Isometry3d getCastTransform(double time) const;
   const std::vector<CollisionObjectPtr>& getCollisionObjects() const { return collision_objects_; }
   std::vector<CollisionObjectPtr>& getCollisionObjects() { return collision_objects_; }
   const std::vector<CollisionObjectRawPtr>& getCollisionObjectsRaw() const { return collision_objects_raw_; }
@@ -141,9 +202,18 @@ public:
     auto clone_cow = std::make_shared<CollisionObjectWrapper>();
     clone_cow->name_ = name_;
     clone_cow->type_id_ = type_id_;
+    clone_cow->object_id_ = object_id_;
+    clone_cow->world_pose_ = world_pose_;
+    clone_cow->world_cast_pose_ = world_cast_pose_;
+    clone_cow->cast_ = cast_;
+    clone_cow->bounding_radius_ = bounding_radius_;
     clone_cow->shapes_ = shapes_;
     clone_cow->shape_poses_ = shape_poses_;
     clone_cow->collision_geometries_ = collision_geometries_;
+    clone_cow->shape_indices_ = shape_indices_;
+    clone_cow->octree_revisions_ = octree_revisions_;
+    clone_cow->sphere_trees_ = sphere_trees_;
+    clone_cow->sphere_tree_tolerance_ = sphere_tree_tolerance_;
 
     clone_cow->collision_objects_.reserve(collision_objects_.size());
     clone_cow->collision_objects_raw_.reserve(collision_objects_.size());
@@ -175,22 +245,44 @@ public:
 protected:
   std::string name_;             // name of the collision object
   int type_id_;                  // user defined type id
+  int object_id_{ -1 };          // interned id of the name
   Eigen::Isometry3d world_pose_; /**< @brief Collision Object World Transformation */
   CollisionShapesConst shapes_;
   tesseract_common::VectorIsometry3d shape_poses_;
   std::vector<CollisionGeometryPtr> collision_geometries_;
   std::vector<CollisionObjectPtr> collision_objects_;
+  /** @brief The index of the shape of each fcl collision object, shapes not supported by fcl have no object */
+  std::vector<std::size_t> shape_indices_;
+  /** @brief The revision of the octree geometry of each fcl collision object, zero for other shapes */
+  std::vector<std::size_t> octree_revisions_;
   /**
    * @brief The raw pointer is also stored because FCL accepts vectors for batch process.
    * Note: They are updating the API to Shared Pointers but the broadphase has not been updated yet.
    */
   std::vector<CollisionObjectRawPtr> collision_objects_raw_;
 
-  double contact_distance_{ 0 }; /**< @brief The contact distance threshold */
+  /** @brief The collision object world transformation at the end of the cast motion */
+  Eigen::Isometry3d world_cast_pose_{ Eigen::Isometry3d::Identity() };
+  /** @brief Indicate if the AABB of the fcl collision objects contains the cast motion */
+  bool cast_{ false };
+
+  double contact_distance_{ 0 };      /**< @brief The contact distance threshold */
+  double bounding_radius_{ 0 };       /**< @brief The radius about the origin which contains all shapes */
+  SphereTrees sphere_trees_;          /**< @brief The sphere trees of the shapes, shared between clones */
+  double sphere_tree_tolerance_{ 0 }; /**< @brief The tolerance of the sphere trees */
 };
 
 CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom);
 
+/**
+ * @brief Get the process wide cache of mesh collision geometries
+ *
+ * Meshes and convex meshes are looked up by the identity of their vertex and face buffers, so the same mesh added to
+ * several links or contact managers shares one bounding volume hierarchy. FCL does not support scaling a geometry so
+ * a scaled mesh always creates a new geometry.
+ */
+ShapeCache<fcl::CollisionGeometryd>& getShapeCache();
+
 using COW = CollisionObjectWrapper;
 using Link2COW = std::map<std::string, COW::Ptr>;
 using Link2ConstCOW = std::map<std::string, COW::ConstPtr>;
@@ -217,19 +309,22 @@ inline COW::Ptr createFCLCollisionObject(const std::string& name,
 
 /**
  * @brief Update collision objects filters
- * @param active The active collision objects
+ * @param is_active Indicate if the collision object is active
  * @param cow The collision object to update
  * @param static_manager Broadphasse manager for static objects
  * @param dynamic_manager Broadphase manager for dynamic objects
+ * @return True if the collision object was moved between the broadphase managers, otherwise false
  */
-inline void updateCollisionObjectFilters(const std::vector<std::string>& active,
+inline bool updateCollisionObjectFilters(bool is_active,
                                          const COW::Ptr& cow,
                                          const std::unique_ptr<fcl::BroadPhaseCollisionManagerd>& static_manager,
                                          const std::unique_ptr<fcl::BroadPhaseCollisionManagerd>& dynamic_manager)
 {
+  bool changed = false;
+
   // For descrete checks we can check static to kinematic and kinematic to
   // kinematic
-  if (!isLinkActive(active, cow->getName()))
+  if (!is_active)
   {
     if (cow->m_collisionFilterGroup != CollisionFilterGroups::StaticFilter)
     {
@@ -240,6 +335,8 @@ inline void updateCollisionObjectFilters(const std::vector<std::string>& active,
 
       for (auto& co : objects)
         static_manager->registerObject(co.get());
+
+      changed = true;
     }
     cow->m_collisionFilterGroup = CollisionFilterGroups::StaticFilter;
   }
@@ -254,6 +351,8 @@ inline void updateCollisionObjectFilters(const std::vector<std::string>& active,
 
       for (auto& co : objects)
         dynamic_manager->registerObject(co.get());
+
+      changed = true;
     }
     cow->m_collisionFilterGroup = CollisionFilterGroups::KinematicFilter;
   }
@@ -269,12 +368,60 @@ inline void updateCollisionObjectFilters(const std::vector<std::string>& active,
   {
     cow->m_collisionFilterMask = CollisionFilterGroups::StaticFilter | CollisionFilterGroups::KinematicFilter;
   }
+
+  return changed;
+}
+
+/**
+ * @brief Update collision objects filters
+ * @param active The active collision objects
+ * @param cow The collision object to update
+ * @param static_manager Broadphasse manager for static objects
+ * @param dynamic_manager Broadphase manager for dynamic objects
+ */
+inline void updateCollisionObjectFilters(const std::vector<std::string>& active,
+                                         const COW::Ptr& cow,
+                                         const std::unique_ptr<fcl::BroadPhaseCollisionManagerd>& static_manager,
+                                         const std::unique_ptr<fcl::BroadPhaseCollisionManagerd>& dynamic_manager)
+{
+  updateCollisionObjectFilters(isLinkActive(active, cow->getName()), cow, static_manager, dynamic_manager);
 }
 
+/**
+ * @brief Add the contact to the results container of the contact test data
+ *
+ * If the id keyed results container is used the link names are only populated when required by the user validation
+ * function, otherwise they are resolved on demand. If the distance only results container is used only the closest
+ * contact of each pair is kept.
+ *
+ * @param cdata The contact test data
+ * @param contact The contact with all but the link names populated
+ * @param cd1 The first collision object
+ * @param cd2 The second collision object
+ */
+void processContact(ContactTestData& cdata,
+                    ContactResult& contact,
+                    const CollisionObjectWrapper& cd1,
+                    const CollisionObjectWrapper& cd2);
+
 bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
 
 bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
 
+/**
+ * @brief Find the first time along the cast motion of both objects at which they come within the collision margin
+ *
+ * The objects are advanced using conservative advancement: each step moves them by the distance between them minus
+ * the collision margin, divided by an upper bound of how fast any point of the objects moves. The contact is reported
+ * at the first time the distance is within the collision margin. Contacts within the collision margin by less than
+ * FCL_CAST_TOLERANCE may be missed. A pair that stays just outside of the collision margin advances slowly, so the
+ * minimum step grows tenfold after every FCL_CAST_MAX_ITERATIONS steps until the end of the motion is reached. Such a
+ * step may move past a thin obstacle, so the interval it skipped is split in half until the distances at the ends of
+ * each part rule out a contact in between, or the first time within the collision margin is found. Only poses within
+ * the collision margin are reported.
+ */
+bool castCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
+
 }  // namespace tesseract_collision_fcl
 }  // namespace tesseract_collision
 #endif  // TESSERACT_COLLISION_FCL_UTILS_H
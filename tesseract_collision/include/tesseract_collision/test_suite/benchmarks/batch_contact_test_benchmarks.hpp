@@ -0,0 +1,130 @@
+#ifndef TESSERACT_COLLISION_BATCH_CONTACT_TEST_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_BATCH_CONTACT_TEST_BENCHMARKS_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <random>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+/**
+ * @brief Add a grid of spheres, each as its own link, and generate random states for them
+ * @param checker The contact manager to add the spheres to
+ * @param edge_size The number of spheres along each edge of the grid
+ * @param num_states The number of states to generate
+ * @param link_names The names of the links added
+ * @param poses The generated poses stored state by state, the pose of link j for state i is at
+ *              i * link_names.size() + j
+ */
+inline void setupBatchContactTest(DiscreteContactManager& checker,
+                                  int edge_size,
+                                  int num_states,
+                                  std::vector<std::string>& link_names,
+                                  tesseract_common::VectorIsometry3d& poses)
+{
+  double delta = 0.55;
+
+  link_names.clear();
+  tesseract_common::VectorIsometry3d grid_poses;
+  for (int x = 0; x < edge_size; ++x)
+  {
+    for (int y = 0; y < edge_size; ++y)
+    {
+      for (int z = 0; z < edge_size; ++z)
+      {
+        CollisionShapesConst shapes;
+        tesseract_common::VectorIsometry3d shape_poses;
+        shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+        shape_poses.push_back(Eigen::Isometry3d::Identity());
+
+        link_names.push_back("sphere_link_" + std::to_string(x) + std::to_string(y) + std::to_string(z));
+        checker.addCollisionObject(link_names.back(), 0, shapes, shape_poses);
+
+        Eigen::Isometry3d grid_pose = Eigen::Isometry3d::Identity();
+        grid_pose.translation() = Eigen::Vector3d(
+            static_cast<double>(x) * delta, static_cast<double>(y) * delta, static_cast<double>(z) * delta);
+        grid_poses.push_back(grid_pose);
+      }
+    }
+  }
+
+  checker.setActiveCollisionObjects(link_names);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // Use a fixed seed so every manager is benchmarked against the same states
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dist(-0.1, 0.1);
+
+  poses.clear();
+  poses.reserve(static_cast<std::size_t>(num_states) * link_names.size());
+  for (int i = 0; i < num_states; ++i)
+  {
+    for (const auto& grid_pose : grid_poses)
+    {
+      Eigen::Isometry3d pose = grid_pose;
+      pose.translation() += Eigen::Vector3d(dist(gen), dist(gen), dist(gen));
+      poses.push_back(pose);
+    }
+  }
+}
+
+/** @brief Benchmark that checks a batch of states using batchContactTest */
+static void BM_BATCH_CONTACT_TEST(benchmark::State& state,
+                                  DiscreteContactManager::Ptr checker,
+                                  int edge_size,
+                                  int num_states)
+{
+  std::vector<std::string> link_names;
+  tesseract_common::VectorIsometry3d poses;
+  setupBatchContactTest(*checker, edge_size, num_states, link_names, poses);
+
+  ContactRequest request(ContactTestType::ALL);
+  std::vector<ContactResultMap> results;
+  for (auto _ : state)
+  {
+    checker->batchContactTest(results, link_names, poses, request);
+    benchmark::DoNotOptimize(results);
+  }
+};
+
+/** @brief Benchmark that checks a batch of states by calling setCollisionObjectsTransform and contactTest per state */
+static void BM_BATCH_CONTACT_TEST_LOOP(benchmark::State& state,
+                                       DiscreteContactManager::Ptr checker,
+                                       int edge_size,
+                                       int num_states)
+{
+  std::vector<std::string> link_names;
+  tesseract_common::VectorIsometry3d poses;
+  setupBatchContactTest(*checker, edge_size, num_states, link_names, poses);
+
+  ContactRequest request(ContactTestType::ALL);
+  std::vector<ContactResultMap> results;
+  tesseract_common::VectorIsometry3d state_poses(link_names.size());
+  for (auto _ : state)
+  {
+    results.resize(static_cast<std::size_t>(num_states));
+    for (std::size_t i = 0; i < static_cast<std::size_t>(num_states); ++i)
+    {
+      std::copy(poses.begin() + static_cast<long>(i * link_names.size()),
+                poses.begin() + static_cast<long>((i + 1) * link_names.size()),
+                state_poses.begin());
+
+      results[i].clear();
+      checker->setCollisionObjectsTransform(link_names, state_poses);
+      checker->contactTest(results[i], request);
+    }
+    benchmark::DoNotOptimize(results);
+  }
+};
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
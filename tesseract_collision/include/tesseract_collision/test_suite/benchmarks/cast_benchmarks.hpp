@@ -0,0 +1,75 @@
+#ifndef TESSERACT_COLLISION_CAST_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_CAST_BENCHMARKS_HPP
+
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/test_suite/benchmarks/mesh_benchmarks.hpp>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+/** @brief Benchmark that casts a box past a static box, the boxes come within the collision margin if in_contact */
+static void
+BM_CAST_PRIMITIVE_CONTACT_TEST(benchmark::State& state, ContinuousContactManager::Ptr checker, bool in_contact)
+{
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  shapes.push_back(std::make_shared<tesseract_geometry::Box>(0.5, 0.5, 0.5));
+  shape_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("static_link", 0, shapes, shape_poses);
+  checker->addCollisionObject("moving_link", 0, shapes, shape_poses);
+
+  Eigen::Isometry3d start = Eigen::Isometry3d::Identity();
+  start.translation() = Eigen::Vector3d(-2, (in_contact) ? 0.0 : 0.54, 0);
+  Eigen::Isometry3d end = Eigen::Isometry3d::Identity();
+  end.translation() = Eigen::Vector3d(2, (in_contact) ? 0.0 : 0.54, 0);
+  checker->setActiveCollisionObjects({ "moving_link" });
+  checker->setCollisionMarginData(CollisionMarginData(0.02));
+  checker->setCollisionObjectsTransform("moving_link", start, end);
+
+  ContactResultMap results;
+  for (auto _ : state)
+  {
+    results.clear();
+    checker->contactTest(results, ContactRequest(ContactTestType::CLOSEST));
+    benchmark::DoNotOptimize(results);
+  }
+};
+
+/** @brief Benchmark that casts a sphere across a large mesh just above its surface */
+static void BM_CAST_MESH_CONTACT_TEST(benchmark::State& state, ContinuousContactManager::Ptr checker, int edge_size)
+{
+  CollisionShapesConst mesh_shapes;
+  tesseract_common::VectorIsometry3d mesh_poses;
+  mesh_shapes.push_back(createGridMesh(edge_size));
+  mesh_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("mesh_link", 0, mesh_shapes, mesh_poses);
+
+  CollisionShapesConst sphere_shapes;
+  tesseract_common::VectorIsometry3d sphere_poses;
+  sphere_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.05));
+  sphere_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses);
+
+  Eigen::Isometry3d start = Eigen::Isometry3d::Identity();
+  start.translation() = Eigen::Vector3d(-0.4, -0.4, 0.08);
+  Eigen::Isometry3d end = Eigen::Isometry3d::Identity();
+  end.translation() = Eigen::Vector3d(0.4, 0.4, 0.04);
+  checker->setActiveCollisionObjects({ "sphere_link" });
+  checker->setCollisionMarginData(CollisionMarginData(0.05));
+  checker->setCollisionObjectsTransform("sphere_link", start, end);
+
+  ContactResultMap results;
+  for (auto _ : state)
+  {
+    results.clear();
+    checker->contactTest(results, ContactRequest(ContactTestType::CLOSEST));
+    benchmark::DoNotOptimize(results);
+  }
+};
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
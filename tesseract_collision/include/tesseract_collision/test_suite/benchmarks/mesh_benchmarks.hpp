@@ -0,0 +1,102 @@
+#ifndef TESSERACT_COLLISION_MESH_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_MESH_BENCHMARKS_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+/**
+ * @brief Create a square grid mesh in the xy plane centered at the origin
+ * @param edge_size The number of cells along each edge of the grid, the mesh has 2 * edge_size^2 triangles
+ * @return The grid mesh with an edge length of one meter
+ */
+inline tesseract_geometry::Mesh::Ptr createGridMesh(int edge_size)
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto triangles = std::make_shared<Eigen::VectorXi>(8 * edge_size * edge_size);
+
+  const double delta = 1.0 / static_cast<double>(edge_size);
+  vertices->reserve(static_cast<std::size_t>((edge_size + 1) * (edge_size + 1)));
+  for (int x = 0; x <= edge_size; ++x)
+  {
+    for (int y = 0; y <= edge_size; ++y)
+      vertices->emplace_back(static_cast<double>(x) * delta - 0.5, static_cast<double>(y) * delta - 0.5, 0);
+  }
+
+  int t = 0;
+  for (int x = 0; x < edge_size; ++x)
+  {
+    for (int y = 0; y < edge_size; ++y)
+    {
+      int v0 = x * (edge_size + 1) + y;
+      int v1 = v0 + 1;
+      int v2 = v0 + edge_size + 1;
+      int v3 = v2 + 1;
+      (*triangles)[t++] = 3;
+      (*triangles)[t++] = v0;
+      (*triangles)[t++] = v2;
+      (*triangles)[t++] = v1;
+      (*triangles)[t++] = 3;
+      (*triangles)[t++] = v1;
+      (*triangles)[t++] = v2;
+      (*triangles)[t++] = v3;
+    }
+  }
+
+  return std::make_shared<tesseract_geometry::Mesh>(vertices, triangles);
+}
+
+/** @brief Benchmark that adds a collision object with a large mesh to an empty contact manager */
+static void BM_ADD_MESH_COLLISION_OBJECT(benchmark::State& state, DiscreteContactManager::Ptr checker, int edge_size)
+{
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  shapes.push_back(createGridMesh(edge_size));
+  shape_poses.push_back(Eigen::Isometry3d::Identity());
+
+  DiscreteContactManager::Ptr clone;
+  for (auto _ : state)
+  {
+    clone = checker->clone();
+    clone->addCollisionObject("mesh_link", 0, shapes, shape_poses);
+    benchmark::DoNotOptimize(clone);
+  }
+};
+
+/** @brief Benchmark that checks a sphere resting on a large mesh */
+static void BM_MESH_CONTACT_TEST(benchmark::State& state, DiscreteContactManager::Ptr checker, int edge_size)
+{
+  CollisionShapesConst mesh_shapes;
+  tesseract_common::VectorIsometry3d mesh_poses;
+  mesh_shapes.push_back(createGridMesh(edge_size));
+  mesh_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("mesh_link", 0, mesh_shapes, mesh_poses);
+
+  CollisionShapesConst sphere_shapes;
+  tesseract_common::VectorIsometry3d sphere_poses;
+  sphere_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.05));
+  sphere_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses);
+
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(0.1, 0.1, 0.04);
+  checker->setActiveCollisionObjects({ "sphere_link" });
+  checker->setCollisionMarginData(CollisionMarginData(0.05));
+  checker->setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  ContactResultMap results;
+  for (auto _ : state)
+  {
+    results.clear();
+    checker->contactTest(results, ContactRequest(ContactTestType::CLOSEST));
+    benchmark::DoNotOptimize(results);
+  }
+};
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef TESSERACT_COLLISION_OCTREE_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_OCTREE_BENCHMARKS_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <octomap/octomap.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+/**
+ * @brief Create an octree of a floor in the xy plane centered at the origin
+ *
+ * The floor is a single voxel thick so its leafs are never pruned, like the surfaces seen by a depth camera.
+ *
+ * @param edge_size The number of voxels along each edge of the floor, the octree has edge_size^2 occupied leafs
+ * @return The octree of the floor with an edge length of one meter
+ */
+inline tesseract_geometry::Octree::Ptr createFloorOctree(int edge_size)
+{
+  const double resolution = 1.0 / static_cast<double>(edge_size);
+  auto ot = std::make_shared<octomap::OcTree>(resolution);
+  for (int x = 0; x < edge_size; ++x)
+  {
+    for (int y = 0; y < edge_size; ++y)
+    {
+      ot->updateNode((static_cast<double>(x) + 0.5) * resolution - 0.5,
+                     (static_cast<double>(y) + 0.5) * resolution - 0.5,
+                     -0.5 * resolution,
+                     true,
+                     true);
+    }
+  }
+  ot->updateInnerOccupancy();
+
+  return std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+}
+
+/** @brief Benchmark that adds a collision object with a large octree to an empty contact manager */
+static void BM_ADD_OCTREE_COLLISION_OBJECT(benchmark::State& state, DiscreteContactManager::Ptr checker, int edge_size)
+{
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  shapes.push_back(createFloorOctree(edge_size));
+  shape_poses.push_back(Eigen::Isometry3d::Identity());
+
+  DiscreteContactManager::Ptr clone;
+  for (auto _ : state)
+  {
+    clone = checker->clone();
+    clone->addCollisionObject("octree_link", 0, shapes, shape_poses);
+    benchmark::DoNotOptimize(clone);
+  }
+};
+
+/** @brief Benchmark that checks a sphere resting on a large octree */
+static void BM_OCTREE_CONTACT_TEST(benchmark::State& state, DiscreteContactManager::Ptr checker, int edge_size)
+{
+  CollisionShapesConst octree_shapes;
+  tesseract_common::VectorIsometry3d octree_poses;
+  octree_shapes.push_back(createFloorOctree(edge_size));
+  octree_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("octree_link", 0, octree_shapes, octree_poses);
+
+  CollisionShapesConst sphere_shapes;
+  tesseract_common::VectorIsometry3d sphere_poses;
+  sphere_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.05));
+  sphere_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses);
+
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(0.1, 0.1, 0.04);
+  checker->setActiveCollisionObjects({ "sphere_link" });
+  checker->setCollisionMarginData(CollisionMarginData(0.02));
+  checker->setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  ContactResultMap results;
+  for (auto _ : state)
+  {
+    results.clear();
+    checker->contactTest(results, ContactRequest(ContactTestType::CLOSEST));
+    benchmark::DoNotOptimize(results);
+  }
+};
+
+/** @brief Benchmark that casts a sphere across a large octree just above its surface */
+static void BM_CAST_OCTREE_CONTACT_TEST(benchmark::State& state, ContinuousContactManager::Ptr checker, int edge_size)
+{
+  CollisionShapesConst octree_shapes;
+  tesseract_common::VectorIsometry3d octree_poses;
+  octree_shapes.push_back(createFloorOctree(edge_size));
+  octree_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("octree_link", 0, octree_shapes, octree_poses);
+
+  CollisionShapesConst sphere_shapes;
+  tesseract_common::VectorIsometry3d sphere_poses;
+  sphere_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.05));
+  sphere_poses.push_back(Eigen::Isometry3d::Identity());
+  checker->addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses);
+
+  Eigen::Isometry3d start = Eigen::Isometry3d::Identity();
+  start.translation() = Eigen::Vector3d(-0.4, -0.4, 0.08);
+  Eigen::Isometry3d end = Eigen::Isometry3d::Identity();
+  end.translation() = Eigen::Vector3d(0.4, 0.4, 0.04);
+  checker->setActiveCollisionObjects({ "sphere_link" });
+  checker->setCollisionMarginData(CollisionMarginData(0.05));
+  checker->setCollisionObjectsTransform("sphere_link", start, end);
+
+  ContactResultMap results;
+  for (auto _ : state)
+  {
+    results.clear();
+    checker->contactTest(results, ContactRequest(ContactTestType::CLOSEST));
+    benchmark::DoNotOptimize(results);
+  }
+};
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
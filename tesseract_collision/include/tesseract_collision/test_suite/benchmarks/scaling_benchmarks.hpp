@@ -0,0 +1,256 @@
+#ifndef TESSERACT_COLLISION_SCALING_BENCHMARKS_HPP
+#define TESSERACT_COLLISION_SCALING_BENCHMARKS_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <octomap/octomap.h>
+#include <cmath>
+#include <random>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+/** @brief The shape of every collision object in a scaling benchmark, all of them fit in a sphere of radius 0.25 */
+enum class ScalingShapeType
+{
+  PRIMITIVE = 0,   /**< A sphere */
+  CONVEX_MESH = 1, /**< The convex hull of a sphere mesh */
+  MESH = 2,        /**< A sphere mesh */
+  OCTREE = 3,      /**< An octree of the voxels of a sphere */
+  COMPOUND = 4     /**< Several boxes in one collision object */
+};
+
+static const std::vector<std::string> ScalingShapeTypeStrings = {
+  "PRIMITIVE", "CONVEX_MESH", "MESH", "OCTREE", "COMPOUND",
+};
+
+/** @brief The distance between the static collision objects of a scaling benchmark */
+static const double SCALING_OBJECT_SPACING = 0.6;
+
+/** @brief The number of poses the moving collision object of a scaling benchmark cycles through */
+static const std::size_t SCALING_NUM_POSES = 100;
+
+/** @brief Create the shapes of a collision object of a scaling benchmark */
+inline void createScalingShapes(ScalingShapeType type,
+                                CollisionShapesConst& shapes,
+                                tesseract_common::VectorIsometry3d& shape_poses)
+{
+  switch (type)
+  {
+    case ScalingShapeType::PRIMITIVE:
+    {
+      shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+      shape_poses.push_back(Eigen::Isometry3d::Identity());
+      break;
+    }
+    case ScalingShapeType::CONVEX_MESH:
+    case ScalingShapeType::MESH:
+    {
+      tesseract_common::VectorVector3d mesh_vertices;
+      Eigen::VectorXi mesh_faces;
+      loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", mesh_vertices, mesh_faces);
+
+      auto vertices = std::make_shared<tesseract_common::VectorVector3d>(mesh_vertices);
+      auto faces = std::make_shared<Eigen::VectorXi>(mesh_faces);
+      if (type == ScalingShapeType::MESH)
+      {
+        shapes.push_back(std::make_shared<tesseract_geometry::Mesh>(vertices, faces));
+      }
+      else
+      {
+        // This is required because convex hull cannot have multiple faces on the same plane.
+        int ch_num_faces = createConvexHull(*vertices, *faces, mesh_vertices);
+        shapes.push_back(std::make_shared<tesseract_geometry::ConvexMesh>(vertices, faces, ch_num_faces));
+      }
+      shape_poses.push_back(Eigen::Isometry3d::Identity());
+      break;
+    }
+    case ScalingShapeType::OCTREE:
+    {
+      const double resolution = 0.05;
+      auto ot = std::make_shared<octomap::OcTree>(resolution);
+      for (double x = -0.225; x < 0.25; x += resolution)
+      {
+        for (double y = -0.225; y < 0.25; y += resolution)
+        {
+          for (double z = -0.225; z < 0.25; z += resolution)
+          {
+            if (Eigen::Vector3d(x, y, z).norm() < 0.225)
+              ot->updateNode(x, y, z, true, true);
+          }
+        }
+      }
+      ot->updateInnerOccupancy();
+      ot->prune();
+
+      shapes.push_back(std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX));
+      shape_poses.push_back(Eigen::Isometry3d::Identity());
+      break;
+    }
+    case ScalingShapeType::COMPOUND:
+    {
+      for (double x : { -0.125, 0.125 })
+      {
+        for (double y : { -0.125, 0.125 })
+        {
+          Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+          pose.translation() = Eigen::Vector3d(x, y, 0);
+          shapes.push_back(std::make_shared<tesseract_geometry::Box>(0.2, 0.2, 0.2));
+          shape_poses.push_back(pose);
+        }
+      }
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Add the collision objects of a scaling benchmark
+ *
+ * The static objects are placed on a cubic grid and the active object "move_link" has the same shapes.
+ *
+ * @return The poses the moving object cycles through, spread over the grid of static objects
+ */
+template <typename ManagerType>
+inline tesseract_common::VectorIsometry3d addScalingCollisionObjects(ManagerType& checker,
+                                                                     ScalingShapeType type,
+                                                                     int num_objects)
+{
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  createScalingShapes(type, shapes, shape_poses);
+
+  const auto edge_size = static_cast<int>(std::ceil(std::cbrt(static_cast<double>(num_objects)) - 1e-6));
+  tesseract_common::TransformMap locations;
+  for (int i = 0; i < num_objects; ++i)
+  {
+    std::string link_name = "static_link_" + std::to_string(i);
+    checker.addCollisionObject(link_name, 0, shapes, shape_poses);
+
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = SCALING_OBJECT_SPACING * Eigen::Vector3d(static_cast<double>(i % edge_size),
+                                                                  static_cast<double>((i / edge_size) % edge_size),
+                                                                  static_cast<double>(i / (edge_size * edge_size)));
+    locations[link_name] = pose;
+  }
+  checker.addCollisionObject("move_link", 0, shapes, shape_poses);
+  checker.setCollisionObjectsTransform(locations);
+  checker.setActiveCollisionObjects({ "move_link" });
+
+  // The same poses are used for every manager so the results can be compared
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(0, SCALING_OBJECT_SPACING * static_cast<double>(edge_size - 1));
+  tesseract_common::VectorIsometry3d poses;
+  poses.reserve(SCALING_NUM_POSES);
+  for (std::size_t i = 0; i < SCALING_NUM_POSES; ++i)
+  {
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(distribution(generator), distribution(generator), distribution(generator));
+    poses.push_back(pose);
+  }
+
+  return poses;
+}
+
+/** @brief Create the contact request of a scaling benchmark, the limited test stops after a few contacts */
+inline ContactRequest createScalingContactRequest(ContactTestType test_type)
+{
+  ContactRequest request(test_type);
+  if (test_type == ContactTestType::LIMITED)
+    request.contact_limit = 4;
+
+  return request;
+}
+
+/**
+ * @brief Benchmark that moves a collision object through a grid of static objects and checks it at each pose
+ *
+ * The average number of contacts found is reported as a counter so the results of the managers can be compared.
+ */
+static void BM_SCALING_CONTACT_TEST(benchmark::State& state,
+                                    DiscreteContactManager::Ptr checker,
+                                    ScalingShapeType type,
+                                    int num_objects,
+                                    double margin,
+                                    ContactTestType test_type)
+{
+  const tesseract_common::VectorIsometry3d poses = addScalingCollisionObjects(*checker, type, num_objects);
+  checker->setCollisionMarginData(CollisionMarginData(margin));
+  const ContactRequest request = createScalingContactRequest(test_type);
+
+  std::size_t i = 0;
+  std::size_t num_contacts = 0;
+  ContactResultMap results;
+  for (auto _ : state)
+  {
+    checker->setCollisionObjectsTransform("move_link", poses[i++ % poses.size()]);
+    results.clear();
+    checker->contactTest(results, request);
+    num_contacts += results.size();
+    benchmark::DoNotOptimize(results);
+  }
+
+  state.counters["objects"] = num_objects;
+  state.counters["contacts"] =
+      benchmark::Counter(static_cast<double>(num_contacts), benchmark::Counter::kAvgIterations);
+};
+
+/** @brief Benchmark that casts a collision object through a grid of static objects between consecutive poses */
+static void BM_SCALING_CAST_CONTACT_TEST(benchmark::State& state,
+                                         ContinuousContactManager::Ptr checker,
+                                         ScalingShapeType type,
+                                         int num_objects,
+                                         double margin,
+                                         ContactTestType test_type)
+{
+  const tesseract_common::VectorIsometry3d poses = addScalingCollisionObjects(*checker, type, num_objects);
+  checker->setCollisionMarginData(CollisionMarginData(margin));
+  const ContactRequest request = createScalingContactRequest(test_type);
+
+  std::size_t i = 0;
+  std::size_t num_contacts = 0;
+  ContactResultMap results;
+  for (auto _ : state)
+  {
+    checker->setCollisionObjectsTransform("move_link", poses[i % poses.size()], poses[(i + 1) % poses.size()]);
+    ++i;
+    results.clear();
+    checker->contactTest(results, request);
+    num_contacts += results.size();
+    benchmark::DoNotOptimize(results);
+  }
+
+  state.counters["objects"] = num_objects;
+  state.counters["contacts"] =
+      benchmark::Counter(static_cast<double>(num_contacts), benchmark::Counter::kAvgIterations);
+};
+
+/** @brief Benchmark that clones a contact manager with the collision objects of a scaling benchmark */
+template <typename ManagerType>
+static void BM_SCALING_CLONE(benchmark::State& state,
+                             typename ManagerType::Ptr checker,
+                             ScalingShapeType type,
+                             int num_objects)
+{
+  addScalingCollisionObjects(*checker, type, num_objects);
+
+  typename ManagerType::Ptr clone;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(clone = checker->clone());
+  }
+
+  state.counters["objects"] = num_objects;
+};
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif
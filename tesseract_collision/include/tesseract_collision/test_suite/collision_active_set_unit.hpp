@@ -0,0 +1,123 @@
+#ifndef TESSERACT_COLLISION_COLLISION_ACTIVE_SET_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_ACTIVE_SET_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+/** @brief The links used by the test, all spheres overlap each other */
+inline std::vector<std::string> getLinkNames() { return { "link_a", "link_b", "link_c", "link_d" }; }
+
+inline Eigen::Isometry3d getLinkPose(std::size_t i)
+{
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(0.1 * static_cast<double>(i), 0, 0);
+  return pose;
+}
+
+template <typename ManagerType>
+inline void addCollisionObjects(ManagerType& checker)
+{
+  for (const auto& link_name : getLinkNames())
+  {
+    CollisionShapesConst obj_shapes;
+    tesseract_common::VectorIsometry3d obj_poses;
+    obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+    obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+    checker.addCollisionObject(link_name, 0, obj_shapes, obj_poses);
+  }
+
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+}
+
+inline std::size_t runContactTest(DiscreteContactManager& checker)
+{
+  std::vector<std::string> link_names = getLinkNames();
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+    checker.setCollisionObjectsTransform(link_names[i], getLinkPose(i));
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  return result.size();
+}
+
+inline std::size_t runContactTest(ContinuousContactManager& checker)
+{
+  std::vector<std::string> link_names = getLinkNames();
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+  {
+    if (isLinkActive(checker.getActiveCollisionObjects(), link_names[i]))
+      checker.setCollisionObjectsTransform(link_names[i], getLinkPose(i), getLinkPose(i));
+    else
+      checker.setCollisionObjectsTransform(link_names[i], getLinkPose(i));
+  }
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  return result.size();
+}
+}  // namespace detail
+
+/**
+ * @brief Check that changing the active collision objects and enabling or disabling several collision objects at once
+ * updates the contact manager
+ */
+template <typename ManagerType>
+inline void runTest(ManagerType& checker)
+{
+  detail::addCollisionObjects(checker);
+
+  // Only pairs with at least one active object are checked
+  checker.setActiveCollisionObjects({ "link_a" });
+  EXPECT_EQ(detail::runContactTest(checker), 3u);
+
+  checker.setActiveCollisionObjects({ "link_b", "link_a" });
+  EXPECT_EQ(detail::runContactTest(checker), 5u);
+
+  // Setting the same active objects again does not change anything
+  checker.setActiveCollisionObjects({ "link_a", "link_b" });
+  EXPECT_EQ(detail::runContactTest(checker), 5u);
+
+  checker.setActiveCollisionObjects({ "link_c" });
+  EXPECT_EQ(detail::runContactTest(checker), 3u);
+
+  // An empty list makes all objects active
+  checker.setActiveCollisionObjects({});
+  EXPECT_EQ(detail::runContactTest(checker), 6u);
+
+  checker.setActiveCollisionObjects(detail::getLinkNames());
+  EXPECT_EQ(detail::runContactTest(checker), 6u);
+
+  // Batched enable and disable
+  EXPECT_TRUE(checker.disableCollisionObjects({ "link_b", "link_c" }));
+  EXPECT_EQ(detail::runContactTest(checker), 1u);
+
+  EXPECT_FALSE(checker.disableCollisionObjects({ "link_d", "missing_link" }));
+  EXPECT_EQ(detail::runContactTest(checker), 0u);
+
+  EXPECT_TRUE(checker.enableCollisionObjects({ "link_b", "link_c", "link_d" }));
+  EXPECT_EQ(detail::runContactTest(checker), 6u);
+
+  // Disabled objects stay disabled when the active objects change
+  EXPECT_TRUE(checker.disableCollisionObjects({ "link_a" }));
+  checker.setActiveCollisionObjects({ "link_a", "link_b" });
+  EXPECT_EQ(detail::runContactTest(checker), 2u);
+
+  EXPECT_TRUE(checker.enableCollisionObjects({ "link_a" }));
+  EXPECT_EQ(detail::runContactTest(checker), 5u);
+
+  // Enabling objects which are already enabled does not change anything
+  EXPECT_TRUE(checker.enableCollisionObjects({ "link_a", "link_b" }));
+  EXPECT_EQ(detail::runContactTest(checker), 5u);
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_ACTIVE_SET_UNIT_HPP
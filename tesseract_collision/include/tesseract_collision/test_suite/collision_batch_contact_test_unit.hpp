@@ -0,0 +1,135 @@
+#ifndef TESSERACT_COLLISION_COLLISION_BATCH_CONTACT_TEST_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_BATCH_CONTACT_TEST_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+inline void addCollisionObjects(DiscreteContactManager& checker)
+{
+  std::vector<std::string> link_names = { "sphere_link", "sphere1_link", "sphere2_link" };
+  for (const auto& link_name : link_names)
+  {
+    CollisionShapesConst obj_shapes;
+    tesseract_common::VectorIsometry3d obj_poses;
+    obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+    obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+    checker.addCollisionObject(link_name, 0, obj_shapes, obj_poses);
+  }
+}
+
+/**
+ * @brief Create the states used by the test
+ *
+ * State 0: All spheres are in collision
+ * State 1: No spheres are within the contact distance
+ * State 2: Only sphere_link and sphere1_link are in collision
+ */
+inline std::vector<tesseract_common::TransformMap> createStates()
+{
+  std::vector<tesseract_common::TransformMap> states(3);
+  for (auto& state : states)
+  {
+    state["sphere_link"] = Eigen::Isometry3d::Identity();
+    state["sphere1_link"] = Eigen::Isometry3d::Identity();
+    state["sphere2_link"] = Eigen::Isometry3d::Identity();
+  }
+
+  states[0]["sphere1_link"].translation() = Eigen::Vector3d(0.2, 0, 0);
+  states[0]["sphere2_link"].translation() = Eigen::Vector3d(0, 0.2, 0);
+
+  states[1]["sphere1_link"].translation() = Eigen::Vector3d(2, 0, 0);
+  states[1]["sphere2_link"].translation() = Eigen::Vector3d(0, 2, 0);
+
+  states[2]["sphere1_link"].translation() = Eigen::Vector3d(0.2, 0, 0);
+  states[2]["sphere2_link"].translation() = Eigen::Vector3d(0, 2, 0);
+
+  return states;
+}
+
+inline void checkResults(const std::vector<ContactResultMap>& batch_results,
+                         const std::vector<ContactResultMap>& loop_results)
+{
+  ASSERT_EQ(batch_results.size(), loop_results.size());
+  for (std::size_t i = 0; i < batch_results.size(); ++i)
+  {
+    EXPECT_EQ(batch_results[i].size(), loop_results[i].size());
+    for (const auto& loop_pair : loop_results[i])
+    {
+      auto it = batch_results[i].find(loop_pair.first);
+      ASSERT_TRUE(it != batch_results[i].end());
+      ASSERT_EQ(it->second.size(), loop_pair.second.size());
+      for (std::size_t j = 0; j < it->second.size(); ++j)
+        EXPECT_NEAR(it->second[j].distance, loop_pair.second[j].distance, 1e-6);
+    }
+  }
+
+  // Check expected number of colliding pairs
+  ASSERT_EQ(batch_results.size(), 3u);
+  EXPECT_EQ(batch_results[0].size(), 3u);
+  EXPECT_TRUE(batch_results[1].empty());
+  EXPECT_EQ(batch_results[2].size(), 1u);
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addCollisionObjects(checker);
+
+  std::vector<std::string> link_names = { "sphere_link", "sphere1_link", "sphere2_link" };
+  checker.setActiveCollisionObjects(link_names);
+  checker.setDefaultCollisionMarginData(0.1);
+
+  std::vector<tesseract_common::TransformMap> states = detail::createStates();
+  ContactRequest request(ContactTestType::ALL);
+
+  // Reference results computed one state at a time
+  std::vector<ContactResultMap> loop_results(states.size());
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    checker.setCollisionObjectsTransform(states[i]);
+    checker.contactTest(loop_results[i], request);
+  }
+
+  // Transform map batch
+  {
+    std::vector<ContactResultMap> batch_results;
+    checker.batchContactTest(batch_results, states, request);
+    detail::checkResults(batch_results, loop_results);
+  }
+
+  // Dense pose array batch, results containers are reused
+  {
+    tesseract_common::VectorIsometry3d poses;
+    for (const auto& state : states)
+    {
+      for (const auto& link_name : link_names)
+        poses.push_back(state.at(link_name));
+    }
+
+    std::vector<ContactResultMap> batch_results(1);
+    checker.batchContactTest(batch_results, link_names, poses, request);
+    detail::checkResults(batch_results, loop_results);
+
+    checker.batchContactTest(batch_results, link_names, poses, request);
+    detail::checkResults(batch_results, loop_results);
+  }
+
+  // A clone should produce the same results
+  {
+    DiscreteContactManager::Ptr cloned_checker = checker.clone();
+    std::vector<ContactResultMap> batch_results;
+    cloned_checker->batchContactTest(batch_results, states, request);
+    detail::checkResults(batch_results, loop_results);
+  }
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_BATCH_CONTACT_TEST_UNIT_HPP
@@ -0,0 +1,290 @@
+#ifndef TESSERACT_COLLISION_COLLISION_CAST_TIME_OF_CONTACT_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_CAST_TIME_OF_CONTACT_UNIT_HPP
+
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+inline void addCollisionObject(ContinuousContactManager& checker,
+                               const std::string& name,
+                               const CollisionShapePtr& shape,
+                               const Eigen::Isometry3d& shape_pose = Eigen::Isometry3d::Identity())
+{
+  CollisionShapesConst shapes;
+  tesseract_common::VectorIsometry3d shape_poses;
+  shapes.push_back(shape);
+  shape_poses.push_back(shape_pose);
+  EXPECT_TRUE(checker.addCollisionObject(name, 0, shapes, shape_poses));
+}
+
+inline tesseract_geometry::Mesh::Ptr loadSphereMesh()
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto faces = std::make_shared<Eigen::VectorXi>();
+  int num_faces =
+      loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", *vertices, *faces, true);
+  EXPECT_GT(num_faces, 0);
+  return std::make_shared<tesseract_geometry::Mesh>(vertices, faces, num_faces);
+}
+
+inline Eigen::Isometry3d createTranslation(double x, double y, double z)
+{
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(x, y, z);
+  return pose;
+}
+
+/**
+ * @brief Cast the moving link between two poses and return the contact with the static link
+ * @return The contact where index 0 is the moving link, empty if there is no contact
+ */
+inline ContactResultVector castLink(ContinuousContactManager& checker,
+                                    const Eigen::Isometry3d& start,
+                                    const Eigen::Isometry3d& end)
+{
+  checker.setCollisionObjectsTransform("static_link", Eigen::Isometry3d::Identity());
+  checker.setCollisionObjectsTransform("moving_link", start, end);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector result_vector;
+  flattenResults(std::move(result), result_vector);
+
+  for (auto& contact : result_vector)
+  {
+    if (contact.link_names[0] == "moving_link")
+      continue;
+
+    std::swap(contact.link_names[0], contact.link_names[1]);
+    std::swap(contact.shape_id[0], contact.shape_id[1]);
+    std::swap(contact.subshape_id[0], contact.subshape_id[1]);
+    std::swap(contact.type_id[0], contact.type_id[1]);
+    std::swap(contact.nearest_points[0], contact.nearest_points[1]);
+    std::swap(contact.nearest_points_local[0], contact.nearest_points_local[1]);
+    std::swap(contact.transform[0], contact.transform[1]);
+    std::swap(contact.cc_time[0], contact.cc_time[1]);
+    std::swap(contact.cc_type[0], contact.cc_type[1]);
+    std::swap(contact.cc_transform[0], contact.cc_transform[1]);
+    contact.normal *= -1;
+  }
+
+  return result_vector;
+}
+
+/**
+ * @brief Check the first contact of a sphere of radius 0.25 moving along x from -1 to 1 past the static link
+ * @param tolerance The tolerance of the contact distance, which is twice the tolerance of the contact time
+ */
+inline void runLinearSphereTest(ContinuousContactManager& checker, double expected_time, double tolerance = 0.01)
+{
+  const Eigen::Isometry3d start = createTranslation(-1, 0, 0);
+  const Eigen::Isometry3d end = createTranslation(1, 0, 0);
+  ContactResultVector result_vector = castLink(checker, start, end);
+  ASSERT_EQ(result_vector.size(), 1u);
+
+  // The contact is reported when the pair first comes within the collision margin
+  const ContactResult& contact = result_vector[0];
+  EXPECT_NEAR(contact.cc_time[0], expected_time, tolerance / 2);
+  EXPECT_TRUE(contact.cc_type[0] == ContinuousCollisionType::CCType_Between);
+  EXPECT_TRUE(contact.cc_type[1] == ContinuousCollisionType::CCType_None);
+  EXPECT_NEAR(contact.distance, 0.1, tolerance);
+  EXPECT_LE(contact.distance, 0.1);
+
+  EXPECT_TRUE(contact.transform[0].isApprox(start, 1e-8));
+  EXPECT_TRUE(contact.cc_transform[0].isApprox(end, 1e-8));
+
+  const Eigen::Isometry3d contact_tf = createTranslation(-1 + 2 * contact.cc_time[0], 0, 0);
+  EXPECT_TRUE(contact.nearest_points_local[0].isApprox(contact_tf.inverse() * contact.nearest_points[0], 1e-6));
+  EXPECT_NEAR(contact.nearest_points[0].x(), contact_tf.translation().x() + 0.25, tolerance);
+  EXPECT_NEAR(contact.normal.x(), 1, tolerance);
+}
+}  // namespace detail
+
+/** @brief Check the time of contact of a sphere and a box moving along a straight line */
+inline void runLinearTest(ContinuousContactManager& checker)
+{
+  detail::addCollisionObject(checker, "static_link", std::make_shared<tesseract_geometry::Sphere>(0.25));
+  detail::addCollisionObject(checker, "moving_link", std::make_shared<tesseract_geometry::Sphere>(0.25));
+  checker.setActiveCollisionObjects({ "moving_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // The spheres are within the collision margin once their centers are 0.6 apart, x = -0.6
+  detail::runLinearSphereTest(checker, 0.2);
+
+  // The cloned manager keeps the cast transforms
+  ContinuousContactManager::Ptr cloned_checker = checker.clone();
+  ContactResultMap result;
+  cloned_checker->contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_EQ(result.size(), 1u);
+  detail::runLinearSphereTest(*cloned_checker, 0.2);
+
+  // Passing by the static link
+  ContactResultVector result_vector =
+      detail::castLink(checker, detail::createTranslation(-1, 0.7, 0), detail::createTranslation(1, 0.7, 0));
+  EXPECT_TRUE(result_vector.empty());
+
+  // Stopping before the static link
+  result_vector = detail::castLink(checker, detail::createTranslation(-1, 0, 0), detail::createTranslation(-0.7, 0, 0));
+  EXPECT_TRUE(result_vector.empty());
+
+  // Within the collision margin at the end of the motion
+  result_vector =
+      detail::castLink(checker, detail::createTranslation(-1, 0, 0), detail::createTranslation(-0.55, 0, 0));
+  ASSERT_EQ(result_vector.size(), 1u);
+  EXPECT_NEAR(result_vector[0].cc_time[0], 0.4 / 0.45, 0.005);
+
+  // In collision at the start of the motion
+  result_vector = detail::castLink(checker, detail::createTranslation(0.3, 0, 0), detail::createTranslation(1, 0, 0));
+  ASSERT_EQ(result_vector.size(), 1u);
+  EXPECT_NEAR(result_vector[0].cc_time[0], 0, 1e-8);
+  EXPECT_TRUE(result_vector[0].cc_type[0] == ContinuousCollisionType::CCType_Time0);
+  EXPECT_NEAR(result_vector[0].distance, -0.2, 1e-4);
+
+  // Disabled collision objects are not checked
+  checker.disableCollisionObject("moving_link");
+  result_vector = detail::castLink(checker, detail::createTranslation(-1, 0, 0), detail::createTranslation(1, 0, 0));
+  EXPECT_TRUE(result_vector.empty());
+  checker.enableCollisionObject("moving_link");
+
+  // A box of size 0.5 is within the collision margin once the centers are 0.6 apart, x = -0.6
+  detail::addCollisionObject(checker, "moving_link", std::make_shared<tesseract_geometry::Box>(0.5, 0.5, 0.5));
+  detail::addCollisionObject(checker, "static_link", std::make_shared<tesseract_geometry::Box>(0.5, 0.5, 0.5));
+  checker.setActiveCollisionObjects({ "moving_link" });
+  result_vector = detail::castLink(checker, detail::createTranslation(-2, 0, 0), detail::createTranslation(2, 0, 0));
+  ASSERT_EQ(result_vector.size(), 1u);
+  EXPECT_NEAR(result_vector[0].cc_time[0], 0.35, 0.005);
+  EXPECT_NEAR(result_vector[0].distance, 0.1, 0.005);
+}
+
+/** @brief Check the time of contact of a sphere moving towards a concave mesh */
+inline void runMeshTest(ContinuousContactManager& checker)
+{
+  detail::addCollisionObject(checker, "static_link", detail::loadSphereMesh());
+  detail::addCollisionObject(checker, "moving_link", std::make_shared<tesseract_geometry::Sphere>(0.25));
+  checker.setActiveCollisionObjects({ "moving_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // The mesh approximates a sphere of radius 0.25 and its faces are slightly inside of the sphere
+  detail::runLinearSphereTest(checker, 0.2, 0.02);
+}
+
+/**
+ * @brief Check a sphere which passes just outside of the collision margin of a mesh before it runs in to it
+ *
+ * The mesh has a triangle parallel to the motion of the sphere, 1e-5 outside of the collision margin, so the
+ * conservative advancement only moves by its minimum step. A second triangle crosses the path of the sphere at x = 0.5.
+ */
+inline void runGrazeTest(ContinuousContactManager& checker)
+{
+  const double graze_y = 0.35 + 1e-5;
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(-2, graze_y, -1);
+  vertices->emplace_back(2, graze_y, -1);
+  vertices->emplace_back(0, graze_y, 2);
+  vertices->emplace_back(0.5, -1, -1);
+  vertices->emplace_back(0.5, -1, 1);
+  vertices->emplace_back(0.5, 0.3, 0);
+  auto faces = std::make_shared<Eigen::VectorXi>(8);
+  *faces << 3, 0, 1, 2, 3, 3, 4, 5;
+
+  detail::addCollisionObject(checker, "static_link", std::make_shared<tesseract_geometry::Mesh>(vertices, faces, 2));
+  detail::addCollisionObject(checker, "moving_link", std::make_shared<tesseract_geometry::Sphere>(0.25));
+  checker.setActiveCollisionObjects({ "moving_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // Passing along the first triangle without reaching the second one is not a contact
+  ContactResultVector result_vector =
+      detail::castLink(checker, detail::createTranslation(-1, 0, 0), detail::createTranslation(0, 0, 0));
+  EXPECT_TRUE(result_vector.empty());
+
+  // The sphere is within the collision margin of the second triangle once its center reaches x = 0.15
+  result_vector = detail::castLink(checker, detail::createTranslation(-1, 0, 0), detail::createTranslation(1, 0, 0));
+  ASSERT_EQ(result_vector.size(), 1u);
+  EXPECT_NEAR(result_vector[0].cc_time[0], 0.575, 0.01);
+  EXPECT_TRUE(result_vector[0].cc_type[0] == ContinuousCollisionType::CCType_Between);
+  EXPECT_LT(result_vector[0].distance, 0.1);
+  EXPECT_NEAR(result_vector[0].distance, 0.1, 0.02);
+}
+
+/**
+ * @brief Check a small sphere which passes just outside of a mesh before it runs through a thin triangle
+ *
+ * The sphere is 1e-4 from a triangle parallel to its motion, so the minimum step of the conservative advancement grows
+ * to more than the time the sphere takes to run through the second triangle, which crosses its path at x = 0.5.
+ */
+inline void runThinObstacleTest(ContinuousContactManager& checker)
+{
+  const double graze_y = 0.01 + 1e-4;
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  vertices->emplace_back(-2, graze_y, -1);
+  vertices->emplace_back(2, graze_y, -1);
+  vertices->emplace_back(0, graze_y, 2);
+  vertices->emplace_back(0.5, -1, -1);
+  vertices->emplace_back(0.5, -1, 1);
+  vertices->emplace_back(0.5, 0.3, 0);
+  auto faces = std::make_shared<Eigen::VectorXi>(8);
+  *faces << 3, 0, 1, 2, 3, 3, 4, 5;
+
+  detail::addCollisionObject(checker, "static_link", std::make_shared<tesseract_geometry::Mesh>(vertices, faces, 2));
+  detail::addCollisionObject(checker, "moving_link", std::make_shared<tesseract_geometry::Sphere>(0.01));
+  checker.setActiveCollisionObjects({ "moving_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0));
+
+  // The sphere touches the second triangle once its center reaches x = 0.49
+  ContactResultVector result_vector =
+      detail::castLink(checker, detail::createTranslation(-1, 0, 0), detail::createTranslation(1, 0, 0));
+  ASSERT_EQ(result_vector.size(), 1u);
+  EXPECT_NEAR(result_vector[0].cc_time[0], 0.745, 0.001);
+  EXPECT_TRUE(result_vector[0].cc_type[0] == ContinuousCollisionType::CCType_Between);
+  EXPECT_LE(result_vector[0].distance, 0);
+}
+
+/** @brief Check the time of contact of a rotating box */
+inline void runRotationTest(ContinuousContactManager& checker)
+{
+  detail::addCollisionObject(checker, "static_link", std::make_shared<tesseract_geometry::Sphere>(0.1));
+  CollisionShapePtr box = std::make_shared<tesseract_geometry::Box>(2, 0.1, 0.1);
+  detail::addCollisionObject(checker, "moving_link", box, detail::createTranslation(1, 0, 0));
+  checker.setActiveCollisionObjects({ "moving_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.05));
+
+  // The box extends from the origin along x and rotates 90 degrees about z towards the sphere located at y = 0.8. At
+  // angle a the distance of the sphere center to the box is 0.8 * cos(a) - 0.05, so the pair is within the collision
+  // margin once cos(a) = 0.25.
+  Eigen::Isometry3d sphere_pose = detail::createTranslation(0, 0.8, 0);
+  checker.setCollisionObjectsTransform("static_link", sphere_pose);
+  checker.setCollisionObjectsTransform("moving_link",
+                                       Eigen::Isometry3d::Identity(),
+                                       Eigen::Isometry3d(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ())));
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector result_vector;
+  flattenResults(std::move(result), result_vector);
+  ASSERT_EQ(result_vector.size(), 1u);
+
+  const std::size_t idx = (result_vector[0].link_names[0] == "moving_link") ? 0 : 1;
+  EXPECT_NEAR(result_vector[0].cc_time[idx], std::acos(0.25) / M_PI_2, 0.005);
+  EXPECT_TRUE(result_vector[0].cc_type[idx] == ContinuousCollisionType::CCType_Between);
+  EXPECT_NEAR(result_vector[0].distance, 0.05, 0.005);
+
+  // Rotating the other way moves the box away from the sphere
+  checker.setCollisionObjectsTransform("moving_link",
+                                       Eigen::Isometry3d::Identity(),
+                                       Eigen::Isometry3d(Eigen::AngleAxisd(-M_PI_2, Eigen::Vector3d::UnitZ())));
+  result = ContactResultMap();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_COLLISION_CAST_TIME_OF_CONTACT_UNIT_HPP
@@ -0,0 +1,123 @@
+#ifndef TESSERACT_COLLISION_COLLISION_CONTACT_RESULT_ID_MAP_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_CONTACT_RESULT_ID_MAP_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+inline void addCollisionObjects(DiscreteContactManager& checker)
+{
+  // Add a row of overlapping spheres
+  for (int i = 0; i < 5; ++i)
+  {
+    CollisionShapesConst obj_shapes;
+    tesseract_common::VectorIsometry3d obj_poses;
+    obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+    obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+    checker.addCollisionObject("sphere_link_" + std::to_string(i), 0, obj_shapes, obj_poses);
+  }
+
+  // Add a box which is disabled
+  CollisionShapesConst obj_shapes;
+  tesseract_common::VectorIsometry3d obj_poses;
+  obj_shapes.push_back(std::make_shared<tesseract_geometry::Box>(1, 1, 1));
+  obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+  checker.addCollisionObject("box_link", 0, obj_shapes, obj_poses, false);
+}
+
+inline void checkResults(const ContactResultMap& id_results, const ContactResultMap& results)
+{
+  EXPECT_EQ(id_results.size(), results.size());
+  for (const auto& pair : results)
+  {
+    auto it = id_results.find(pair.first);
+    ASSERT_TRUE(it != id_results.end());
+    ASSERT_EQ(it->second.size(), pair.second.size());
+    for (std::size_t i = 0; i < pair.second.size(); ++i)
+    {
+      EXPECT_EQ(it->second[i].link_names[0], pair.second[i].link_names[0]);
+      EXPECT_EQ(it->second[i].link_names[1], pair.second[i].link_names[1]);
+      EXPECT_NEAR(it->second[i].distance, pair.second[i].distance, 1e-6);
+    }
+  }
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addCollisionObjects(checker);
+
+  std::vector<std::string> active_links;
+  tesseract_common::TransformMap location;
+  for (int i = 0; i < 5; ++i)
+  {
+    std::string name = "sphere_link_" + std::to_string(i);
+    active_links.push_back(name);
+    location[name] = Eigen::Isometry3d::Identity();
+    location[name].translation() = Eigen::Vector3d(0.4 * static_cast<double>(i), 0, 0);
+  }
+
+  checker.setActiveCollisionObjects(active_links);
+  checker.setDefaultCollisionMarginData(0.1);
+  checker.setCollisionObjectsTransform(location);
+
+  std::vector<ContactTestType> test_types = { ContactTestType::ALL, ContactTestType::CLOSEST };
+  for (const auto& test_type : test_types)
+  {
+    ContactResultMap results;
+    checker.contactTest(results, ContactRequest(test_type));
+    EXPECT_EQ(results.size(), 4u);
+
+    ContactResultIdMap id_results;
+    checker.contactTest(id_results, ContactRequest(test_type));
+    EXPECT_EQ(id_results.size(), results.size());
+    ASSERT_TRUE(id_results.getObjectIdRegistry() != nullptr);
+
+    for (const auto& entry : id_results)
+    {
+      for (const auto& r : entry.second)
+      {
+        EXPECT_GE(r.link_ids[0], 0);
+        EXPECT_GE(r.link_ids[1], 0);
+        EXPECT_EQ(getObjectPairId(r.link_ids[0], r.link_ids[1]), entry.first);
+      }
+    }
+
+    ContactResultMap converted_results;
+    id_results.toContactResultMap(converted_results);
+    detail::checkResults(converted_results, results);
+
+    // Reusing the container after clear should produce the same results
+    id_results.clear();
+    checker.contactTest(id_results, ContactRequest(test_type));
+    converted_results.clear();
+    id_results.toContactResultMap(converted_results);
+    detail::checkResults(converted_results, results);
+  }
+
+  // Pair collision margins are respected
+  {
+    checker.setPairCollisionMarginData("sphere_link_0", "sphere_link_1", -0.2);
+
+    ContactResultMap results;
+    checker.contactTest(results, ContactRequest(ContactTestType::ALL));
+    EXPECT_EQ(results.size(), 3u);
+
+    ContactResultIdMap id_results;
+    checker.contactTest(id_results, ContactRequest(ContactTestType::ALL));
+    ContactResultMap converted_results;
+    id_results.toContactResultMap(converted_results);
+    detail::checkResults(converted_results, results);
+  }
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_CONTACT_RESULT_ID_MAP_UNIT_HPP
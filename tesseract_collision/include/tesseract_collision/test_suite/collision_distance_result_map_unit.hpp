@@ -0,0 +1,134 @@
+#ifndef TESSERACT_COLLISION_COLLISION_DISTANCE_RESULT_MAP_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_DISTANCE_RESULT_MAP_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+inline void addCollisionObjects(DiscreteContactManager& checker)
+{
+  // Add a row of spheres where neighbouring spheres overlap or are within the contact distance
+  std::vector<std::string> active_links;
+  tesseract_common::TransformMap location;
+  for (int i = 0; i < 5; ++i)
+  {
+    CollisionShapesConst obj_shapes;
+    tesseract_common::VectorIsometry3d obj_poses;
+    obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+    obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+    std::string name = "sphere_link_" + std::to_string(i);
+    checker.addCollisionObject(name, 0, obj_shapes, obj_poses);
+    active_links.push_back(name);
+    location[name] = Eigen::Isometry3d::Identity();
+    location[name].translation() = Eigen::Vector3d(0.45 * static_cast<double>(i), 0.01 * static_cast<double>(i), 0);
+  }
+
+  checker.setActiveCollisionObjects(active_links);
+  checker.setDefaultCollisionMarginData(0.1);
+  checker.setCollisionObjectsTransform(location);
+}
+
+/** @brief Check the distance only results against the closest contact results */
+inline void checkResults(const ContactDistanceResultMap& distance_results,
+                         const ContactResultMap& results,
+                         bool calculate_nearest_points)
+{
+  ASSERT_EQ(distance_results.size(), results.size());
+  for (const auto& dr : distance_results.getResults())
+  {
+    auto names = distance_results.getObjectNames(dr);
+    auto it = results.find(getObjectPairKey(names.first, names.second));
+    ASSERT_TRUE(it != results.end());
+    const ContactResult& cr = it->second[0];
+    EXPECT_NEAR(dr.distance, cr.distance, 1e-6);
+
+    if (!calculate_nearest_points)
+    {
+      EXPECT_TRUE(dr.getNearestPoint(0).isZero());
+      EXPECT_TRUE(dr.getNearestPoint(1).isZero());
+      EXPECT_TRUE(dr.getNormal().isZero());
+      continue;
+    }
+
+    // The order of the objects may differ from the full contact result
+    const bool same_order = (names.first == cr.link_names[0]);
+    const double sign = (same_order) ? 1 : -1;
+    EXPECT_TRUE(dr.getNearestPoint(0).isApprox(cr.nearest_points[(same_order) ? 0 : 1], 1e-4));
+    EXPECT_TRUE(dr.getNearestPoint(1).isApprox(cr.nearest_points[(same_order) ? 1 : 0], 1e-4));
+    EXPECT_TRUE(dr.getNormal().isApprox(sign * cr.normal, 1e-4));
+  }
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addCollisionObjects(checker);
+
+  ContactResultMap results;
+  checker.contactTest(results, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_EQ(results.size(), 4u);
+
+  // Only the closest contact of each pair is stored for all test types
+  std::vector<ContactTestType> test_types = { ContactTestType::ALL, ContactTestType::CLOSEST };
+  for (const auto& test_type : test_types)
+  {
+    ContactRequest request(test_type);
+    ContactDistanceResultMap distance_results;
+    checker.contactTest(distance_results, request);
+    ASSERT_TRUE(distance_results.getObjectIdRegistry() != nullptr);
+    detail::checkResults(distance_results, results, true);
+
+    // Reusing the container after clear should produce the same results
+    distance_results.clear();
+    request.calculate_nearest_points = false;
+    checker.contactTest(distance_results, request);
+    detail::checkResults(distance_results, results, false);
+  }
+
+  // The user validation function receives the full contact result
+  {
+    ContactRequest request(ContactTestType::CLOSEST);
+    request.is_valid = [](const ContactResult& cr) {
+      return cr.link_names[0] != "sphere_link_0" && cr.link_names[1] != "sphere_link_0";
+    };
+
+    ContactDistanceResultMap distance_results;
+    checker.contactTest(distance_results, request);
+    EXPECT_EQ(distance_results.size(), 3u);
+  }
+
+  {
+    ContactDistanceResultMap distance_results;
+    checker.contactTest(distance_results, ContactRequest(ContactTestType::FIRST));
+    EXPECT_EQ(distance_results.size(), 1u);
+
+    ContactRequest request(ContactTestType::LIMITED);
+    request.contact_limit = 2;
+    distance_results.clear();
+    checker.contactTest(distance_results, request);
+    EXPECT_EQ(distance_results.size(), 2u);
+  }
+
+  // Pair collision margins are respected
+  {
+    checker.setPairCollisionMarginData("sphere_link_0", "sphere_link_1", -0.2);
+
+    results.clear();
+    checker.contactTest(results, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_EQ(results.size(), 3u);
+
+    ContactDistanceResultMap distance_results;
+    checker.contactTest(distance_results, ContactRequest(ContactTestType::CLOSEST));
+    detail::checkResults(distance_results, results, true);
+  }
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_DISTANCE_RESULT_MAP_UNIT_HPP
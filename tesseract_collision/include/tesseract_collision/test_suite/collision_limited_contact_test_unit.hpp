@@ -0,0 +1,192 @@
+#ifndef TESSERACT_COLLISION_COLLISION_LIMITED_CONTACT_TEST_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_LIMITED_CONTACT_TEST_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+/**
+ * @brief Add a grid of overlapping sphere meshes, each as its own link, and make them all active
+ * @details Overlapping meshes have a contact for each pair of intersecting triangles, so a pair has several contacts
+ */
+inline void addCollisionObjects(DiscreteContactManager& checker)
+{
+  double delta = 0.45;
+
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto faces = std::make_shared<Eigen::VectorXi>();
+  int num_faces =
+      loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", *vertices, *faces, true);
+  EXPECT_GT(num_faces, 0);
+  auto sphere = std::make_shared<tesseract_geometry::Mesh>(vertices, faces, num_faces);
+
+  std::vector<std::string> link_names;
+  tesseract_common::TransformMap location;
+  for (std::size_t x = 0; x < 3; ++x)
+  {
+    for (std::size_t y = 0; y < 3; ++y)
+    {
+      for (std::size_t z = 0; z < 3; ++z)
+      {
+        CollisionShapesConst obj_shapes;
+        tesseract_common::VectorIsometry3d obj_poses;
+        obj_shapes.push_back(sphere);
+        obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+        link_names.push_back("sphere_link_" + std::to_string(x) + std::to_string(y) + std::to_string(z));
+        checker.addCollisionObject(link_names.back(), 0, obj_shapes, obj_poses);
+
+        location[link_names.back()] = Eigen::Isometry3d::Identity();
+        location[link_names.back()].translation() = Eigen::Vector3d(
+            static_cast<double>(x) * delta, static_cast<double>(y) * delta, static_cast<double>(z) * delta);
+      }
+    }
+  }
+
+  checker.setActiveCollisionObjects(link_names);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  checker.setCollisionObjectsTransform(location);
+}
+
+/** @brief Add a row of static spheres and a sphere which is swept past all of them */
+inline void addCollisionObjects(ContinuousContactManager& checker)
+{
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    CollisionShapesConst obj_shapes;
+    tesseract_common::VectorIsometry3d obj_poses;
+    obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+    obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+    std::string link_name = "static_sphere_link_" + std::to_string(i);
+    checker.addCollisionObject(link_name, 0, obj_shapes, obj_poses);
+
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(static_cast<double>(i), 0, 0);
+    checker.setCollisionObjectsTransform(link_name, pose);
+  }
+
+  CollisionShapesConst obj_shapes;
+  tesseract_common::VectorIsometry3d obj_poses;
+  obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+  obj_poses.push_back(Eigen::Isometry3d::Identity());
+  checker.addCollisionObject("moving_sphere_link", 0, obj_shapes, obj_poses);
+
+  checker.setActiveCollisionObjects({ "moving_sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+  Eigen::Isometry3d end_pose = Eigen::Isometry3d::Identity();
+  start_pose.translation() = Eigen::Vector3d(-0.5, 0.3, 0);
+  end_pose.translation() = Eigen::Vector3d(3.5, 0.3, 0);
+  checker.setCollisionObjectsTransform("moving_sphere_link", start_pose, end_pose);
+}
+
+/**
+ * @brief Check the results of LIMITED requests against the results of an ALL request
+ * @param contact_test Function that runs the contact test for the provided request
+ */
+template <typename ContactTestFn>
+inline void checkLimitedResults(const ContactTestFn& contact_test)
+{
+  ContactResultMap all_results;
+  contact_test(all_results, ContactRequest(ContactTestType::ALL));
+  ContactResultVector all_vector;
+  const std::size_t num_all = flattenCopyResults(all_results, all_vector);
+  ASSERT_GT(all_results.size(), 2u);
+
+  // Without limits LIMITED is the same as ALL
+  {
+    ContactResultMap results;
+    contact_test(results, ContactRequest(ContactTestType::LIMITED));
+    ContactResultVector result_vector;
+    EXPECT_EQ(flattenCopyResults(results, result_vector), num_all);
+    EXPECT_EQ(results.size(), all_results.size());
+  }
+
+  // The search stops once the global limit is reached
+  {
+    ContactRequest request(ContactTestType::LIMITED);
+    request.contact_limit = 2;
+
+    ContactResultMap results;
+    contact_test(results, request);
+    ContactResultVector result_vector;
+    EXPECT_EQ(flattenCopyResults(results, result_vector), 2u);
+    for (const auto& result : results)
+      EXPECT_TRUE(all_results.find(result.first) != all_results.end());
+  }
+
+  // A limit larger than the number of contacts returns all contacts
+  {
+    ContactRequest request(ContactTestType::LIMITED);
+    request.contact_limit = static_cast<long>(num_all) + 10;
+
+    ContactResultMap results;
+    contact_test(results, request);
+    ContactResultVector result_vector;
+    EXPECT_EQ(flattenCopyResults(results, result_vector), num_all);
+  }
+
+  // Every pair is reported but with at most pair_contact_limit contacts each
+  for (long pair_contact_limit = 1; pair_contact_limit <= 2; ++pair_contact_limit)
+  {
+    ContactRequest request(ContactTestType::LIMITED);
+    request.pair_contact_limit = pair_contact_limit;
+
+    ContactResultMap results;
+    contact_test(results, request);
+    EXPECT_EQ(results.size(), all_results.size());
+    for (const auto& result : results)
+    {
+      auto it = all_results.find(result.first);
+      ASSERT_TRUE(it != all_results.end());
+      EXPECT_EQ(result.second.size(),
+                std::min(it->second.size(), static_cast<std::size_t>(request.pair_contact_limit)));
+    }
+  }
+}
+}  // namespace detail
+
+inline void runTest(DiscreteContactManager& checker)
+{
+  detail::addCollisionObjects(checker);
+
+  // The pair contact limit must trim pairs with several contacts
+  ContactResultMap all_results;
+  checker.contactTest(all_results, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(std::any_of(all_results.begin(), all_results.end(), [](const ContactResultMap::value_type& result) {
+    return result.second.size() > 2;
+  }));
+
+  detail::checkLimitedResults(
+      [&checker](ContactResultMap& results, const ContactRequest& request) { checker.contactTest(results, request); });
+
+  // The id keyed results respect the same limits
+  ContactRequest request(ContactTestType::LIMITED);
+  request.contact_limit = 2;
+
+  ContactResultIdMap results;
+  checker.contactTest(results, request);
+  std::size_t num_contacts = 0;
+  for (const auto& result : results)
+    num_contacts += result.second.size();
+  EXPECT_EQ(num_contacts, 2u);
+}
+
+inline void runTest(ContinuousContactManager& checker)
+{
+  detail::addCollisionObjects(checker);
+  detail::checkLimitedResults(
+      [&checker](ContactResultMap& results, const ContactRequest& request) { checker.contactTest(results, request); });
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_LIMITED_CONTACT_TEST_UNIT_HPP
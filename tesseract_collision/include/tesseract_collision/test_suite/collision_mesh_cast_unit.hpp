@@ -0,0 +1,96 @@
+#ifndef TESSERACT_COLLISION_COLLISION_MESH_CAST_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_MESH_CAST_UNIT_HPP
+
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+inline void addCollisionObjects(ContinuousContactManager& checker, int& num_triangles)
+{
+  ////////////////////////////////////////
+  // Add static mesh sphere to checker
+  ////////////////////////////////////////
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  auto faces = std::make_shared<Eigen::VectorXi>();
+  int num_faces =
+      loadSimplePlyFile(std::string(TESSERACT_SUPPORT_DIR) + "/meshes/sphere_p25m.ply", *vertices, *faces, true);
+  EXPECT_GT(num_faces, 0);
+  num_triangles = num_faces;
+
+  CollisionShapesConst obj1_shapes;
+  tesseract_common::VectorIsometry3d obj1_poses;
+  obj1_shapes.push_back(std::make_shared<tesseract_geometry::Mesh>(vertices, faces));
+  obj1_poses.push_back(Eigen::Isometry3d::Identity());
+  checker.addCollisionObject("static_mesh_link", 0, obj1_shapes, obj1_poses);
+
+  ////////////////////////////////////////////////////////////////////
+  // Add moving mesh sphere to checker, with a box as the second shape
+  ////////////////////////////////////////////////////////////////////
+  CollisionShapesConst obj2_shapes;
+  tesseract_common::VectorIsometry3d obj2_poses;
+  obj2_shapes.push_back(std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1));
+  obj2_poses.push_back(Eigen::Isometry3d::Identity());
+  obj2_poses.back().translation() = Eigen::Vector3d(0, 0, 1);
+  obj2_shapes.push_back(std::make_shared<tesseract_geometry::Mesh>(vertices, faces));
+  obj2_poses.push_back(Eigen::Isometry3d::Identity());
+  checker.addCollisionObject("moving_mesh_link", 0, obj2_shapes, obj2_poses);
+}
+}  // namespace detail
+
+inline void runTest(ContinuousContactManager& checker)
+{
+  int num_triangles = 0;
+  detail::addCollisionObjects(checker, num_triangles);
+
+  checker.setActiveCollisionObjects({ "moving_mesh_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // The moving sphere is swept through the static sphere
+  {
+    Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+    Eigen::Isometry3d end_pose = Eigen::Isometry3d::Identity();
+    start_pose.translation() = Eigen::Vector3d(-2, 0, 0);
+    end_pose.translation() = Eigen::Vector3d(2, 0, 0);
+    checker.setCollisionObjectsTransform("moving_mesh_link", start_pose, end_pose);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+    ContactResultVector result_vector;
+    flattenMoveResults(std::move(result), result_vector);
+
+    ASSERT_EQ(result_vector.size(), 1u);
+    EXPECT_LT(result_vector[0].distance, 0);
+
+    int static_idx = (result_vector[0].link_names[0] == "static_mesh_link") ? 0 : 1;
+    int moving_idx = 1 - static_idx;
+    EXPECT_EQ(result_vector[0].shape_id[static_idx], 0);
+    EXPECT_EQ(result_vector[0].shape_id[moving_idx], 1);
+    EXPECT_GE(result_vector[0].subshape_id[static_idx], 0);
+    EXPECT_LT(result_vector[0].subshape_id[static_idx], num_triangles);
+    EXPECT_GE(result_vector[0].subshape_id[moving_idx], 0);
+    EXPECT_LT(result_vector[0].subshape_id[moving_idx], num_triangles);
+  }
+
+  // The moving sphere is swept past the static sphere
+  {
+    Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+    Eigen::Isometry3d end_pose = Eigen::Isometry3d::Identity();
+    start_pose.translation() = Eigen::Vector3d(-2, 1, 0);
+    end_pose.translation() = Eigen::Vector3d(2, 1, 0);
+    checker.setCollisionObjectsTransform("moving_mesh_link", start_pose, end_pose);
+
+    ContactResultMap result;
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    EXPECT_TRUE(result.empty());
+  }
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_MESH_CAST_UNIT_HPP
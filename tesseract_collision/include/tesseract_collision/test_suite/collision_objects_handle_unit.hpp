@@ -0,0 +1,114 @@
+#ifndef TESSERACT_COLLISION_COLLISION_OBJECTS_HANDLE_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_OBJECTS_HANDLE_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+inline void addCollisionObject(DiscreteContactManager& checker, const std::string& name)
+{
+  CollisionShapesConst obj_shapes;
+  tesseract_common::VectorIsometry3d obj_poses;
+  obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+  obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+  checker.addCollisionObject(name, 0, obj_shapes, obj_poses);
+}
+
+/** @brief Poses along the x axis where only the spheres with neighboring indices are in contact */
+inline tesseract_common::VectorIsometry3d getPoses(std::size_t size, double spacing)
+{
+  tesseract_common::VectorIsometry3d poses;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(spacing * static_cast<double>(i), 0, 0);
+    poses.push_back(pose);
+  }
+  return poses;
+}
+
+inline ContactResultMap runContactTest(DiscreteContactManager& checker)
+{
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  return result;
+}
+}  // namespace detail
+
+/**
+ * @brief Check setting the transforms using a collision objects handle matches setting them by name, including when
+ * collision objects are added or removed after the handle is created
+ */
+inline void runTest(DiscreteContactManager& checker)
+{
+  std::vector<std::string> link_names = { "link_a", "link_b", "link_c", "missing_link", "link_d" };
+  detail::addCollisionObject(checker, "link_a");
+  detail::addCollisionObject(checker, "link_b");
+  detail::addCollisionObject(checker, "link_c");
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  // link_d is added after the handle is created, so this handle skips it like missing_link
+  CollisionObjectsHandle stale_handle = checker.createCollisionObjectsHandle(link_names);
+  EXPECT_EQ(stale_handle.names, link_names);
+  detail::addCollisionObject(checker, "link_d");
+
+  CollisionObjectsHandle handle = checker.createCollisionObjectsHandle(link_names);
+  EXPECT_EQ(handle.names, link_names);
+
+  // Neighbors are in contact
+  checker.setCollisionObjectsTransform(handle, detail::getPoses(link_names.size(), 0.4));
+  ContactResultMap result = detail::runContactTest(checker);
+  EXPECT_EQ(result.size(), 2u);
+  EXPECT_TRUE(result.find(getObjectPairKey("link_a", "link_b")) != result.end());
+  EXPECT_TRUE(result.find(getObjectPairKey("link_b", "link_c")) != result.end());
+
+  checker.setCollisionObjectsTransform(link_names, detail::getPoses(link_names.size(), 0.4));
+  ContactResultMap expected_result = detail::runContactTest(checker);
+  EXPECT_EQ(result.size(), expected_result.size());
+
+  // Move link_d next to link_c, the stale handle does not move it
+  tesseract_common::VectorIsometry3d poses = detail::getPoses(link_names.size(), 0.4);
+  poses.back().translation().x() = 1.2;
+  checker.setCollisionObjectsTransform(stale_handle, poses);
+  EXPECT_EQ(detail::runContactTest(checker).size(), 2u);
+
+  // missing_link is skipped
+  checker.setCollisionObjectsTransform(handle, poses);
+  result = detail::runContactTest(checker);
+  EXPECT_EQ(result.size(), 3u);
+  EXPECT_TRUE(result.find(getObjectPairKey("link_c", "link_d")) != result.end());
+
+  // No contacts
+  checker.setCollisionObjectsTransform(handle, detail::getPoses(link_names.size(), 2.0));
+  EXPECT_TRUE(detail::runContactTest(checker).empty());
+
+  // A clone keeps the interned ids so the handle can be used with it
+  DiscreteContactManager::Ptr cloned_checker = checker.clone();
+  cloned_checker->setCollisionObjectsTransform(handle, poses);
+  result = detail::runContactTest(*cloned_checker);
+  EXPECT_EQ(result.size(), 3u);
+
+  // Removed objects are skipped
+  EXPECT_TRUE(checker.removeCollisionObject("link_b"));
+  checker.setCollisionObjectsTransform(handle, poses);
+  result = detail::runContactTest(checker);
+  EXPECT_EQ(result.size(), 1u);
+  EXPECT_TRUE(result.find(getObjectPairKey("link_c", "link_d")) != result.end());
+
+  // Adding the object back makes the handle use it again
+  detail::addCollisionObject(checker, "link_b");
+  checker.setCollisionObjectsTransform(handle, detail::getPoses(link_names.size(), 2.0));
+  checker.setCollisionObjectsTransform(handle, poses);
+  result = detail::runContactTest(checker);
+  EXPECT_EQ(result.size(), 3u);
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_OBJECTS_HANDLE_UNIT_HPP
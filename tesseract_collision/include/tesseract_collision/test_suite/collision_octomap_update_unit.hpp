@@ -0,0 +1,220 @@
+#ifndef TESSERACT_COLLISION_COLLISION_OCTOMAP_UPDATE_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_OCTOMAP_UPDATE_UNIT_HPP
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <octomap/octomap.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+/** @brief The centers of the eight voxels of resolution 0.1 which are pruned into a single leaf */
+inline std::vector<octomap::point3d> getBlockVoxelCenters()
+{
+  std::vector<octomap::point3d> centers;
+  for (float x : { 0.05F, 0.15F })
+    for (float y : { 0.05F, 0.15F })
+      for (float z : { 0.05F, 0.15F })
+        centers.emplace_back(x, y, z);
+
+  return centers;
+}
+
+/** @brief Set the occupancy of voxels and return their keys */
+inline octomap::KeySet setVoxelsOccupancy(octomap::OcTree& ot,
+                                          const std::vector<octomap::point3d>& centers,
+                                          bool occupied)
+{
+  octomap::KeySet changed_keys;
+  for (const auto& center : centers)
+  {
+    octomap::OcTreeKey key = ot.coordToKey(center);
+    ot.setNodeValue(key, occupied ? ot.getClampingThresMaxLog() : ot.getClampingThresMinLog());
+    changed_keys.insert(key);
+  }
+
+  ot.prune();
+  return changed_keys;
+}
+
+/** @brief Publish a copy of the octomap of an octree with the occupancy of some voxels changed */
+inline std::shared_ptr<const octomap::OcTree> updateVoxelsOccupancy(tesseract_geometry::Octree& octree,
+                                                                    const std::vector<octomap::point3d>& centers,
+                                                                    bool occupied)
+{
+  auto ot = std::make_shared<octomap::OcTree>(*octree.getOctree());
+  octree.update(ot, setVoxelsOccupancy(*ot, centers, occupied));
+  return ot;
+}
+
+template <typename ManagerType>
+inline void addCollisionObjects(ManagerType& checker, const tesseract_geometry::Octree::Ptr& octree)
+{
+  CollisionShapesConst octree_shapes;
+  tesseract_common::VectorIsometry3d octree_poses;
+  octree_shapes.push_back(octree);
+  octree_poses.push_back(Eigen::Isometry3d::Identity());
+  EXPECT_TRUE(checker.addCollisionObject("octomap_link", 0, octree_shapes, octree_poses));
+
+  CollisionShapesConst sphere_shapes;
+  tesseract_common::VectorIsometry3d sphere_poses;
+  sphere_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.02));
+  sphere_poses.push_back(Eigen::Isometry3d::Identity());
+  EXPECT_TRUE(checker.addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses));
+
+  checker.setActiveCollisionObjects({ "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0));
+}
+
+inline bool hasContact(DiscreteContactManager& checker, const Eigen::Vector3d& sphere_position)
+{
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = sphere_position;
+  checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity());
+  checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  return !result.empty();
+}
+
+inline bool hasContact(ContinuousContactManager& checker, const Eigen::Vector3d& start, const Eigen::Vector3d& end)
+{
+  Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+  Eigen::Isometry3d end_pose = Eigen::Isometry3d::Identity();
+  start_pose.translation() = start;
+  end_pose.translation() = end;
+  checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity());
+  checker.setCollisionObjectsTransform("sphere_link", start_pose, end_pose);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  return !result.empty();
+}
+}  // namespace detail
+
+/** @brief Check the contacts with an octree after changing the occupancy of its voxels */
+inline void runTest(DiscreteContactManager& checker)
+{
+  // A voxel away from the sphere so the octree is not empty
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  detail::setVoxelsOccupancy(*ot, { octomap::point3d(-0.95F, 0.05F, 0.05F) }, true);
+  auto octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+  detail::addCollisionObjects(checker, octree);
+  DiscreteContactManager::Ptr cloned_checker = checker.clone();
+
+  const Eigen::Vector3d corner_voxel(0.15, 0.15, 0.15);
+  const Eigen::Vector3d origin_voxel(0.05, 0.05, 0.05);
+  EXPECT_FALSE(detail::hasContact(checker, corner_voxel));
+  EXPECT_FALSE(checker.updateCollisionObjectGeometries("missing_link"));
+
+  // The occupied voxels are pruned into a single leaf
+  std::shared_ptr<const octomap::OcTree> previous_ot = octree->getOctree();
+  std::shared_ptr<const octomap::OcTree> updated_ot =
+      detail::updateVoxelsOccupancy(*octree, detail::getBlockVoxelCenters(), true);
+  EXPECT_EQ(updated_ot->getNumLeafNodes(), 2u);
+  EXPECT_EQ(previous_ot->getNumLeafNodes(), 1u);
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_TRUE(detail::hasContact(checker, corner_voxel));
+  EXPECT_TRUE(detail::hasContact(checker, origin_voxel));
+
+  // The cloned manager is updated separately
+  EXPECT_TRUE(cloned_checker->updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_TRUE(detail::hasContact(*cloned_checker, corner_voxel));
+
+  // Freeing a voxel splits the pruned leaf
+  detail::updateVoxelsOccupancy(*octree, { octomap::point3d(0.15F, 0.15F, 0.15F) }, false);
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_FALSE(detail::hasContact(checker, corner_voxel));
+  EXPECT_TRUE(detail::hasContact(checker, origin_voxel));
+
+  // The changes of several updates since the last one are merged
+  detail::updateVoxelsOccupancy(*octree, { octomap::point3d(0.05F, 0.05F, 0.05F) }, false);
+  detail::updateVoxelsOccupancy(*octree, { octomap::point3d(0.15F, 0.15F, 0.15F) }, true);
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_TRUE(detail::hasContact(checker, corner_voxel));
+  EXPECT_FALSE(detail::hasContact(checker, origin_voxel));
+
+  // More updates than the change log keeps process the whole octomap
+  for (std::size_t i = 0; i <= tesseract_geometry::OCTREE_MAX_CHANGE_LOG_SIZE; ++i)
+    detail::updateVoxelsOccupancy(*octree, { octomap::point3d(0.05F, 0.05F, 0.05F) }, (i % 2) == 0);
+
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_TRUE(detail::hasContact(checker, corner_voxel));
+  EXPECT_TRUE(detail::hasContact(checker, origin_voxel));
+
+  // No update since the last one
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_TRUE(detail::hasContact(checker, origin_voxel));
+
+  // Replacing the octomap, the changed keys are the voxels of both octomaps
+  std::vector<octomap::point3d> previous_centers = detail::getBlockVoxelCenters();
+  previous_centers.emplace_back(-0.95F, 0.05F, 0.05F);
+  octomap::OcTree previous_voxels(*octree->getOctree());
+  octomap::KeySet changed_keys = detail::setVoxelsOccupancy(previous_voxels, previous_centers, false);
+
+  auto new_ot = std::make_shared<octomap::OcTree>(0.1);
+  detail::setVoxelsOccupancy(*new_ot, { octomap::point3d(0.05F, 0.05F, 0.05F) }, true);
+  octree->update(new_ot, changed_keys);
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_FALSE(detail::hasContact(checker, corner_voxel));
+  EXPECT_TRUE(detail::hasContact(checker, origin_voxel));
+}
+
+/** @brief Check the contacts of a sphere moving past an octree after changing the occupancy of its voxels */
+inline void runTest(ContinuousContactManager& checker)
+{
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  detail::setVoxelsOccupancy(*ot, { octomap::point3d(-0.95F, 0.05F, 0.05F) }, true);
+  auto octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+  detail::addCollisionObjects(checker, octree);
+
+  const Eigen::Vector3d start(0.15, 0.15, 0.6);
+  const Eigen::Vector3d end(0.15, 0.15, 0.1);
+  EXPECT_FALSE(detail::hasContact(checker, start, end));
+  EXPECT_FALSE(checker.updateCollisionObjectGeometries("missing_link"));
+
+  detail::updateVoxelsOccupancy(*octree, detail::getBlockVoxelCenters(), true);
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_TRUE(detail::hasContact(checker, start, end));
+
+  detail::updateVoxelsOccupancy(*octree, detail::getBlockVoxelCenters(), false);
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  EXPECT_FALSE(detail::hasContact(checker, start, end));
+
+  // The leafs of a moving octree are swept, which also uses the updated voxels
+  detail::updateVoxelsOccupancy(*octree, detail::getBlockVoxelCenters(), true);
+  EXPECT_TRUE(checker.updateCollisionObjectGeometries("octomap_link"));
+  checker.setActiveCollisionObjects({ "octomap_link" });
+
+  Eigen::Isometry3d sphere_pose = Eigen::Isometry3d::Identity();
+  sphere_pose.translation() = Eigen::Vector3d(0.1, 0.1, 0.5);
+  checker.setCollisionObjectsTransform("sphere_link", sphere_pose);
+
+  Eigen::Isometry3d octree_end = Eigen::Isometry3d::Identity();
+  octree_end.translation() = Eigen::Vector3d(0, 0, 0.5);
+  checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity(), octree_end);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  EXPECT_FALSE(result.empty());
+
+  octree_end.translation() = Eigen::Vector3d(0.5, 0, 0);
+  checker.setCollisionObjectsTransform("octomap_link", Eigen::Isometry3d::Identity(), octree_end);
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::FIRST));
+  EXPECT_TRUE(result.empty());
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_COLLISION_OCTOMAP_UPDATE_UNIT_HPP
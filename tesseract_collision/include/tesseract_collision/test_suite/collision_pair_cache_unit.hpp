@@ -0,0 +1,313 @@
+#ifndef TESSERACT_COLLISION_COLLISION_PAIR_CACHE_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_PAIR_CACHE_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/contact_pair_cache.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+/** @brief Add a row of overlapping boxes, the first one is active */
+inline std::vector<std::string> addCollisionObjects(DiscreteContactManager& checker)
+{
+  std::vector<std::string> link_names;
+  for (int i = 0; i < 4; ++i)
+  {
+    CollisionShapesConst obj_shapes;
+    tesseract_common::VectorIsometry3d obj_poses;
+    obj_shapes.push_back(std::make_shared<tesseract_geometry::Box>(0.5, 0.5, 0.5));
+    obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+    link_names.push_back("box_link_" + std::to_string(i));
+    checker.addCollisionObject(link_names.back(), 0, obj_shapes, obj_poses);
+  }
+
+  checker.setActiveCollisionObjects({ link_names[0], link_names[1] });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  return link_names;
+}
+
+inline tesseract_common::VectorIsometry3d getPoses(double offset)
+{
+  tesseract_common::VectorIsometry3d poses;
+  for (int i = 0; i < 4; ++i)
+  {
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(0.4 * static_cast<double>(i), 0, 0);
+    if (i == 0)
+      pose.translation().y() = offset;
+    poses.push_back(pose);
+  }
+  return poses;
+}
+
+/** @brief Check the distance only results of the manager match the minimum distance of the expected results */
+inline void checkDistanceResults(DiscreteContactManager& checker,
+                                 const ContactResultMap& expected_result,
+                                 const ContactRequest& request)
+{
+  ContactDistanceResultMap result_distance;
+  checker.contactTest(result_distance, request);
+  ASSERT_EQ(result_distance.size(), expected_result.size());
+  for (const auto& dr : result_distance)
+  {
+    auto names = result_distance.getObjectNames(dr);
+    auto it = expected_result.find(getObjectPairKey(names.first, names.second));
+    ASSERT_TRUE(it != expected_result.end());
+
+    double min_distance = std::numeric_limits<double>::max();
+    for (const auto& r : it->second)
+      min_distance = std::min(min_distance, r.distance);
+    EXPECT_NEAR(dr.distance, min_distance, 1e-8);
+  }
+}
+
+/** @brief Check the results of the two managers are identical */
+inline void checkResults(DiscreteContactManager& checker,
+                         DiscreteContactManager& uncached_checker,
+                         const ContactRequest& request)
+{
+  ContactResultMap result;
+  checker.contactTest(result, request);
+  ContactResultMap expected_result;
+  uncached_checker.contactTest(expected_result, request);
+
+  ASSERT_EQ(result.size(), expected_result.size());
+  for (const auto& pair : expected_result)
+  {
+    auto it = result.find(pair.first);
+    ASSERT_TRUE(it != result.end());
+    ASSERT_EQ(it->second.size(), pair.second.size());
+    for (std::size_t i = 0; i < pair.second.size(); ++i)
+    {
+      EXPECT_NEAR(it->second[i].distance, pair.second[i].distance, 1e-8);
+      EXPECT_TRUE(it->second[i].nearest_points[0].isApprox(pair.second[i].nearest_points[0], 1e-8));
+      EXPECT_TRUE(it->second[i].nearest_points[1].isApprox(pair.second[i].nearest_points[1], 1e-8));
+      EXPECT_EQ(it->second[i].link_names, pair.second[i].link_names);
+    }
+  }
+
+  ContactResultIdMap result_ids;
+  checker.contactTest(result_ids, request);
+  EXPECT_EQ(result_ids.size(), expected_result.size());
+
+  checkDistanceResults(checker, expected_result, request);
+}
+
+/**
+ * @brief Add two spheres whose bounding boxes overlap but which are further apart than their collision margin, and a
+ * distant sphere whose pair margin raises the contact distance
+ */
+inline std::vector<std::string> addDistanceBoundCollisionObjects(DiscreteContactManager& checker)
+{
+  std::vector<std::string> link_names = { "sphere_a", "sphere_b", "sphere_c" };
+  for (const auto& link_name : link_names)
+  {
+    CollisionShapesConst obj_shapes;
+    tesseract_common::VectorIsometry3d obj_poses;
+    obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+    obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+    // The shape of sphere_b is offset so rotating the collision object moves it
+    if (link_name == "sphere_b")
+      obj_poses.back().translation() = Eigen::Vector3d(0.6, 0.6, 0);
+
+    checker.addCollisionObject(link_name, 0, obj_shapes, obj_poses);
+  }
+
+  CollisionMarginData margin_data(0.1);
+  margin_data.setPairCollisionMargin("sphere_a", "sphere_c", 0.5);
+  checker.setCollisionMarginData(margin_data);
+  return link_names;
+}
+
+inline tesseract_common::VectorIsometry3d getDistanceBoundPoses(const Eigen::Isometry3d& pose)
+{
+  Eigen::Isometry3d far_pose = Eigen::Isometry3d::Identity();
+  far_pose.translation() = Eigen::Vector3d(10, 0, 0);
+  return { Eigen::Isometry3d::Identity(), pose, far_pose };
+}
+}  // namespace detail
+
+/**
+ * @brief Check the contact pair cache replays the contacts of unchanged pairs and gives the same results as running
+ * the narrowphase
+ * @param checker The contact manager with the contact pair cache enabled
+ * @param uncached_checker The same type of contact manager with the contact pair cache disabled
+ */
+template <typename ManagerType>
+inline void runTest(ManagerType& checker, ManagerType& uncached_checker)
+{
+  EXPECT_TRUE(checker.getContactPairCache() == nullptr);
+  checker.setContactPairCacheEnabled(true);
+  ContactPairCache::ConstPtr cache = checker.getContactPairCache();
+  ASSERT_TRUE(cache != nullptr);
+
+  std::vector<std::string> link_names = detail::addCollisionObjects(checker);
+  detail::addCollisionObjects(uncached_checker);
+
+  checker.setCollisionObjectsTransform(link_names, detail::getPoses(0));
+  uncached_checker.setCollisionObjectsTransform(link_names, detail::getPoses(0));
+
+  // The first contact test runs the narrowphase for all pairs
+  ContactRequest request(ContactTestType::ALL);
+  ContactResultMap result;
+  checker.contactTest(result, request);
+  EXPECT_FALSE(result.empty());
+  EXPECT_EQ(cache->getHits(), 0u);
+  const std::size_t num_pairs = cache->getMisses();
+  EXPECT_GT(num_pairs, 0u);
+
+  // Nothing changed so all pairs are replayed
+  detail::checkResults(checker, uncached_checker, request);
+  EXPECT_EQ(cache->getMisses(), num_pairs);
+  EXPECT_EQ(cache->getHits(), 3 * num_pairs);
+
+  detail::checkResults(checker, uncached_checker, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_EQ(cache->getMisses(), num_pairs);
+
+  // Only the pairs of the moved object run the narrowphase
+  checker.setCollisionObjectsTransform(link_names, detail::getPoses(0.1));
+  uncached_checker.setCollisionObjectsTransform(link_names, detail::getPoses(0.1));
+  const std::size_t hits = cache->getHits();
+  result.clear();
+  checker.contactTest(result, request);
+  EXPECT_GT(cache->getMisses(), num_pairs);
+  EXPECT_LT(cache->getMisses(), 2 * num_pairs);
+  EXPECT_GT(cache->getHits(), hits);
+  detail::checkResults(checker, uncached_checker, request);
+
+  // Changing the margin runs the narrowphase again
+  checker.setCollisionMarginData(CollisionMarginData(0.2));
+  uncached_checker.setCollisionMarginData(CollisionMarginData(0.2));
+  std::size_t misses = cache->getMisses();
+  detail::checkResults(checker, uncached_checker, request);
+  EXPECT_GT(cache->getMisses(), misses);
+
+  // A pair which finished the search is not cached
+  ContactRequest first_request(ContactTestType::FIRST);
+  result.clear();
+  checker.contactTest(result, first_request);
+  EXPECT_EQ(result.size(), 1u);
+
+  // Adding a collision object clears the cache
+  CollisionShapesConst obj_shapes;
+  tesseract_common::VectorIsometry3d obj_poses;
+  obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+  obj_poses.push_back(Eigen::Isometry3d::Identity());
+  checker.addCollisionObject("sphere_link", 0, obj_shapes, obj_poses);
+  uncached_checker.addCollisionObject("sphere_link", 0, obj_shapes, obj_poses);
+  EXPECT_EQ(cache->size(), 0u);
+  detail::checkResults(checker, uncached_checker, request);
+
+  // The clone uses its own cache
+  DiscreteContactManager::Ptr cloned_checker = checker.clone();
+  auto* cloned = dynamic_cast<ManagerType*>(cloned_checker.get());
+  ASSERT_TRUE(cloned != nullptr);
+  ASSERT_TRUE(cloned->getContactPairCache() != nullptr);
+  EXPECT_NE(cloned->getContactPairCache(), cache);
+  detail::checkResults(*cloned, uncached_checker, request);
+
+  // A distance only query on a cold cache stores the full contacts of the missed pairs without a validator
+  checker.setCollisionObjectsTransform(link_names, detail::getPoses(0.15));
+  uncached_checker.setCollisionObjectsTransform(link_names, detail::getPoses(0.15));
+  misses = cache->getMisses();
+  ContactResultMap expected_result;
+  uncached_checker.contactTest(expected_result, request);
+  EXPECT_FALSE(request.is_valid);
+  detail::checkDistanceResults(checker, expected_result, request);
+  EXPECT_GT(cache->getMisses(), misses);
+  detail::checkResults(checker, uncached_checker, request);
+
+  checker.setContactPairCacheEnabled(false);
+  EXPECT_TRUE(checker.getContactPairCache() == nullptr);
+  detail::checkResults(checker, uncached_checker, request);
+}
+
+/**
+ * @brief Check the distance bound skips the narrowphase of pairs which moved but can not be within their collision
+ * margin and gives the same results as running the narrowphase
+ * @param checker The contact manager used with the distance bound enabled
+ * @param uncached_checker The same type of contact manager with the contact pair cache disabled
+ */
+template <typename ManagerType>
+inline void runDistanceBoundTest(ManagerType& checker, ManagerType& uncached_checker)
+{
+  // The motion bound is the translation plus the rotation angle times the radius
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(0.3, 0.4, 0);
+  EXPECT_NEAR(getMotionBound(Eigen::Isometry3d::Identity(), pose, 2.0), 0.5, 1e-12);
+  pose.rotate(Eigen::AngleAxisd(-0.1, Eigen::Vector3d::UnitZ()));
+  EXPECT_NEAR(getMotionBound(Eigen::Isometry3d::Identity(), pose, 2.0), 0.7, 1e-12);
+
+  checker.setDistanceBoundEnabled(true, 0.5);
+  ContactPairCache::ConstPtr cache = checker.getContactPairCache();
+  ASSERT_TRUE(cache != nullptr);
+  EXPECT_TRUE(cache->isDistanceBoundEnabled());
+
+  std::vector<std::string> link_names = detail::addDistanceBoundCollisionObjects(checker);
+  detail::addDistanceBoundCollisionObjects(uncached_checker);
+
+  // The spheres are about 0.35 apart which is more than their collision margin of 0.1
+  auto moveSphere = [&](const Eigen::Isometry3d& pose) {
+    checker.setCollisionObjectsTransform(link_names, detail::getDistanceBoundPoses(pose));
+    uncached_checker.setCollisionObjectsTransform(link_names, detail::getDistanceBoundPoses(pose));
+  };
+  moveSphere(Eigen::Isometry3d::Identity());
+
+  ContactRequest request(ContactTestType::ALL);
+  detail::checkResults(checker, uncached_checker, request);
+  const std::size_t misses = cache->getMisses();
+  EXPECT_GT(misses, 0u);
+
+  // Small motions can not bring the spheres within the collision margin
+  std::size_t skips = cache->getSkips();
+  pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(-0.05, 0, 0);
+  moveSphere(pose);
+  detail::checkResults(checker, uncached_checker, request);
+  EXPECT_GT(cache->getSkips(), skips);
+  EXPECT_EQ(cache->getMisses(), misses);
+
+  skips = cache->getSkips();
+  pose = Eigen::Isometry3d(Eigen::AngleAxisd(0.05, Eigen::Vector3d::UnitZ()));
+  moveSphere(pose);
+  detail::checkResults(checker, uncached_checker, request);
+  EXPECT_GT(cache->getSkips(), skips);
+  EXPECT_EQ(cache->getMisses(), misses);
+
+  // A large rotation runs the narrowphase even though the spheres stay apart
+  pose = Eigen::Isometry3d(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ()));
+  moveSphere(pose);
+  detail::checkResults(checker, uncached_checker, request);
+  EXPECT_GT(cache->getMisses(), misses);
+
+  // Moving the spheres in to contact runs the narrowphase
+  pose = Eigen::Isometry3d::Identity();
+  pose.translation() = Eigen::Vector3d(-0.3, -0.3, 0);
+  moveSphere(pose);
+  ContactResultMap result;
+  checker.contactTest(result, request);
+  EXPECT_EQ(result.size(), 1u);
+  detail::checkResults(checker, uncached_checker, request);
+
+  // The clone keeps using the distance bound
+  DiscreteContactManager::Ptr cloned_checker = checker.clone();
+  auto* cloned = dynamic_cast<ManagerType*>(cloned_checker.get());
+  ASSERT_TRUE(cloned != nullptr);
+  ASSERT_TRUE(cloned->getContactPairCache() != nullptr);
+  EXPECT_TRUE(cloned->getContactPairCache()->isDistanceBoundEnabled());
+  detail::checkResults(*cloned, uncached_checker, request);
+
+  checker.setDistanceBoundEnabled(false);
+  EXPECT_FALSE(cache->isDistanceBoundEnabled());
+  detail::checkResults(checker, uncached_checker, request);
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_PAIR_CACHE_UNIT_HPP
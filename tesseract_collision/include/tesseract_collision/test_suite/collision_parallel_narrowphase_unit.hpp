@@ -0,0 +1,147 @@
+#ifndef TESSERACT_COLLISION_COLLISION_PARALLEL_NARROWPHASE_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_PARALLEL_NARROWPHASE_UNIT_HPP
+
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+inline std::vector<std::string> addSphereGrid(DiscreteContactManager& checker, std::size_t edge_size)
+{
+  double delta = 0.45;
+
+  std::vector<std::string> link_names;
+  tesseract_common::TransformMap location;
+  for (std::size_t x = 0; x < edge_size; ++x)
+  {
+    for (std::size_t y = 0; y < edge_size; ++y)
+    {
+      for (std::size_t z = 0; z < edge_size; ++z)
+      {
+        CollisionShapesConst obj_shapes;
+        tesseract_common::VectorIsometry3d obj_poses;
+        obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+        obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+        link_names.push_back("sphere_link_" + std::to_string(x) + std::to_string(y) + std::to_string(z));
+        checker.addCollisionObject(link_names.back(), 0, obj_shapes, obj_poses);
+
+        location[link_names.back()] = Eigen::Isometry3d::Identity();
+        location[link_names.back()].translation() = Eigen::Vector3d(
+            static_cast<double>(x) * delta, static_cast<double>(y) * delta, static_cast<double>(z) * delta);
+      }
+    }
+  }
+
+  checker.setActiveCollisionObjects(link_names);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+  checker.setCollisionObjectsTransform(location);
+  return link_names;
+}
+
+inline void checkSameResults(const ContactResultMap& serial_results, const ContactResultMap& parallel_results)
+{
+  ASSERT_EQ(serial_results.size(), parallel_results.size());
+  for (const auto& serial_pair : serial_results)
+  {
+    auto it = parallel_results.find(serial_pair.first);
+    ASSERT_TRUE(it != parallel_results.end());
+    ASSERT_EQ(it->second.size(), serial_pair.second.size());
+    for (std::size_t i = 0; i < it->second.size(); ++i)
+      EXPECT_NEAR(it->second[i].distance, serial_pair.second[i].distance, 1e-6);
+  }
+}
+
+/** @brief Check the results of the id keyed container are the same, including the order of the pairs */
+inline void checkSameResults(const ContactResultIdMap& serial_results, const ContactResultIdMap& parallel_results)
+{
+  ASSERT_EQ(serial_results.size(), parallel_results.size());
+  auto it = parallel_results.begin();
+  for (const auto& serial_pair : serial_results)
+  {
+    EXPECT_EQ(it->first, serial_pair.first);
+    ASSERT_EQ(it->second.size(), serial_pair.second.size());
+    for (std::size_t i = 0; i < it->second.size(); ++i)
+      EXPECT_NEAR(it->second[i].distance, serial_pair.second[i].distance, 1e-6);
+    ++it;
+  }
+}
+}  // namespace detail
+
+inline void runTest(tesseract_collision_bullet::BulletDiscreteBVHManager& checker)
+{
+  detail::addSphereGrid(checker, 4);
+  EXPECT_EQ(checker.getNarrowphaseThreads(), 1);
+
+  // Reference results from the serial narrowphase
+  ContactResultMap serial_all;
+  checker.contactTest(serial_all, ContactRequest(ContactTestType::ALL));
+  EXPECT_FALSE(serial_all.empty());
+
+  ContactResultMap serial_closest;
+  checker.contactTest(serial_closest, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_EQ(serial_all.size(), serial_closest.size());
+
+  ContactResultMap serial_first;
+  checker.contactTest(serial_first, ContactRequest(ContactTestType::FIRST));
+  EXPECT_EQ(serial_first.size(), 1u);
+
+  ContactResultIdMap serial_ids;
+  checker.contactTest(serial_ids, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(serial_ids.size(), serial_all.size());
+
+  checker.setNarrowphaseThreads(4);
+  EXPECT_EQ(checker.getNarrowphaseThreads(), 4);
+
+  // Run twice to make sure the per thread state is reset between calls
+  for (int i = 0; i < 2; ++i)
+  {
+    ContactResultMap parallel_all;
+    checker.contactTest(parallel_all, ContactRequest(ContactTestType::ALL));
+    detail::checkSameResults(serial_all, parallel_all);
+
+    ContactResultMap parallel_closest;
+    checker.contactTest(parallel_closest, ContactRequest(ContactTestType::CLOSEST));
+    detail::checkSameResults(serial_closest, parallel_closest);
+
+    // The contact from the first pair with a contact is kept, as when using a single thread
+    ContactResultMap parallel_first;
+    checker.contactTest(parallel_first, ContactRequest(ContactTestType::FIRST));
+    ASSERT_EQ(parallel_first.size(), 1u);
+    EXPECT_EQ(parallel_first.begin()->second.size(), 1u);
+    EXPECT_TRUE(serial_first.find(parallel_first.begin()->first) != serial_first.end());
+
+    // The pairs are merged in the order they are processed when using a single thread
+    ContactResultIdMap parallel_ids;
+    checker.contactTest(parallel_ids, ContactRequest(ContactTestType::ALL));
+    detail::checkSameResults(serial_ids, parallel_ids);
+    ContactResultMap parallel_ids_converted;
+    parallel_ids.toContactResultMap(parallel_ids_converted);
+    detail::checkSameResults(serial_all, parallel_ids_converted);
+  }
+
+  // The setting should be carried over to a clone
+  DiscreteContactManager::Ptr cloned_checker = checker.clone();
+  auto* cloned_bullet_checker =
+      dynamic_cast<tesseract_collision_bullet::BulletDiscreteBVHManager*>(cloned_checker.get());
+  ASSERT_TRUE(cloned_bullet_checker != nullptr);
+  EXPECT_EQ(cloned_bullet_checker->getNarrowphaseThreads(), 4);
+
+  ContactResultMap cloned_all;
+  cloned_checker->contactTest(cloned_all, ContactRequest(ContactTestType::ALL));
+  detail::checkSameResults(serial_all, cloned_all);
+
+  // Switching back to the serial narrowphase
+  checker.setNarrowphaseThreads(1);
+  ContactResultMap serial_all_again;
+  checker.contactTest(serial_all_again, ContactRequest(ContactTestType::ALL));
+  detail::checkSameResults(serial_all, serial_all_again);
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+#endif  // TESSERACT_COLLISION_COLLISION_PARALLEL_NARROWPHASE_UNIT_HPP
@@ -0,0 +1,207 @@
+#ifndef TESSERACT_COLLISION_COLLISION_SDF_MESH_SPHERE_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_SDF_MESH_SPHERE_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_collision/core/signed_distance_field.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+/** @brief Create a closed mesh of a unit box centered at the origin */
+inline tesseract_geometry::SDFMesh::Ptr createBoxSDFMesh()
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  for (int i = 0; i < 8; ++i)
+    vertices->emplace_back((i & 1) ? 0.5 : -0.5, (i & 2) ? 0.5 : -0.5, (i & 4) ? 0.5 : -0.5);
+
+  const std::vector<int> faces = { 0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6, 0, 1, 5, 0, 5, 4,
+                                   2, 6, 7, 2, 7, 3, 0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5 };
+  auto triangles = std::make_shared<Eigen::VectorXi>(4 * 12);
+  for (std::size_t i = 0; i < 12; ++i)
+  {
+    const auto t = static_cast<Eigen::Index>(4 * i);
+    (*triangles)[t] = 3;
+    (*triangles)[t + 1] = faces[(3 * i)];
+    (*triangles)[t + 2] = faces[(3 * i) + 1];
+    (*triangles)[t + 3] = faces[(3 * i) + 2];
+  }
+
+  return std::make_shared<tesseract_geometry::SDFMesh>(vertices, triangles);
+}
+
+inline void addCollisionObjects(DiscreteContactManager& checker)
+{
+  /////////////////////////////////////////////////////////////////
+  // Add the box signed distance field mesh
+  /////////////////////////////////////////////////////////////////
+  CollisionShapesConst obj1_shapes;
+  tesseract_common::VectorIsometry3d obj1_poses;
+  obj1_shapes.push_back(createBoxSDFMesh());
+  obj1_poses.push_back(Eigen::Isometry3d::Identity());
+
+  checker.addCollisionObject("sdf_mesh_link", 0, obj1_shapes, obj1_poses);
+
+  /////////////////////////////////////////////////////////////////
+  // Add sphere to checker
+  /////////////////////////////////////////////////////////////////
+  CollisionShapesConst obj2_shapes;
+  tesseract_common::VectorIsometry3d obj2_poses;
+  obj2_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+  obj2_poses.push_back(Eigen::Isometry3d::Identity());
+
+  checker.addCollisionObject("sphere_link", 0, obj2_shapes, obj2_poses);
+
+  /////////////////////////////////////////////////////////////////
+  // Add a small box to checker, which is disabled by default
+  /////////////////////////////////////////////////////////////////
+  CollisionShapesConst obj3_shapes;
+  tesseract_common::VectorIsometry3d obj3_poses;
+  obj3_shapes.push_back(std::make_shared<tesseract_geometry::Box>(0.2, 0.2, 0.2));
+  obj3_poses.push_back(Eigen::Isometry3d::Identity());
+
+  checker.addCollisionObject("box_link", 0, obj3_shapes, obj3_poses, false);
+
+  EXPECT_TRUE(checker.getCollisionObjects().size() == 3);
+}
+
+inline void checkSphereContact(const ContactResult& contact, double distance, double tol)
+{
+  EXPECT_NEAR(contact.distance, distance, tol);
+
+  std::vector<int> idx = { 0, 1, 1 };
+  if (contact.link_names[0] != "sdf_mesh_link")
+    idx = { 1, 0, -1 };
+
+  EXPECT_NEAR(contact.nearest_points[static_cast<size_t>(idx[0])][0], 0.5, tol);
+  EXPECT_NEAR(contact.nearest_points[static_cast<size_t>(idx[0])][1], 0.0, tol);
+  EXPECT_NEAR(contact.nearest_points[static_cast<size_t>(idx[0])][2], 0.0, tol);
+  EXPECT_NEAR(contact.nearest_points[static_cast<size_t>(idx[1])][0], 0.5 + distance, tol);
+  EXPECT_NEAR(contact.nearest_points[static_cast<size_t>(idx[1])][1], 0.0, tol);
+  EXPECT_NEAR(contact.nearest_points[static_cast<size_t>(idx[1])][2], 0.0, tol);
+
+  EXPECT_NEAR(contact.normal[0], idx[2] * 1.0, tol);
+  EXPECT_NEAR(contact.normal[1], idx[2] * 0.0, tol);
+  EXPECT_NEAR(contact.normal[2], idx[2] * 0.0, tol);
+}
+}  // namespace detail
+
+/** @brief Check the signed distance field of a box against the exact signed distance */
+inline void runSignedDistanceFieldTest()
+{
+  auto mesh = detail::createBoxSDFMesh();
+  SignedDistanceField sdf(*mesh->getVertices(), *mesh->getTriangles());
+  EXPECT_NEAR(sdf.getCellSize(), 0.01, 1e-8);
+
+  int incorrect = 0;
+  for (int k = 0; k < sdf.getSize()[2]; ++k)
+  {
+    for (int j = 0; j < sdf.getSize()[1]; ++j)
+    {
+      for (int i = 0; i < sdf.getSize()[0]; ++i)
+      {
+        Eigen::Vector3d p = sdf.getOrigin() + (sdf.getCellSize() * Eigen::Vector3d(i, j, k));
+        Eigen::Vector3d q = p.cwiseAbs() - Eigen::Vector3d::Constant(0.5);
+        double expected = q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+        if (std::abs(expected - sdf.getNodeDistance(i, j, k)) > 1e-5)
+          ++incorrect;
+      }
+    }
+  }
+  EXPECT_EQ(incorrect, 0);
+
+  Eigen::Vector3d gradient;
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(0, 0, 0)), -0.5, 1e-5);
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(0.705, 0.1, 0), &gradient), 0.205, 1e-5);
+  EXPECT_TRUE(gradient.isApprox(Eigen::Vector3d::UnitX(), 1e-5));
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(0, 0.4, 0.1), &gradient), -0.1, 1e-5);
+  EXPECT_TRUE(gradient.isApprox(Eigen::Vector3d::UnitY(), 1e-5));
+
+  // Outside of the grid
+  EXPECT_NEAR(sdf.getDistance(Eigen::Vector3d(0, 0, 2), &gradient), 1.5, 1e-5);
+  EXPECT_TRUE(gradient.isApprox(Eigen::Vector3d::UnitZ(), 1e-5));
+}
+
+inline void runTest(DiscreteContactManager& checker, double tol)
+{
+  // Add collision objects
+  detail::addCollisionObjects(checker);
+
+  //////////////////////////////////////
+  // Test when object is in collision
+  //////////////////////////////////////
+  checker.setActiveCollisionObjects({ "sdf_mesh_link", "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  tesseract_common::TransformMap location;
+  location["sdf_mesh_link"] = Eigen::Isometry3d::Identity();
+  location["sphere_link"] = Eigen::Isometry3d::Identity();
+  location["sphere_link"].translation() = Eigen::Vector3d(0.6, 0, 0);
+  checker.setCollisionObjectsTransform(location);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+
+  ContactResultVector result_vector;
+  flattenResults(std::move(result), result_vector);
+
+  ASSERT_EQ(result_vector.size(), 1);
+  detail::checkSphereContact(result_vector[0], -0.15, tol);
+
+  ////////////////////////////////////////////////
+  // Test object is out side the contact distance
+  ////////////////////////////////////////////////
+  location["sphere_link"].translation() = Eigen::Vector3d(1, 0, 0);
+  result = ContactResultMap();
+  result_vector.clear();
+
+  checker.setCollisionObjectsTransform("sphere_link", location["sphere_link"]);
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  flattenResults(std::move(result), result_vector);
+
+  EXPECT_TRUE(result_vector.empty());
+
+  /////////////////////////////////////////////
+  // Test object inside the contact distance
+  /////////////////////////////////////////////
+  result = ContactResultMap();
+  result_vector.clear();
+
+  checker.setCollisionMarginData(CollisionMarginData(0.251));
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  flattenResults(std::move(result), result_vector);
+
+  ASSERT_EQ(result_vector.size(), 1);
+  detail::checkSphereContact(result_vector[0], 0.25, tol);
+
+  /////////////////////////////////////////////
+  // Test a rotated mesh and a box
+  /////////////////////////////////////////////
+  checker.setActiveCollisionObjects({ "sdf_mesh_link", "box_link" });
+  checker.enableCollisionObject("box_link");
+  checker.disableCollisionObject("sphere_link");
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  location["sdf_mesh_link"] = Eigen::Isometry3d::Identity();
+  location["sdf_mesh_link"].rotate(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitX()));
+  location["box_link"] = Eigen::Isometry3d::Identity();
+  location["box_link"].translation() = Eigen::Vector3d(0.05, 0.64, 0.02);
+  checker.setCollisionObjectsTransform(location);
+
+  result = ContactResultMap();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  flattenResults(std::move(result), result_vector);
+
+  ASSERT_EQ(result_vector.size(), 1);
+  EXPECT_NEAR(result_vector[0].distance, 0.04, tol);
+}
+
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_COLLISION_SDF_MESH_SPHERE_UNIT_HPP
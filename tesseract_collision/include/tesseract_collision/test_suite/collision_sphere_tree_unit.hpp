@@ -0,0 +1,394 @@
+#ifndef TESSERACT_COLLISION_COLLISION_SPHERE_TREE_UNIT_HPP
+#define TESSERACT_COLLISION_COLLISION_SPHERE_TREE_UNIT_HPP
+
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/sphere_tree.h>
+#include <tesseract_collision/core/common.h>
+#include <tesseract_geometry/geometries.h>
+
+namespace tesseract_collision
+{
+namespace test_suite
+{
+namespace detail
+{
+/** @brief Get the vertices and quad faces of a box centered at the origin */
+inline void getBoxFaces(const Eigen::Vector3d& size,
+                        std::shared_ptr<tesseract_common::VectorVector3d>& vertices,
+                        std::shared_ptr<Eigen::VectorXi>& faces)
+{
+  vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  for (int i = 0; i < 8; ++i)
+    vertices->push_back(0.5 * size.cwiseProduct(
+                                  Eigen::Vector3d((i & 1) ? 1.0 : -1.0, (i & 2) ? 1.0 : -1.0, (i & 4) ? 1.0 : -1.0)));
+
+  faces = std::make_shared<Eigen::VectorXi>(6 * 5);
+  *faces << 4, 0, 2, 3, 1, 4, 4, 5, 7, 6, 4, 0, 1, 5, 4, 4, 2, 6, 7, 3, 4, 0, 4, 6, 2, 4, 1, 3, 7, 5;
+}
+
+/** @brief Create a triangle mesh of a box centered at the origin */
+inline tesseract_geometry::Mesh::Ptr createBoxMesh(const Eigen::Vector3d& size)
+{
+  std::shared_ptr<tesseract_common::VectorVector3d> vertices;
+  std::shared_ptr<Eigen::VectorXi> faces;
+  getBoxFaces(size, vertices, faces);
+
+  auto triangles = std::make_shared<Eigen::VectorXi>(12 * 4);
+  for (Eigen::Index f = 0; f < 6; ++f)
+  {
+    const Eigen::Index q = 5 * f;
+    triangles->segment(8 * f, 8) << 3, (*faces)[q + 1], (*faces)[q + 2], (*faces)[q + 3], 3, (*faces)[q + 1],
+        (*faces)[q + 3], (*faces)[q + 4];
+  }
+
+  return std::make_shared<tesseract_geometry::Mesh>(vertices, triangles);
+}
+
+/** @brief Create a convex mesh of a box centered at the origin */
+inline tesseract_geometry::ConvexMesh::Ptr createBoxConvexMesh(const Eigen::Vector3d& size)
+{
+  std::shared_ptr<tesseract_common::VectorVector3d> vertices;
+  std::shared_ptr<Eigen::VectorXi> faces;
+  getBoxFaces(size, vertices, faces);
+  return std::make_shared<tesseract_geometry::ConvexMesh>(vertices, faces);
+}
+
+/** @brief The exact signed distance from a point in the frame of a shape to the shape */
+inline double getShapeDistance(const tesseract_geometry::Geometry& shape, const Eigen::Vector3d& p)
+{
+  switch (shape.getType())
+  {
+    case tesseract_geometry::GeometryType::SPHERE:
+    {
+      return p.norm() - static_cast<const tesseract_geometry::Sphere&>(shape).getRadius();
+    }
+    case tesseract_geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract_geometry::Box&>(shape);
+      Eigen::Vector3d q = p.cwiseAbs() - 0.5 * Eigen::Vector3d(box.getX(), box.getY(), box.getZ());
+      return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+    }
+    case tesseract_geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract_geometry::Capsule&>(shape);
+      const double z = std::max(std::min(p.z(), 0.5 * capsule.getLength()), -0.5 * capsule.getLength());
+      return (p - Eigen::Vector3d(0, 0, z)).norm() - capsule.getRadius();
+    }
+    case tesseract_geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract_geometry::Cylinder&>(shape);
+      Eigen::Vector2d q(p.head<2>().norm() - cylinder.getRadius(), std::abs(p.z()) - 0.5 * cylinder.getLength());
+      return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+    }
+    default:
+    {
+      throw std::runtime_error("getShapeDistance, unsupported geometry type");
+    }
+  }
+}
+
+/** @brief Check the distance from probe points around a shape to its sphere tree */
+inline void checkSphereTree(const CollisionShapeConstPtr& shape,
+                            const tesseract_geometry::Geometry& exact_shape,
+                            double tolerance,
+                            bool exact)
+{
+  Eigen::Isometry3d shape_pose = Eigen::Isometry3d::Identity();
+  shape_pose.translation() = Eigen::Vector3d(0.1, -0.2, 0.3);
+  shape_pose.rotate(Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized()));
+  SphereTree tree(shape, shape_pose, tolerance);
+  EXPECT_NEAR(tree.getTolerance(), tolerance, 1e-12);
+
+  // The root covers all spheres and the leaves cover contiguous ranges of at most the leaf size
+  ASSERT_FALSE(tree.getNodes().empty());
+  EXPECT_EQ(tree.getNodes().front().begin, 0);
+  EXPECT_EQ(tree.getNodes().front().end, tree.getSpheres().rows());
+  for (const auto& node : tree.getNodes())
+  {
+    if (node.left < 0)
+    {
+      EXPECT_LE(node.end - node.begin, SPHERE_TREE_LEAF_SIZE);
+    }
+    else
+    {
+      EXPECT_EQ(tree.getNodes()[static_cast<std::size_t>(node.left)].begin, node.begin);
+      EXPECT_EQ(tree.getNodes()[static_cast<std::size_t>(node.left)].end,
+                tree.getNodes()[static_cast<std::size_t>(node.right)].begin);
+      EXPECT_EQ(tree.getNodes()[static_cast<std::size_t>(node.right)].end, node.end);
+    }
+  }
+
+  // The collision object is also transformed, and probed with a small sphere from all directions
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation() = Eigen::Vector3d(1, 2, 3);
+  tf.rotate(Eigen::AngleAxisd(-0.7, Eigen::Vector3d(3, 1, 2).normalized()));
+  const double probe_radius = 0.001;
+  SphereTree probe(std::make_shared<tesseract_geometry::Sphere>(probe_radius), Eigen::Isometry3d::Identity());
+  for (int x = -1; x <= 1; ++x)
+  {
+    for (int y = -1; y <= 1; ++y)
+    {
+      for (int z = -1; z <= 1; ++z)
+      {
+        if (x == 0 && y == 0 && z == 0)
+          continue;
+
+        for (double r : { 0.4, 1.0 })
+        {
+          const Eigen::Vector3d p = r * Eigen::Vector3d(x, y, z).normalized();
+          const double expected = getShapeDistance(exact_shape, p) - probe_radius;
+          if (expected < 0)
+            continue;
+
+          Eigen::Isometry3d probe_tf = Eigen::Isometry3d::Identity();
+          probe_tf.translation() = tf * shape_pose * p;
+          const double distance = computeSphereTreeDistance(tree, tf, probe, probe_tf);
+          if (exact)
+          {
+            EXPECT_NEAR(distance, expected, 1e-8);
+          }
+          else
+          {
+            EXPECT_LE(distance, expected + 1e-8);
+            EXPECT_GE(distance, expected - tolerance - 1e-8);
+          }
+
+          // The order of the trees does not change the result
+          EXPECT_NEAR(computeSphereTreeDistance(probe, probe_tf, tree, tf), distance, 1e-8);
+        }
+      }
+    }
+  }
+}
+
+/** @brief Add links made of different shapes, the first one is active and moves along the x axis */
+inline std::vector<std::string> addCollisionObjects(DiscreteContactManager& checker)
+{
+  std::vector<std::string> link_names = { "moving_link", "box_link", "cylinder_link", "convex_link" };
+
+  CollisionShapesConst moving_shapes;
+  tesseract_common::VectorIsometry3d moving_poses;
+  moving_shapes.push_back(createBoxMesh(Eigen::Vector3d(0.2, 0.3, 0.4)));
+  moving_poses.push_back(Eigen::Isometry3d::Identity());
+  moving_shapes.push_back(std::make_shared<tesseract_geometry::Capsule>(0.1, 0.3));
+  moving_poses.push_back(Eigen::Isometry3d::Identity());
+  moving_poses.back().translation() = Eigen::Vector3d(0, 0.3, 0);
+  checker.addCollisionObject(link_names[0], 0, moving_shapes, moving_poses);
+
+  std::vector<CollisionShapeConstPtr> shapes = { std::make_shared<tesseract_geometry::Box>(0.2, 0.2, 0.2),
+                                                 std::make_shared<tesseract_geometry::Cylinder>(0.15, 0.3),
+                                                 createBoxConvexMesh(Eigen::Vector3d(0.3, 0.1, 0.2)) };
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    CollisionShapesConst obj_shapes = { shapes[i] };
+    tesseract_common::VectorIsometry3d obj_poses = { Eigen::Isometry3d::Identity() };
+    checker.addCollisionObject(link_names[i + 1], 0, obj_shapes, obj_poses);
+  }
+
+  checker.setActiveCollisionObjects({ link_names[0] });
+  checker.setCollisionMarginData(CollisionMarginData(0.05));
+  return link_names;
+}
+
+inline tesseract_common::VectorIsometry3d getPoses(double x, std::size_t count)
+{
+  tesseract_common::VectorIsometry3d poses;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(0.5 * static_cast<double>(i), 0.05 * static_cast<double>(i), 0);
+    if (i == 0)
+    {
+      pose.translation().x() = x;
+      pose.rotate(Eigen::AngleAxisd(x, Eigen::Vector3d::UnitZ()));
+    }
+    poses.push_back(pose);
+  }
+  return poses;
+}
+
+/** @brief Check the results of the two managers are identical */
+inline void checkResults(DiscreteContactManager& checker,
+                         DiscreteContactManager& exact_checker,
+                         const ContactRequest& request)
+{
+  ContactResultMap result;
+  checker.contactTest(result, request);
+  ContactResultMap expected_result;
+  exact_checker.contactTest(expected_result, request);
+
+  ASSERT_EQ(result.size(), expected_result.size());
+  for (const auto& pair : expected_result)
+  {
+    auto it = result.find(pair.first);
+    ASSERT_TRUE(it != result.end());
+    ASSERT_EQ(it->second.size(), pair.second.size());
+    for (std::size_t i = 0; i < pair.second.size(); ++i)
+    {
+      EXPECT_NEAR(it->second[i].distance, pair.second[i].distance, 1e-8);
+      EXPECT_EQ(it->second[i].link_names, pair.second[i].link_names);
+    }
+  }
+}
+}  // namespace detail
+
+/** @brief Check the sphere trees of the supported shapes bound the distance to the shapes */
+inline void runSphereTreeTest()
+{
+  const double tolerance = 0.02;
+
+  auto sphere = std::make_shared<tesseract_geometry::Sphere>(0.2);
+  detail::checkSphereTree(sphere, *sphere, tolerance, true);
+
+  auto box = std::make_shared<tesseract_geometry::Box>(0.3, 0.2, 0.4);
+  detail::checkSphereTree(box, *box, tolerance, true);
+  detail::checkSphereTree(detail::createBoxMesh(Eigen::Vector3d(0.3, 0.2, 0.4)), *box, tolerance, false);
+  detail::checkSphereTree(detail::createBoxConvexMesh(Eigen::Vector3d(0.3, 0.2, 0.4)), *box, tolerance, false);
+
+  auto capsule = std::make_shared<tesseract_geometry::Capsule>(0.1, 0.3);
+  detail::checkSphereTree(capsule, *capsule, tolerance, true);
+
+  auto cylinder = std::make_shared<tesseract_geometry::Cylinder>(0.15, 0.3);
+  detail::checkSphereTree(cylinder, *cylinder, tolerance, false);
+
+  // Without the primitive kernel the spheres of a box are checked
+  auto box_mesh = detail::createBoxMesh(Eigen::Vector3d(0.3, 0.2, 0.4));
+  SphereTree tree1(box_mesh, Eigen::Isometry3d::Identity(), tolerance);
+  SphereTree tree2(box_mesh, Eigen::Isometry3d::Identity(), tolerance);
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation() = Eigen::Vector3d(0.5, 0, 0);
+  double distance = computeSphereTreeDistance(tree1, Eigen::Isometry3d::Identity(), tree2, tf);
+  EXPECT_LE(distance, 0.2 + 1e-8);
+  EXPECT_GE(distance, 0.2 - (2 * tolerance) - 1e-8);
+
+  // The search stops once a distance below the threshold is found
+  EXPECT_LE(computeSphereTreeDistance(tree1, Eigen::Isometry3d::Identity(), tree2, tf, 0.5), 0.5);
+
+  // Planes and octrees are not supported
+  EXPECT_FALSE(SphereTree::isSupported(tesseract_geometry::Plane(0, 0, 1, 0)));
+  SphereTrees trees = createSphereTrees({ box, std::make_shared<tesseract_geometry::Plane>(0, 0, 1, 0) },
+                                        { Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity() },
+                                        tolerance);
+  ASSERT_EQ(trees.size(), 2);
+  EXPECT_TRUE(trees[0] != nullptr);
+  EXPECT_TRUE(trees[1] == nullptr);
+
+  // Points inside the solid shapes, meshes are only a surface
+  Eigen::Isometry3d shape_pose = Eigen::Isometry3d::Identity();
+  shape_pose.translation() = Eigen::Vector3d(0.1, -0.2, 0.3);
+  const Eigen::Vector3d inside = shape_pose * Eigen::Vector3d(0, 0, -0.05);
+  const Eigen::Vector3d outside = shape_pose * Eigen::Vector3d(0.5, 0, 0);
+  std::vector<CollisionShapeConstPtr> solids = { sphere,
+                                                 box,
+                                                 capsule,
+                                                 cylinder,
+                                                 std::make_shared<tesseract_geometry::Cone>(0.15, 0.3),
+                                                 detail::createBoxConvexMesh(Eigen::Vector3d(0.3, 0.2, 0.4)) };
+  for (const auto& solid : solids)
+  {
+    SphereTree solid_tree(solid, shape_pose, tolerance);
+    EXPECT_TRUE(solid_tree.containsPoint(inside));
+    EXPECT_FALSE(solid_tree.containsPoint(outside));
+  }
+  EXPECT_FALSE(SphereTree(box_mesh, shape_pose, tolerance).containsPoint(inside));
+}
+
+/**
+ * @brief Check the contact manager gives the same results with and without the sphere trees
+ * @param checker The contact manager to enable the sphere trees on
+ * @param exact_checker The same type of contact manager without sphere trees
+ */
+template <typename ManagerType>
+inline void runTest(ManagerType& checker, ManagerType& exact_checker)
+{
+  std::vector<std::string> link_names = detail::addCollisionObjects(checker);
+  detail::addCollisionObjects(exact_checker);
+
+  EXPECT_FALSE(checker.isSphereTreeEnabled());
+  checker.setSphereTreeEnabled(true, 0.01);
+  EXPECT_TRUE(checker.isSphereTreeEnabled());
+
+  auto cloned_checker = checker.clone();
+  auto check = [&](DiscreteContactManager& manager) {
+    for (double x = -0.6; x < 2.0; x += 0.05)
+    {
+      tesseract_common::VectorIsometry3d poses = detail::getPoses(x, link_names.size());
+      manager.setCollisionObjectsTransform(link_names, poses);
+      exact_checker.setCollisionObjectsTransform(link_names, poses);
+
+      detail::checkResults(manager, exact_checker, ContactRequest(ContactTestType::ALL));
+      detail::checkResults(manager, exact_checker, ContactRequest(ContactTestType::CLOSEST));
+    }
+  };
+  check(checker);
+  check(*cloned_checker);
+
+  // Collision objects added later also get sphere trees
+  CollisionShapesConst obj_shapes = { std::make_shared<tesseract_geometry::Sphere>(0.1) };
+  tesseract_common::VectorIsometry3d obj_poses = { Eigen::Isometry3d::Identity() };
+  link_names.emplace_back("sphere_link");
+  checker.addCollisionObject(link_names.back(), 0, obj_shapes, obj_poses);
+  exact_checker.addCollisionObject(link_names.back(), 0, obj_shapes, obj_poses);
+  check(checker);
+
+  checker.setSphereTreeEnabled(false);
+  EXPECT_FALSE(checker.isSphereTreeEnabled());
+  check(checker);
+}
+
+/**
+ * @brief Check shapes completely inside other shapes are not culled by the sphere trees
+ * @param checker The contact manager to enable the sphere trees on
+ * @param exact_checker The same type of contact manager without sphere trees
+ */
+template <typename ManagerType>
+inline void runContainedTest(ManagerType& checker, ManagerType& exact_checker)
+{
+  // Each pair of an inner and outer shape is placed at its own location
+  std::vector<std::pair<CollisionShapeConstPtr, CollisionShapeConstPtr>> pairs = {
+    { std::make_shared<tesseract_geometry::Sphere>(0.02), std::make_shared<tesseract_geometry::Cylinder>(0.3, 0.6) },
+    { std::make_shared<tesseract_geometry::Sphere>(0.02), std::make_shared<tesseract_geometry::Cone>(0.3, 0.6) },
+    { std::make_shared<tesseract_geometry::Sphere>(0.02), detail::createBoxConvexMesh(Eigen::Vector3d(0.4, 0.5, 0.6)) },
+    { std::make_shared<tesseract_geometry::Box>(0.1, 0.1, 0.1), std::make_shared<tesseract_geometry::Box>(0.5, 0.5, 0.5) }
+  };
+
+  std::vector<std::string> link_names;
+  tesseract_common::VectorIsometry3d poses;
+  for (std::size_t i = 0; i < pairs.size(); ++i)
+  {
+    Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+    pose.translation() = Eigen::Vector3d(2.0 * static_cast<double>(i), 0, 0);
+    pose.rotate(Eigen::AngleAxisd(0.2 * static_cast<double>(i), Eigen::Vector3d::UnitX()));
+
+    for (const auto& shape : { pairs[i].first, pairs[i].second })
+    {
+      link_names.push_back("link_" + std::to_string(link_names.size()));
+      poses.push_back(pose);
+      CollisionShapesConst obj_shapes = { shape };
+      tesseract_common::VectorIsometry3d obj_poses = { Eigen::Isometry3d::Identity() };
+      checker.addCollisionObject(link_names.back(), 0, obj_shapes, obj_poses);
+      exact_checker.addCollisionObject(link_names.back(), 0, obj_shapes, obj_poses);
+    }
+  }
+
+  for (DiscreteContactManager* manager : std::vector<DiscreteContactManager*>{ &checker, &exact_checker })
+  {
+    manager->setActiveCollisionObjects(link_names);
+    manager->setCollisionMarginData(CollisionMarginData(0.01));
+    manager->setCollisionObjectsTransform(link_names, poses);
+  }
+  checker.setSphereTreeEnabled(true, 0.01);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.size(), pairs.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i)
+    EXPECT_TRUE(result.find(getObjectPairKey(link_names[2 * i], link_names[(2 * i) + 1])) != result.end());
+
+  detail::checkResults(checker, exact_checker, ContactRequest(ContactTestType::ALL));
+  detail::checkResults(checker, exact_checker, ContactRequest(ContactTestType::CLOSEST));
+}
+}  // namespace test_suite
+}  // namespace tesseract_collision
+
+#endif  // TESSERACT_COLLISION_COLLISION_SPHERE_TREE_UNIT_HPP
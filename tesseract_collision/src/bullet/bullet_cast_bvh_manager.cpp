@@ -69,6 +69,7 @@ BulletCastBVHManager::BulletCastBVHManager()
   broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  dispatch_info_.contact_test_data = &contact_test_data_;
 }
 
 BulletCastBVHManager::~BulletCastBVHManager()
@@ -225,6 +226,38 @@ bool BulletCastBVHManager::disableCollisionObject(const std::string& name)
   return false;
 }
 
+bool BulletCastBVHManager::updateCollisionObjectGeometries(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  COW::Ptr& cow = it->second;
+  if (!cow->updateOctreeShapes())
+    return true;
+
+  // The cast collision object has its own octree shapes which keep the cast transforms
+  COW::Ptr& cast_cow = link2castcow_[name];
+  cast_cow->updateOctreeShapes();
+
+  if (cast_cow->getBroadphaseHandle() != nullptr)
+    updateBroadphaseAABB(cast_cow, broadphase_, dispatcher_);
+  else
+    updateBroadphaseAABB(cow, broadphase_, dispatcher_);
+
+  return true;
+}
+
+bool BulletCastBVHManager::enableCollisionObjects(const std::vector<std::string>& names)
+{
+  return setCollisionObjectsEnabled(names, true);
+}
+
+bool BulletCastBVHManager::disableCollisionObjects(const std::vector<std::string>& names)
+{
+  return setCollisionObjectsEnabled(names, false);
+}
+
 void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   // TODO: Find a way to remove this check. Need to store information in Tesseract EnvState indicating transforms with
@@ -283,6 +316,11 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name,
         assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
         static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
       }
+      else if (cow->getCollisionShape()->getShapeType() == TESSERACT_OCTREE_SHAPE_PROXYTYPE)
+      {
+        assert(dynamic_cast<TesseractOctreeShape*>(cow->getCollisionShape()) != nullptr);
+        static_cast<TesseractOctreeShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
+      }
       else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
       {
         assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
@@ -298,6 +336,15 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name,
             static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
             compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
           }
+          else if (compound->getChildShape(i)->getShapeType() == TESSERACT_OCTREE_SHAPE_PROXYTYPE)
+          {
+            assert(dynamic_cast<TesseractOctreeShape*>(compound->getChildShape(i)) != nullptr);
+            const btTransform& local_tf = compound->getChildTransform(i);
+
+            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+            static_cast<TesseractOctreeShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
+            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
+          }
           else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
           {
             assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
@@ -363,53 +410,40 @@ void BulletCastBVHManager::setActiveCollisionObjects(const std::vector<std::stri
   active_ = names;
   contact_test_data_.active = &active_;
 
-  // Now need to update the broadphase with correct aabb
+  std::vector<std::string> sorted_active = active_;
+  std::sort(sorted_active.begin(), sorted_active.end());
+
+  // Only the collision objects whose active state changed need to be moved in the broadphase
   for (auto& co : link2cow_)
   {
     COW::Ptr& cow = co.second;
+    bool is_active = isLinkActiveSorted(sorted_active, co.first);
 
-    // Need to check if a collision object is still active
-    if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
-    {
-      // Update with active
-      updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
+    // Update with active
+    if (!updateCollisionObjectFilters(is_active, cow))
+      continue;
 
-      // Get the active collision object
-      COW::Ptr& active_cow = link2castcow_[cow->getName()];
+    // Get the active collision object
+    COW::Ptr& active_cow = link2castcow_[co.first];
 
-      // Update with active
-      updateCollisionObjectFilters(active_, active_cow, broadphase_, dispatcher_);
+    // Update with active
+    updateCollisionObjectFilters(is_active, active_cow);
 
-      // Check if the link is still active.
-      if (!isLinkActive(active_, cow->getName()))
-      {
-        // Remove the active collision object from the broadphase
-        removeCollisionObjectFromBroadphase(active_cow, broadphase_, dispatcher_);
+    if (is_active)
+    {
+      // Remove the static collision object from the broadphase
+      removeCollisionObjectFromBroadphase(cow, broadphase_, dispatcher_);
 
-        // Add the active collision object to the broadphase
-        addCollisionObjectToBroadphase(cow, broadphase_, dispatcher_);
-      }
+      // Add the active collision object to the broadphase
+      addCollisionObjectToBroadphase(active_cow, broadphase_, dispatcher_);
     }
     else
     {
-      // Update with active
-      updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
-
-      // Get the active collision object
-      COW::Ptr& active_cow = link2castcow_[cow->getName()];
+      // Remove the active collision object from the broadphase
+      removeCollisionObjectFromBroadphase(active_cow, broadphase_, dispatcher_);
 
-      // Update with active
-      updateCollisionObjectFilters(active_, active_cow, broadphase_, dispatcher_);
-
-      // Check if link is now active
-      if (isLinkActive(active_, cow->getName()))
-      {
-        // Remove the static collision object from the broadphase
-        removeCollisionObjectFromBroadphase(cow, broadphase_, dispatcher_);
-
-        // Add the active collision object to the broadphase
-        addCollisionObjectToBroadphase(active_cow, broadphase_, dispatcher_);
-      }
+      // Add the static collision object to the broadphase
+      addCollisionObjectToBroadphase(cow, broadphase_, dispatcher_);
     }
   }
 }
@@ -448,6 +482,7 @@ void BulletCastBVHManager::contactTest(ContactResultMap& collisions, const Conta
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
+  contact_test_data_.num_contacts = 0;
 
   broadphase_->calculateOverlappingPairs(dispatcher_.get());
 
@@ -489,6 +524,36 @@ void BulletCastBVHManager::addCollisionObject(COW::Ptr cow)
                                                              dispatcher_.get()));
 }
 
+bool BulletCastBVHManager::setCollisionObjectsEnabled(const std::vector<std::string>& names, bool enabled)
+{
+  bool found = true;
+  std::vector<COW::Ptr> changed;
+  changed.reserve(2 * names.size());
+  for (const auto& name : names)
+  {
+    auto it = link2cow_.find(name);
+    if (it == link2cow_.end())
+    {
+      found = false;
+      continue;
+    }
+
+    if (it->second->m_enabled != enabled)
+    {
+      it->second->m_enabled = enabled;
+      changed.push_back(it->second);
+
+      const COW::Ptr& cast_cow = link2castcow_[name];
+      cast_cow->m_enabled = enabled;
+      changed.push_back(cast_cow);
+    }
+  }
+
+  // Need to clean the proxies from broadphase cache so BroadPhaseFilter gets called again.
+  cleanCollisionObjectsFromPairs(changed, broadphase_, dispatcher_);
+  return found;
+}
+
 void BulletCastBVHManager::onCollisionMarginDataChanged()
 {
   btScalar margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
@@ -60,6 +60,7 @@ BulletCastSimpleManager::BulletCastSimpleManager()
   dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  dispatch_info_.contact_test_data = &contact_test_data_;
 }
 
 ContinuousContactManager::Ptr BulletCastSimpleManager::clone() const
@@ -170,6 +171,21 @@ bool BulletCastSimpleManager::disableCollisionObject(const std::string& name)
   return false;
 }
 
+bool BulletCastSimpleManager::updateCollisionObjectGeometries(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  COW::Ptr& cow = it->second;
+  if (!cow->updateOctreeShapes())
+    return true;
+
+  // The cast collision object has its own octree shapes which keep the cast transforms
+  link2castcow_[name]->updateOctreeShapes();
+  return true;
+}
+
 void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   // TODO: Find a way to remove this check. Need to store information in Tesseract EnvState indicating transforms with
@@ -223,6 +239,11 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
         assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
         static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
       }
+      else if (cow->getCollisionShape()->getShapeType() == TESSERACT_OCTREE_SHAPE_PROXYTYPE)
+      {
+        assert(dynamic_cast<TesseractOctreeShape*>(cow->getCollisionShape()) != nullptr);
+        static_cast<TesseractOctreeShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
+      }
       else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
       {
         assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
@@ -238,6 +259,15 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
             static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
             compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
           }
+          else if (compound->getChildShape(i)->getShapeType() == TESSERACT_OCTREE_SHAPE_PROXYTYPE)
+          {
+            assert(dynamic_cast<TesseractOctreeShape*>(compound->getChildShape(i)) != nullptr);
+            const btTransform& local_tf = compound->getChildTransform(i);
+
+            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+            static_cast<TesseractOctreeShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
+            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
+          }
           else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
           {
             assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
@@ -298,6 +328,9 @@ void BulletCastSimpleManager::setActiveCollisionObjects(const std::vector<std::s
   active_ = names;
   contact_test_data_.active = &active_;
 
+  std::vector<std::string> sorted_active = active_;
+  std::sort(sorted_active.begin(), sorted_active.end());
+
   cows_.clear();
   cows_.reserve(link2cow_.size());
 
@@ -307,13 +340,14 @@ void BulletCastSimpleManager::setActiveCollisionObjects(const std::vector<std::s
     COW::Ptr& cow = co.second;
 
     // Update with request
-    updateCollisionObjectFilters(active_, cow);
+    bool is_active = isLinkActiveSorted(sorted_active, co.first);
+    updateCollisionObjectFilters(is_active, cow);
 
     // Get the cast collision object
     COW::Ptr cast_cow = link2castcow_[cow->getName()];
 
     // Update with request
-    updateCollisionObjectFilters(active_, cast_cow);
+    updateCollisionObjectFilters(is_active, cast_cow);
 
     // Add to collision object vector
     if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
@@ -361,6 +395,7 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
+  contact_test_data_.num_contacts = 0;
 
   for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
   {
@@ -39,6 +39,13 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+#include <omp.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
 
 extern btScalar gDbvtMargin;
@@ -50,25 +57,109 @@ namespace tesseract_collision_bullet
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-BulletDiscreteBVHManager::BulletDiscreteBVHManager()
+/**
+ * @brief Create a collision dispatcher configured for discrete contact checking
+ * @param coll_config The collision configuration, which must outlive the dispatcher
+ * @return The collision dispatcher
+ */
+static std::unique_ptr<btCollisionDispatcher> createDispatcher(TesseractCollisionConfiguration& coll_config)
 {
-  // Bullet adds a margin of 5cm to which is an extern variable, so we set it to zero.
-  gDbvtMargin = 0;
+  auto dispatcher = std::make_unique<btCollisionDispatcher>(&coll_config);
 
-  dispatcher_ = std::make_unique<btCollisionDispatcher>(&coll_config_);
-
-  dispatcher_->registerCollisionCreateFunc(
+  dispatcher->registerCollisionCreateFunc(
       BOX_SHAPE_PROXYTYPE,
       BOX_SHAPE_PROXYTYPE,
-      coll_config_.getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
+      coll_config.getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
+
+  dispatcher->setDispatcherFlags(dispatcher->getDispatcherFlags() &
+                                 ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+
+  return dispatcher;
+}
+
+/**
+ * @brief Merge the results of a pair found by a thread in to the results container
+ * @param cdata The contact test data of the manager
+ * @param collisions The results container
+ * @param thread_results The results found by the thread, the results of the pair are moved
+ * @param key The key of the pair
+ */
+template <typename ResultMapType, typename KeyType>
+static void mergeResults(ContactTestData& cdata,
+                         ResultMapType& collisions,
+                         ResultMapType& thread_results,
+                         const KeyType& key)
+{
+  auto thread_it = thread_results.find(key);
+  if (thread_it == thread_results.end())
+    return;
+
+  const ContactTestType type = cdata.req.type;
+  if (type == ContactTestType::LIMITED)
+  {
+    // Each thread only applied the limits to its own results so they are applied again to the combined results
+    for (auto& contact : thread_it->second)
+    {
+      if (cdata.done)
+        return;
+
+      bool found = (collisions.find(key) != collisions.end());
+      tesseract_collision::detail::storeResult(cdata, collisions, contact, key, found);
+    }
+    return;
+  }
+
+  auto it = collisions.find(key);
+  if (it == collisions.end())
+  {
+    // Swapping keeps the memory of both vectors so the thread results and the reused entries do not reallocate
+    collisions[key].swap(thread_it->second);
+    return;
+  }
+
+  if (type == ContactTestType::ALL)
+  {
+    it->second.insert(it->second.end(), thread_it->second.begin(), thread_it->second.end());
+  }
+  else if (type == ContactTestType::CLOSEST)
+  {
+    if (thread_it->second[0].distance < it->second[0].distance)
+      it->second[0] = thread_it->second[0];
+  }
+}
+
+/**
+ * @brief Merge the distance only result of a pair found by a thread in to the results container
+ * @param cdata The contact test data of the manager
+ * @param collisions The results container
+ * @param thread_results The results found by the thread
+ * @param key The key of the pair
+ */
+static void mergeDistanceResults(ContactTestData& cdata,
+                                 ContactDistanceResultMap& collisions,
+                                 const ContactDistanceResultMap& thread_results,
+                                 ObjectPairId key)
+{
+  // Only the closest contact of each pair is stored so the limits are applied again to the combined results
+  auto thread_it = thread_results.find(key);
+  if (thread_it == thread_results.end() || cdata.done)
+    return;
+
+  tesseract_collision::detail::storeDistanceResult(cdata, collisions, *thread_it);
+}
+
+BulletDiscreteBVHManager::BulletDiscreteBVHManager()
+{
+  // Bullet adds a margin of 5cm to which is an extern variable, so we set it to zero.
+  gDbvtMargin = 0;
 
-  dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
-                                  ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+  dispatcher_ = createDispatcher(coll_config_);
 
   broadphase_ = std::make_unique<btDbvtBroadphase>();
   broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  dispatch_info_.contact_test_data = &contact_test_data_;
 }
 
 BulletDiscreteBVHManager::~BulletDiscreteBVHManager()
@@ -82,6 +173,9 @@ DiscreteContactManager::Ptr BulletDiscreteBVHManager::clone() const
 {
   auto manager = std::make_shared<BulletDiscreteBVHManager>();
 
+  // Keep the interned ids so collision objects handles and id keyed results are valid for the clone
+  manager->object_ids_ = std::make_shared<ObjectIdRegistry>(*object_ids_);
+
   btScalar margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
   for (const auto& cow : link2cow_)
@@ -100,6 +194,11 @@ DiscreteContactManager::Ptr BulletDiscreteBVHManager::clone() const
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setNarrowphaseThreads(narrowphase_threads_);
+  manager->setContactPairCacheEnabled(pair_cache_ != nullptr);
+  if (pair_cache_ != nullptr && pair_cache_->isDistanceBoundEnabled())
+    manager->setDistanceBoundEnabled(true, pair_cache_->getSearchMargin());
+  manager->setSphereTreeEnabled(sphere_tree_tolerance_ > 0, sphere_tree_tolerance_);
 
   return manager;
 }
@@ -152,7 +251,10 @@ bool BulletDiscreteBVHManager::removeCollisionObject(const std::string& name)
   {
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     removeCollisionObjectFromBroadphase(it->second, broadphase_, dispatcher_);
+    id2cow_[static_cast<std::size_t>(it->second->getObjectId())] = nullptr;
     link2cow_.erase(name);
+    if (pair_cache_ != nullptr)
+      pair_cache_->clear();
     return true;
   }
 
@@ -191,6 +293,32 @@ bool BulletDiscreteBVHManager::disableCollisionObject(const std::string& name)
   return false;
 }
 
+bool BulletDiscreteBVHManager::updateCollisionObjectGeometries(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  if (it->second->updateOctreeShapes())
+  {
+    updateBroadphaseAABB(it->second, broadphase_, dispatcher_);
+    if (pair_cache_ != nullptr)
+      pair_cache_->clear();
+  }
+
+  return true;
+}
+
+bool BulletDiscreteBVHManager::enableCollisionObjects(const std::vector<std::string>& names)
+{
+  return setCollisionObjectsEnabled(names, true);
+}
+
+bool BulletDiscreteBVHManager::disableCollisionObjects(const std::vector<std::string>& names)
+{
+  return setCollisionObjectsEnabled(names, false);
+}
+
 void BulletDiscreteBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   // TODO: Find a way to remove this check. Need to store information in Tesseract EnvState indicating transforms with
@@ -220,6 +348,33 @@ void BulletDiscreteBVHManager::setCollisionObjectsTransform(const tesseract_comm
     setCollisionObjectsTransform(transform.first, transform.second);
 }
 
+CollisionObjectsHandle BulletDiscreteBVHManager::createCollisionObjectsHandle(const std::vector<std::string>& names)
+{
+  return tesseract_collision::createCollisionObjectsHandle(names, *object_ids_);
+}
+
+void BulletDiscreteBVHManager::setCollisionObjectsTransform(const CollisionObjectsHandle& handle,
+                                                            const tesseract_common::VectorIsometry3d& poses)
+{
+  if (handle.ids.size() != handle.names.size())
+  {
+    setCollisionObjectsTransform(handle.names, poses);
+    return;
+  }
+
+  assert(handle.ids.size() == poses.size());
+
+  for (std::size_t i = 0; i < handle.ids.size(); ++i)
+  {
+    const auto id = static_cast<std::size_t>(handle.ids[i]);
+    if (id < id2cow_.size() && id2cow_[id] != nullptr)
+    {
+      id2cow_[id]->setWorldTransform(convertEigenToBt(poses[i]));
+      updateBroadphaseAABB(id2cow_[id], broadphase_, dispatcher_);
+    }
+  }
+}
+
 const std::vector<std::string>& BulletDiscreteBVHManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
@@ -227,12 +382,16 @@ void BulletDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::
   active_ = names;
   contact_test_data_.active = &active_;
 
-  // Now need to update the broadphase with correct aabb
+  std::vector<std::string> sorted_active = active_;
+  std::sort(sorted_active.begin(), sorted_active.end());
+
+  // Only the collision objects whose active state changed need to be moved in the broadphase. Refreshing the proxy
+  // also removes its overlapping pairs so the BroadPhaseFilter gets called again.
   for (auto& co : link2cow_)
   {
     COW::Ptr& cow = co.second;
-    updateCollisionObjectFilters(active_, cow, broadphase_, dispatcher_);
-    refreshBroadphaseProxy(cow, broadphase_, dispatcher_);
+    if (updateCollisionObjectFilters(isLinkActiveSorted(sorted_active, co.first), cow))
+      refreshBroadphaseProxy(cow, broadphase_, dispatcher_);
   }
 }
 
@@ -262,18 +421,59 @@ const CollisionMarginData& BulletDiscreteBVHManager::getCollisionMarginData() co
 {
   return contact_test_data_.collision_margin_data;
 }
-void BulletDiscreteBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn) { contact_test_data_.fn = fn; }
+void BulletDiscreteBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn)
+{
+  contact_test_data_.fn = fn;
+  updateNarrowphaseWorkers();
+}
 IsContactAllowedFn BulletDiscreteBVHManager::getIsContactAllowedFn() const { return contact_test_data_.fn; }
 void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   contact_test_data_.res = &collisions;
+  contact_test_data_.res_ids = nullptr;
+  contact_test_data_.res_distance = nullptr;
+  contact_test_data_.req = request;
+  contact_test_data_.done = false;
+  contact_test_data_.num_contacts = 0;
+
+  btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
+
+  broadphase_->calculateOverlappingPairs(dispatcher_.get());
+
+  if (!narrowphase_workers_.empty())
+  {
+    processOverlappingPairsParallel();
+    return;
+  }
+
+  DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
+                                             contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+}
+
+void BulletDiscreteBVHManager::contactTest(ContactResultIdMap& collisions, const ContactRequest& request)
+{
+  collisions.setObjectIdRegistry(object_ids_);
+  contact_test_data_.res = nullptr;
+  contact_test_data_.res_ids = &collisions;
+  contact_test_data_.res_distance = nullptr;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
+  contact_test_data_.num_contacts = 0;
 
   btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
 
   broadphase_->calculateOverlappingPairs(dispatcher_.get());
 
+  if (!narrowphase_workers_.empty())
+  {
+    processOverlappingPairsParallel();
+    return;
+  }
+
   DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
                                              contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
@@ -282,16 +482,347 @@ void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const C
   pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
 }
 
+void BulletDiscreteBVHManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                                const std::vector<tesseract_common::TransformMap>& states,
+                                                const ContactRequest& request)
+{
+  contact_test_data_.req = request;
+  contact_test_data_.res_ids = nullptr;
+  contact_test_data_.res_distance = nullptr;
+
+  btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
+
+  // The callbacks are shared by all states, only the result container changes between states
+  DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
+                                             contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  collisions.resize(states.size());
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    setCollisionObjectsTransform(states[i]);
+
+    collisions[i].clear();
+    contact_test_data_.res = &collisions[i];
+    contact_test_data_.done = false;
+    contact_test_data_.num_contacts = 0;
+
+    broadphase_->calculateOverlappingPairs(dispatcher_.get());
+    if (!narrowphase_workers_.empty())
+      processOverlappingPairsParallel();
+    else
+      pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+  }
+}
+
+void BulletDiscreteBVHManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                                const std::vector<std::string>& names,
+                                                const tesseract_common::VectorIsometry3d& poses,
+                                                const ContactRequest& request)
+{
+  assert(!names.empty() && (poses.size() % names.size()) == 0);
+  const std::size_t num_states = (names.empty()) ? 0 : poses.size() / names.size();
+
+  // Lookup the collision objects once for all states
+  std::vector<COW::Ptr> cows;
+  cows.reserve(names.size());
+  for (const auto& name : names)
+  {
+    auto it = link2cow_.find(name);
+    cows.push_back((it != link2cow_.end()) ? it->second : nullptr);
+  }
+
+  contact_test_data_.req = request;
+  contact_test_data_.res_ids = nullptr;
+  contact_test_data_.res_distance = nullptr;
+
+  btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
+
+  // The callbacks are shared by all states, only the result container changes between states
+  DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
+                                             contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  collisions.resize(num_states);
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    const std::size_t offset = i * names.size();
+    for (std::size_t j = 0; j < cows.size(); ++j)
+    {
+      const COW::Ptr& cow = cows[j];
+      if (cow == nullptr)
+        continue;
+
+      cow->setWorldTransform(convertEigenToBt(poses[offset + j]));
+      updateBroadphaseAABB(cow, broadphase_, dispatcher_);
+    }
+
+    collisions[i].clear();
+    contact_test_data_.res = &collisions[i];
+    contact_test_data_.done = false;
+    contact_test_data_.num_contacts = 0;
+
+    broadphase_->calculateOverlappingPairs(dispatcher_.get());
+    if (!narrowphase_workers_.empty())
+      processOverlappingPairsParallel();
+    else
+      pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+  }
+}
+
 void BulletDiscreteBVHManager::addCollisionObject(COW::Ptr cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->setObjectId(object_ids_->intern(cow->getName()));
+  if (static_cast<std::size_t>(cow->getObjectId()) >= id2cow_.size())
+    id2cow_.resize(object_ids_->size());
+  id2cow_[static_cast<std::size_t>(cow->getObjectId())] = cow;
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
+  if (sphere_tree_tolerance_ > 0)
+    cow->setSphereTreeTolerance(sphere_tree_tolerance_);
+  if (pair_cache_ != nullptr)
+    pair_cache_->clear();
 
   // Add collision object to broadphase
   addCollisionObjectToBroadphase(cow, broadphase_, dispatcher_);
 }
 
+void BulletDiscreteBVHManager::contactTest(ContactDistanceResultMap& collisions, const ContactRequest& request)
+{
+  collisions.setObjectIdRegistry(object_ids_);
+  contact_test_data_.res = nullptr;
+  contact_test_data_.res_ids = nullptr;
+  contact_test_data_.res_distance = &collisions;
+  contact_test_data_.req = request;
+  contact_test_data_.done = false;
+  contact_test_data_.num_contacts = 0;
+
+  btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
+
+  broadphase_->calculateOverlappingPairs(dispatcher_.get());
+
+  if (!narrowphase_workers_.empty())
+  {
+    processOverlappingPairsParallel();
+    return;
+  }
+
+  DiscreteBroadphaseContactResultCallback cc(contact_test_data_,
+                                             contact_test_data_.collision_margin_data.getMaxCollisionMargin());
+
+  TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
+
+  pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+}
+
+void BulletDiscreteBVHManager::setNarrowphaseThreads(int num_threads)
+{
+  if (num_threads < 1)
+    num_threads = omp_get_max_threads();
+
+  narrowphase_threads_ = num_threads;
+  narrowphase_workers_.clear();
+  if (num_threads == 1)
+    return;
+
+  narrowphase_workers_.reserve(static_cast<std::size_t>(num_threads));
+  for (int i = 0; i < num_threads; ++i)
+  {
+    auto worker = std::make_unique<NarrowphaseWorker>();
+    worker->dispatcher = createDispatcher(worker->coll_config);
+    static_cast<btDispatcherInfo&>(worker->dispatch_info) = dispatch_info_;
+    worker->dispatch_info.contact_test_data = &worker->contact_test_data;
+    narrowphase_workers_.push_back(std::move(worker));
+  }
+  updateNarrowphaseWorkers();
+}
+
+int BulletDiscreteBVHManager::getNarrowphaseThreads() const { return narrowphase_threads_; }
+
+void BulletDiscreteBVHManager::setContactPairCacheEnabled(bool enabled)
+{
+  if (!enabled)
+    pair_cache_ = nullptr;
+  else if (pair_cache_ == nullptr)
+    pair_cache_ = std::make_shared<ContactPairCache>();
+
+  contact_test_data_.pair_cache = pair_cache_.get();
+  updateNarrowphaseWorkers();
+}
+
+void BulletDiscreteBVHManager::setDistanceBoundEnabled(bool enabled, double search_margin)
+{
+  if (enabled)
+    setContactPairCacheEnabled(true);
+
+  if (pair_cache_ != nullptr)
+    pair_cache_->setDistanceBound(enabled, search_margin);
+}
+
+ContactPairCache::ConstPtr BulletDiscreteBVHManager::getContactPairCache() const { return pair_cache_; }
+
+void BulletDiscreteBVHManager::setSphereTreeEnabled(bool enabled, double tolerance)
+{
+  sphere_tree_tolerance_ = (enabled) ? tolerance : 0;
+  for (auto& cow : link2cow_)
+    cow.second->setSphereTreeTolerance(sphere_tree_tolerance_);
+}
+
+bool BulletDiscreteBVHManager::isSphereTreeEnabled() const { return sphere_tree_tolerance_ > 0; }
+
+bool BulletDiscreteBVHManager::setCollisionObjectsEnabled(const std::vector<std::string>& names, bool enabled)
+{
+  bool found = true;
+  std::vector<COW::Ptr> changed;
+  changed.reserve(names.size());
+  for (const auto& name : names)
+  {
+    auto it = link2cow_.find(name);
+    if (it == link2cow_.end())
+    {
+      found = false;
+      continue;
+    }
+
+    if (it->second->m_enabled != enabled)
+    {
+      it->second->m_enabled = enabled;
+      changed.push_back(it->second);
+    }
+  }
+
+  // Need to clean the proxies from broadphase cache so BroadPhaseFilter gets called again.
+  cleanCollisionObjectsFromPairs(changed, broadphase_, dispatcher_);
+  return found;
+}
+
+void BulletDiscreteBVHManager::processOverlappingPairsParallel()
+{
+  btBroadphasePairArray& pairs = broadphase_->getOverlappingPairCache()->getOverlappingPairArray();
+  const int num_pairs = pairs.size();
+  const bool use_ids = (contact_test_data_.res_ids != nullptr);
+  const bool use_distance = (contact_test_data_.res_distance != nullptr);
+  const double contact_distance = contact_test_data_.collision_margin_data.getMaxCollisionMargin();
+
+  // The configuration of the contact test data is updated when it changes, see updateNarrowphaseWorkers
+  for (auto& worker : narrowphase_workers_)
+  {
+    ContactTestData& cdata = worker->contact_test_data;
+    cdata.req = contact_test_data_.req;
+    cdata.done = false;
+    cdata.num_contacts = 0;
+
+    worker->results.clear();
+    worker->results_ids.clear();
+    worker->results_distance.clear();
+    cdata.res = (use_ids || use_distance) ? nullptr : &worker->results;
+    cdata.res_ids = (use_ids) ? &worker->results_ids : nullptr;
+    cdata.res_distance = (use_distance) ? &worker->results_distance : nullptr;
+    worker->done_pair_index = -1;
+  }
+
+  // The worker which processed each pair, so the results are merged in the order of the pairs
+  narrowphase_pair_workers_.assign(static_cast<std::size_t>(num_pairs), -1);
+
+  // Set when a thread finishes the search so the other threads stop processing pairs
+  std::atomic<bool> cancel{ false };
+
+  const auto num_workers = static_cast<int>(narrowphase_workers_.size());
+#pragma omp parallel for num_threads(num_workers) schedule(dynamic)
+  for (int i = 0; i < num_pairs; ++i)  // NOLINT
+  {
+    if (cancel.load(std::memory_order_relaxed))
+      continue;
+
+    const int thread = omp_get_thread_num();
+    NarrowphaseWorker& worker = *narrowphase_workers_[static_cast<std::size_t>(thread)];
+    narrowphase_pair_workers_[static_cast<std::size_t>(i)] = thread;
+
+    // The collision algorithms cached in the pairs belong to the managers dispatcher, so a copy of the pair is
+    // processed using the threads dispatcher and the algorithm is released when finished.
+    btBroadphasePair pair(pairs[i]);
+    pair.m_algorithm = nullptr;
+
+    DiscreteBroadphaseContactResultCallback cc(worker.contact_test_data, contact_distance);
+    TesseractCollisionPairCallback collisionCallback(worker.dispatch_info, worker.dispatcher.get(), cc);
+    collisionCallback.processOverlap(pair);
+
+    if (pair.m_algorithm != nullptr)
+    {
+      pair.m_algorithm->~btCollisionAlgorithm();
+      worker.dispatcher->freeCollisionAlgorithm(pair.m_algorithm);
+    }
+
+    if (worker.contact_test_data.done)
+    {
+      worker.done_pair_index = i;
+      cancel.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  // The pairs are handed out in increasing order, so every pair before the one which finished the search of a thread
+  // has been processed. Merging in the order of the pairs therefore gives the results of processing them serially.
+  int end_pair = num_pairs;
+  if (contact_test_data_.req.type == ContactTestType::FIRST)
+  {
+    for (auto& worker : narrowphase_workers_)
+    {
+      if (worker->done_pair_index >= 0)
+        end_pair = std::min(end_pair, worker->done_pair_index + 1);
+    }
+  }
+
+  for (int i = 0; i < end_pair && !contact_test_data_.done; ++i)
+  {
+    const int thread = narrowphase_pair_workers_[static_cast<std::size_t>(i)];
+    if (thread < 0)
+      continue;
+
+    NarrowphaseWorker& worker = *narrowphase_workers_[static_cast<std::size_t>(thread)];
+    const auto* cow0 = static_cast<const CollisionObjectWrapper*>(pairs[i].m_pProxy0->m_clientObject);
+    const auto* cow1 = static_cast<const CollisionObjectWrapper*>(pairs[i].m_pProxy1->m_clientObject);
+    if (use_distance)
+    {
+      mergeDistanceResults(contact_test_data_,
+                           *contact_test_data_.res_distance,
+                           worker.results_distance,
+                           getObjectPairId(cow0->getObjectId(), cow1->getObjectId()));
+    }
+    else if (use_ids)
+    {
+      mergeResults(contact_test_data_,
+                   *contact_test_data_.res_ids,
+                   worker.results_ids,
+                   getObjectPairId(cow0->getObjectId(), cow1->getObjectId()));
+    }
+    else
+    {
+      mergeResults(contact_test_data_,
+                   *contact_test_data_.res,
+                   worker.results,
+                   getObjectPairKey(cow0->getName(), cow1->getName()));
+    }
+  }
+
+  if (contact_test_data_.req.type == ContactTestType::FIRST && end_pair < num_pairs)
+    contact_test_data_.done = true;
+}
+
+void BulletDiscreteBVHManager::updateNarrowphaseWorkers()
+{
+  for (auto& worker : narrowphase_workers_)
+  {
+    ContactTestData& cdata = worker->contact_test_data;
+    cdata.active = &active_;
+    cdata.collision_margin_data = contact_test_data_.collision_margin_data;
+    cdata.fn = contact_test_data_.fn;
+    cdata.pair_cache = contact_test_data_.pair_cache;
+  }
+}
+
 void BulletDiscreteBVHManager::onCollisionMarginDataChanged()
 {
   btScalar margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
@@ -302,6 +833,8 @@ void BulletDiscreteBVHManager::onCollisionMarginDataChanged()
     assert(cow->getBroadphaseHandle() != nullptr);
     updateBroadphaseAABB(cow, broadphase_, dispatcher_);
   }
+
+  updateNarrowphaseWorkers();
 }
 }  // namespace tesseract_collision_bullet
 }  // namespace tesseract_collision
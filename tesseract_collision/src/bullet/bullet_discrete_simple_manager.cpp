@@ -61,12 +61,16 @@ BulletDiscreteSimpleManager::BulletDiscreteSimpleManager()
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  dispatch_info_.contact_test_data = &contact_test_data_;
 }
 
 DiscreteContactManager::Ptr BulletDiscreteSimpleManager::clone() const
 {
   auto manager = std::make_shared<BulletDiscreteSimpleManager>();
 
+  // Keep the interned ids so collision objects handles and id keyed results are valid for the clone
+  manager->object_ids_ = std::make_shared<ObjectIdRegistry>(*object_ids_);
+
   btScalar margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin());
 
   for (const auto& cow : link2cow_)
@@ -85,6 +89,10 @@ DiscreteContactManager::Ptr BulletDiscreteSimpleManager::clone() const
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setIsContactAllowedFn(contact_test_data_.fn);
+  manager->setContactPairCacheEnabled(pair_cache_ != nullptr);
+  if (pair_cache_ != nullptr && pair_cache_->isDistanceBoundEnabled())
+    manager->setDistanceBoundEnabled(true, pair_cache_->getSearchMargin());
+  manager->setSphereTreeEnabled(sphere_tree_tolerance_ > 0, sphere_tree_tolerance_);
 
   return manager;
 }
@@ -137,7 +145,10 @@ bool BulletDiscreteSimpleManager::removeCollisionObject(const std::string& name)
   {
     cows_.erase(std::find(cows_.begin(), cows_.end(), it->second));
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    id2cow_[static_cast<std::size_t>(it->second->getObjectId())] = nullptr;
     link2cow_.erase(name);
+    if (pair_cache_ != nullptr)
+      pair_cache_->clear();
     return true;
   }
 
@@ -166,6 +177,18 @@ bool BulletDiscreteSimpleManager::disableCollisionObject(const std::string& name
   return false;
 }
 
+bool BulletDiscreteSimpleManager::updateCollisionObjectGeometries(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  if (it->second->updateOctreeShapes() && pair_cache_ != nullptr)
+    pair_cache_->clear();
+
+  return true;
+}
+
 void BulletDiscreteSimpleManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   // TODO: Find a way to remove this check. Need to store information in Tesseract EnvState indicating transforms with
@@ -189,12 +212,39 @@ void BulletDiscreteSimpleManager::setCollisionObjectsTransform(const tesseract_c
     setCollisionObjectsTransform(transform.first, transform.second);
 }
 
+CollisionObjectsHandle BulletDiscreteSimpleManager::createCollisionObjectsHandle(const std::vector<std::string>& names)
+{
+  return tesseract_collision::createCollisionObjectsHandle(names, *object_ids_);
+}
+
+void BulletDiscreteSimpleManager::setCollisionObjectsTransform(const CollisionObjectsHandle& handle,
+                                                               const tesseract_common::VectorIsometry3d& poses)
+{
+  if (handle.ids.size() != handle.names.size())
+  {
+    setCollisionObjectsTransform(handle.names, poses);
+    return;
+  }
+
+  assert(handle.ids.size() == poses.size());
+  for (std::size_t i = 0; i < handle.ids.size(); ++i)
+  {
+    const auto id = static_cast<std::size_t>(handle.ids[i]);
+    if (id < id2cow_.size() && id2cow_[id] != nullptr)
+      id2cow_[id]->setWorldTransform(convertEigenToBt(poses[i]));
+  }
+}
+
 const std::vector<std::string>& BulletDiscreteSimpleManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletDiscreteSimpleManager::setActiveCollisionObjects(const std::vector<std::string>& names)
 {
   active_ = names;
   contact_test_data_.active = &active_;
+
+  std::vector<std::string> sorted_active = active_;
+  std::sort(sorted_active.begin(), sorted_active.end());
+
   cows_.clear();
   cows_.reserve(link2cow_.size());
 
@@ -202,7 +252,8 @@ void BulletDiscreteSimpleManager::setActiveCollisionObjects(const std::vector<st
   {
     COW::Ptr& cow = co.second;
 
-    updateCollisionObjectFilters(active_, cow);
+    bool is_active = isLinkActiveSorted(sorted_active, co.first);
+    updateCollisionObjectFilters(is_active, cow);
 
     // Update collision object vector
     if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
@@ -214,6 +265,36 @@ void BulletDiscreteSimpleManager::setActiveCollisionObjects(const std::vector<st
 
 const std::vector<std::string>& BulletDiscreteSimpleManager::getActiveCollisionObjects() const { return active_; }
 
+void BulletDiscreteSimpleManager::setContactPairCacheEnabled(bool enabled)
+{
+  if (!enabled)
+    pair_cache_ = nullptr;
+  else if (pair_cache_ == nullptr)
+    pair_cache_ = std::make_shared<ContactPairCache>();
+
+  contact_test_data_.pair_cache = pair_cache_.get();
+}
+
+void BulletDiscreteSimpleManager::setDistanceBoundEnabled(bool enabled, double search_margin)
+{
+  if (enabled)
+    setContactPairCacheEnabled(true);
+
+  if (pair_cache_ != nullptr)
+    pair_cache_->setDistanceBound(enabled, search_margin);
+}
+
+ContactPairCache::ConstPtr BulletDiscreteSimpleManager::getContactPairCache() const { return pair_cache_; }
+
+void BulletDiscreteSimpleManager::setSphereTreeEnabled(bool enabled, double tolerance)
+{
+  sphere_tree_tolerance_ = (enabled) ? tolerance : 0;
+  for (auto& cow : link2cow_)
+    cow.second->setSphereTreeTolerance(sphere_tree_tolerance_);
+}
+
+bool BulletDiscreteSimpleManager::isSphereTreeEnabled() const { return sphere_tree_tolerance_ > 0; }
+
 void BulletDiscreteSimpleManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
                                                          CollisionMarginOverrideType override_type)
 {
@@ -244,9 +325,43 @@ IsContactAllowedFn BulletDiscreteSimpleManager::getIsContactAllowedFn() const {
 void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
   contact_test_data_.res = &collisions;
+  contact_test_data_.res_ids = nullptr;
+  contact_test_data_.res_distance = nullptr;
+  contact_test_data_.req = request;
+  contact_test_data_.done = false;
+  contact_test_data_.num_contacts = 0;
+
+  runContactTest();
+}
+
+void BulletDiscreteSimpleManager::contactTest(ContactResultIdMap& collisions, const ContactRequest& request)
+{
+  collisions.setObjectIdRegistry(object_ids_);
+  contact_test_data_.res = nullptr;
+  contact_test_data_.res_ids = &collisions;
+  contact_test_data_.res_distance = nullptr;
+  contact_test_data_.req = request;
+  contact_test_data_.done = false;
+  contact_test_data_.num_contacts = 0;
+
+  runContactTest();
+}
+
+void BulletDiscreteSimpleManager::contactTest(ContactDistanceResultMap& collisions, const ContactRequest& request)
+{
+  collisions.setObjectIdRegistry(object_ids_);
+  contact_test_data_.res = nullptr;
+  contact_test_data_.res_ids = nullptr;
+  contact_test_data_.res_distance = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
+  contact_test_data_.num_contacts = 0;
 
+  runContactTest();
+}
+
+void BulletDiscreteSimpleManager::runContactTest()
+{
   for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
   {
     const COW::Ptr& cow1 = *cow1_iter;
@@ -280,6 +395,36 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
 
         if (needs_collision)
         {
+          ContactPairCacheScope cache_scope(contact_test_data_);
+          if (cache_scope.isEnabled() && cache_scope.lookup(*cow1,
+                                                            -1,
+                                                            convertBtToEigen(cow1->getWorldTransform()),
+                                                            *cow2,
+                                                            -1,
+                                                            convertBtToEigen(cow2->getWorldTransform()),
+                                                            cc.m_closestDistanceThreshold))
+          {
+            if (contact_test_data_.done)
+              break;
+
+            continue;
+          }
+
+          double sphere_tree_distance{ 0 };
+          if (isSphereTreeSeparated(contact_test_data_,
+                                    *cow1,
+                                    -1,
+                                    convertBtToEigen(cow1->getWorldTransform()),
+                                    *cow2,
+                                    -1,
+                                    convertBtToEigen(cow2->getWorldTransform()),
+                                    static_cast<double>(cc.m_closestDistanceThreshold),
+                                    sphere_tree_distance))
+          {
+            cache_scope.setDistance(sphere_tree_distance);
+            continue;
+          }
+
           btCollisionObjectWrapper obB(
               nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
 
@@ -289,7 +434,8 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
           if (algorithm)
           {
             TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
-            contactPointResult.m_closestPointDistanceThreshold = cc.m_closestDistanceThreshold;
+            contactPointResult.m_closestPointDistanceThreshold =
+                static_cast<btScalar>(cache_scope.searchDistance(static_cast<double>(cc.m_closestDistanceThreshold)));
 
             // discrete collision detection query
             algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
@@ -312,8 +458,16 @@ void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, cons
 void BulletDiscreteSimpleManager::addCollisionObject(COW::Ptr cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->setObjectId(object_ids_->intern(cow->getName()));
+  if (static_cast<std::size_t>(cow->getObjectId()) >= id2cow_.size())
+    id2cow_.resize(object_ids_->size());
+  id2cow_[static_cast<std::size_t>(cow->getObjectId())] = cow;
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
+  if (sphere_tree_tolerance_ > 0)
+    cow->setSphereTreeTolerance(sphere_tree_tolerance_);
+  if (pair_cache_ != nullptr)
+    pair_cache_->clear();
 
   if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
     cows_.insert(cows_.begin(), cow);
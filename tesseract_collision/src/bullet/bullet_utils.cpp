@@ -91,53 +91,131 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
   return std::make_shared<btCapsuleShapeZ>(r, l);
 }
 
-std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Mesh::ConstPtr& geom,
-                                                       CollisionObjectWrapper* cow,
-                                                       int shape_index)
+/**
+ * @brief Get the scaling which transforms the vertices of one mesh to the vertices of another mesh
+ * @param base_mesh The mesh to scale
+ * @param mesh The mesh to compare to
+ * @param scaling The scaling which is applied to the base mesh
+ * @return True if the meshes have the same triangles and the vertices only differ by the scaling, otherwise false
+ */
+static bool getMeshScaling(const tesseract_geometry::Mesh& base_mesh,
+                           const tesseract_geometry::Mesh& mesh,
+                           btVector3& scaling)
+{
+  const Eigen::Vector3d& base_scale = base_mesh.getScale();
+  if ((base_scale.array().abs() < 1e-12).any())
+    return false;
+
+  const Eigen::VectorXi& base_triangles = *(base_mesh.getTriangles());
+  const Eigen::VectorXi& triangles = *(mesh.getTriangles());
+  if (base_triangles.size() != triangles.size() || base_triangles != triangles)
+    return false;
+
+  Eigen::Vector3d ratio = mesh.getScale().cwiseQuotient(base_scale);
+  const tesseract_common::VectorVector3d& base_vertices = *(base_mesh.getVertices());
+  const tesseract_common::VectorVector3d& vertices = *(mesh.getVertices());
+  if (base_vertices.size() != vertices.size())
+    return false;
+
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    if ((base_vertices[i].cwiseProduct(ratio) - vertices[i]).norm() > 1e-6 * std::max(1.0, vertices[i].norm()))
+      return false;
+  }
+
+  scaling = convertEigenToBt(ratio);
+  return true;
+}
+
+std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Mesh::ConstPtr& geom)
 {
   int vertice_count = geom->getVerticeCount();
   int triangle_count = geom->getTriangleCount();
-  const tesseract_common::VectorVector3d& vertices = *(geom->getVertices());
-  const Eigen::VectorXi& triangles = *(geom->getTriangles());
 
   if (vertice_count > 0 && triangle_count > 0)
   {
-    auto compound =
-        std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(triangle_count));
-    compound->setMargin(BULLET_MARGIN);  // margin: compound. seems to have no
-                                         // effect when positive but has an
-                                         // effect when negative
-
+#ifndef NDEBUG
+    const Eigen::VectorXi& triangles = *(geom->getTriangles());
     for (int i = 0; i < triangle_count; ++i)
-    {
-      btVector3 v[3];
       assert(triangles[4 * i] == 3);
-      for (unsigned x = 0; x < 3; ++x)
-      {
-        // Note: triangles structure is number of vertices that represent the triangle followed by vertex indexes
-        const Eigen::Vector3d& vertice = vertices[static_cast<size_t>(triangles[(4 * i) + (static_cast<int>(x) + 1)])];
-        for (unsigned y = 0; y < 3; ++y)
-          v[x][y] = static_cast<btScalar>(vertice[y]);
-      }
+#endif
 
-      std::shared_ptr<btCollisionShape> subshape = std::make_shared<btTriangleShapeEx>(v[0], v[1], v[2]);
-      if (subshape != nullptr)
-      {
-        subshape->setUserIndex(shape_index);
-        cow->manage(subshape);
-        subshape->setMargin(BULLET_MARGIN);
-        btTransform geomTrans;
-        geomTrans.setIdentity();
-        compound->addChildShape(geomTrans, subshape.get());
-      }
+    ShapeCache<TesseractBvhTriangleMeshShape>& cache = getMeshShapeCache();
+    ShapeCacheKey key(geom->getVertices(), geom->getTriangles());
+    TesseractBvhTriangleMeshShape::Ptr shape = cache.get(key);
+    if (shape != nullptr)
+      return std::make_shared<TesseractScaledBvhTriangleMeshShape>(shape, btVector3(1, 1, 1));
+
+    // Meshes loaded from the same resource with a different scale share the shape through the scaling
+    ShapeCacheKey resource_key;
+    if (geom->getResource() != nullptr && !geom->getResource()->getUrl().empty())
+    {
+      resource_key = ShapeCacheKey(geom->getResource()->getUrl() + "#" + std::to_string(vertice_count) + "#" +
+                                   std::to_string(triangle_count));
+      shape = cache.get(resource_key);
+      btVector3 scaling;
+      if (shape != nullptr && getMeshScaling(*shape->getMesh(), *geom, scaling))
+        return std::make_shared<TesseractScaledBvhTriangleMeshShape>(shape, scaling);
     }
 
-    return compound;
+    // The margin must be set before the shape is shared because it is used by all instances
+    shape = std::make_shared<TesseractBvhTriangleMeshShape>(geom);
+    shape->setMargin(BULLET_MARGIN);
+    shape = cache.insert(key, shape);
+    if (!resource_key.name.empty())
+      cache.insert(resource_key, shape);
+
+    return std::make_shared<TesseractScaledBvhTriangleMeshShape>(shape, btVector3(1, 1, 1));
   }
   CONSOLE_BRIDGE_logError("The mesh is empty!");
   return nullptr;
 }
 
+ShapeCache<TesseractBvhTriangleMeshShape>& getMeshShapeCache()
+{
+  static ShapeCache<TesseractBvhTriangleMeshShape> cache;
+  return cache;
+}
+
+std::shared_ptr<btCompoundShape> createTriangleCompoundShape(const TesseractScaledBvhTriangleMeshShape& shape,
+                                                             CollisionObjectWrapper& cow)
+{
+  const tesseract_geometry::Mesh& mesh = *shape.getMeshShape()->getMesh();
+  const btVector3& scaling = shape.getLocalScaling();
+  int triangle_count = mesh.getTriangleCount();
+  const tesseract_common::VectorVector3d& vertices = *(mesh.getVertices());
+  const Eigen::VectorXi& triangles = *(mesh.getTriangles());
+
+  auto compound = std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, triangle_count);
+  compound->setMargin(BULLET_MARGIN);  // margin: compound. seems to have no
+                                       // effect when positive but has an
+                                       // effect when negative
+
+  for (int i = 0; i < triangle_count; ++i)
+  {
+    btVector3 v[3];
+    assert(triangles[4 * i] == 3);
+    for (unsigned x = 0; x < 3; ++x)
+    {
+      // Note: triangles structure is number of vertices that represent the triangle followed by vertex indexes
+      const Eigen::Vector3d& vertice = vertices[static_cast<size_t>(triangles[(4 * i) + (static_cast<int>(x) + 1)])];
+      for (unsigned y = 0; y < 3; ++y)
+        v[x][y] = static_cast<btScalar>(vertice[y]) * scaling[static_cast<int>(y)];
+    }
+
+    std::shared_ptr<btCollisionShape> subshape = std::make_shared<btTriangleShapeEx>(v[0], v[1], v[2]);
+    subshape->setUserIndex(shape.getUserIndex());
+    cow.manage(subshape);
+    subshape->setMargin(BULLET_MARGIN);
+    btTransform geomTrans;
+    geomTrans.setIdentity();
+    compound->addChildShape(geomTrans, subshape.get());
+  }
+
+  compound->setUserIndex(shape.getUserIndex());
+  return compound;
+}
+
 std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::ConvexMesh::ConstPtr& geom)
 {
   int vertice_count = geom->getVerticeCount();
@@ -157,84 +235,292 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry:
   return nullptr;
 }
 
-std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Octree::ConstPtr& geom,
-                                                       CollisionObjectWrapper* cow,
-                                                       int shape_index)
+std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::SDFMesh::ConstPtr& geom)
 {
-  const octomap::OcTree& octree = *(geom->getOctree());
-  auto subshape = std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(octree.size()));
-  double occupancy_threshold = octree.getOccupancyThres();
+  // The triangles are shared with a regular mesh so the bounding volume hierarchy is cached with the other meshes
+  auto mesh = std::make_shared<tesseract_geometry::Mesh>(
+      geom->getVertices(), geom->getTriangles(), geom->getTriangleCount(), geom->getResource(), geom->getScale());
+  auto mesh_shape = std::static_pointer_cast<TesseractScaledBvhTriangleMeshShape>(createShapePrimitive(mesh));
+  if (mesh_shape == nullptr)
+    return nullptr;
 
-  switch (geom->getSubType())
+  ShapeCache<const SignedDistanceField>& cache = getSignedDistanceFieldCache();
+  ShapeCacheKey key(geom->getVertices(), geom->getTriangles());
+  SignedDistanceField::ConstPtr sdf = cache.get(key);
+  if (sdf == nullptr)
+    sdf = cache.insert(key, std::make_shared<const SignedDistanceField>(*geom->getVertices(), *geom->getTriangles()));
+
+  return std::make_shared<TesseractSDFMeshShape>(mesh_shape, sdf);
+}
+
+ShapeCache<const SignedDistanceField>& getSignedDistanceFieldCache()
+{
+  static ShapeCache<const SignedDistanceField> cache;
+  return cache;
+}
+
+/** @brief Get the half extent of the shape created for an octree leaf of the given size */
+static btScalar getOctreeLeafHalfExtent(tesseract_geometry::Octree::SubType sub_type, btScalar size)
+{
+  // The sphere outside of a leaf is checked against the box bounding the sphere
+  if (sub_type == tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE)
+    return btSqrt(2 * ((size / 2) * (size / 2)));
+
+  return size / 2;
+}
+
+/**
+ * @brief Find the leaf of an octree which contains the voxel of a key
+ * @param octree The octree
+ * @param key The key of the voxel at the maximum depth of the octree
+ * @param depth The depth of the leaf
+ * @return The leaf, nullptr if the voxel is unknown
+ */
+static const octomap::OcTreeNode* findOctreeLeaf(const octomap::OcTree& octree,
+                                                 const octomap::OcTreeKey& key,
+                                                 unsigned& depth)
+{
+  const unsigned tree_depth = octree.getTreeDepth();
+  const octomap::OcTreeNode* node = octree.getRoot();
+  depth = 0;
+  while (node != nullptr && octree.nodeHasChildren(node))
   {
-    case tesseract_geometry::Octree::SubType::BOX:
+    const unsigned child = octomap::computeChildIdx(key, static_cast<int>(tree_depth - depth - 1));
+    node = (octree.nodeChildExists(node, child)) ? octree.getNodeChild(node, child) : nullptr;
+    ++depth;
+  }
+  return node;
+}
+
+TesseractOctreeShape::TesseractOctreeShape(tesseract_geometry::Octree::ConstPtr geom, bool cast)
+  : m_geom(std::move(geom)), m_cast(cast), m_revision(m_geom->getRevision())
+{
+  m_shapeType = TESSERACT_OCTREE_SHAPE_PROXYTYPE;
+  m_cast_transform.setIdentity();
+
+  // The revision is read first so an update in between is processed again by the next update
+  m_octree = m_geom->getOctree();
+  updateLocalAabb();
+}
+
+bool TesseractOctreeShape::update()
+{
+  octomap::KeySet changed_keys;
+  std::shared_ptr<const octomap::OcTree> octree;
+  std::size_t revision{ 0 };
+  const bool has_changes = m_geom->getChangedKeys(m_revision, changed_keys, octree, revision);
+  if (revision == m_revision)
+    return false;
+
+  std::shared_ptr<const octomap::OcTree> previous = std::move(m_octree);
+  m_octree = std::move(octree);
+  m_revision = revision;
+  if (!has_changes || !updateLocalAabb(*previous, changed_keys))
+    updateLocalAabb();
+
+  return true;
+}
+
+void TesseractOctreeShape::getLeafAabb(const octomap::OcTree& octree,
+                                       const octomap::OcTreeKey& key,
+                                       unsigned depth,
+                                       btVector3& aabb_min,
+                                       btVector3& aabb_max) const
+{
+  const octomap::point3d c = octree.keyToCoord(key, depth);
+  const btVector3 center(static_cast<btScalar>(c.x()), static_cast<btScalar>(c.y()), static_cast<btScalar>(c.z()));
+  const btScalar l = getOctreeLeafHalfExtent(m_geom->getSubType(), static_cast<btScalar>(octree.getNodeSize(depth)));
+  aabb_min = center - btVector3(l, l, l);
+  aabb_max = center + btVector3(l, l, l);
+}
+
+void TesseractOctreeShape::updateLocalAabb()
+{
+  const octomap::OcTree& octree = *m_octree;
+  m_local_aabb_min.setValue(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+  m_local_aabb_max.setValue(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
+
+  for (auto it = octree.begin_leafs(), end = octree.end_leafs(); it != end; ++it)
+  {
+    if (!octree.isNodeOccupied(*it))
+      continue;
+
+    const btScalar l = getOctreeLeafHalfExtent(m_geom->getSubType(), static_cast<btScalar>(it.getSize()));
+    const btVector3 center(
+        static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ()));
+    m_local_aabb_min.setMin(center - btVector3(l, l, l));
+    m_local_aabb_max.setMax(center + btVector3(l, l, l));
+  }
+
+  // An empty octree has an empty box at its origin so the broadphase does not get an invalid box
+  if (m_local_aabb_min.x() > m_local_aabb_max.x())
+  {
+    m_local_aabb_min.setZero();
+    m_local_aabb_max.setZero();
+  }
+}
+
+bool TesseractOctreeShape::updateLocalAabb(const octomap::OcTree& previous, const octomap::KeySet& changed_keys)
+{
+  // The empty box of an empty octree can not be extended
+  if (m_local_aabb_min == m_local_aabb_max)
+    return false;
+
+  const octomap::OcTree& octree = *m_octree;
+  btVector3 leaf_min, leaf_max;
+  for (const auto& key : changed_keys)
+  {
+    unsigned depth = 0;
+    const octomap::OcTreeNode* node = findOctreeLeaf(octree, key, depth);
+    const bool occupied = (node != nullptr && octree.isNodeOccupied(node));
+    if (occupied)
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-          auto l = static_cast<btScalar>(size / 2.0);
-          auto childshape = std::make_shared<btBoxShape>(btVector3(l, l, l));
-          childshape->setUserIndex(shape_index);
-          childshape->setMargin(BULLET_MARGIN);
-          cow->manage(childshape);
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-      return subshape;
+      getLeafAabb(octree, key, depth, leaf_min, leaf_max);
+      m_local_aabb_min.setMin(leaf_min);
+      m_local_aabb_max.setMax(leaf_max);
     }
-    case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
+
+    // The bounds only shrink when a leaf on them is removed or split
+    unsigned previous_depth = 0;
+    node = findOctreeLeaf(previous, key, previous_depth);
+    if (node == nullptr || !previous.isNodeOccupied(node) || (occupied && previous_depth == depth))
+      continue;
+
+    getLeafAabb(previous, key, previous_depth, leaf_min, leaf_max);
+    for (int i = 0; i < 3; ++i)
+      if (leaf_min[i] <= m_local_aabb_min[i] || leaf_max[i] >= m_local_aabb_max[i])
+        return false;
+  }
+
+  return true;
+}
+
+void TesseractOctreeShape::processOccupiedLeafs(const btVector3& aabb_min,
+                                                const btVector3& aabb_max,
+                                                const LeafCallback& callback) const
+{
+  const octomap::OcTree& octree = *m_octree;
+  const octomap::OcTreeNode* root = octree.getRoot();
+  if (root == nullptr)
+    return;
+
+  const tesseract_geometry::Octree::SubType sub_type = m_geom->getSubType();
+  const btMatrix3x3& cast_basis = m_cast_transform.getBasis();
+  const btVector3& cast_origin = m_cast_transform.getOrigin();
+  const btMatrix3x3 abs_cast_basis = cast_basis.absolute();
+
+  struct Node
+  {
+    const octomap::OcTreeNode* node;
+    btVector3 center;
+    btScalar size;
+  };
+  std::vector<Node> stack;
+  stack.reserve(8 * octree.getTreeDepth());
+  stack.push_back(Node{ root, btVector3(0, 0, 0), static_cast<btScalar>(octree.getNodeSize(0)) });
+  while (!stack.empty())
+  {
+    const Node n = stack.back();
+    stack.pop_back();
+
+    // The occupancy of an inner node is the maximum occupancy of its children
+    if (!octree.isNodeOccupied(n.node))
+      continue;
+
+    // The bounds of a node contain the shapes of its leafs, which only extend beyond the node for the outside sphere
+    const bool leaf = !octree.nodeHasChildren(n.node);
+    const btScalar l = (leaf) ? getOctreeLeafHalfExtent(sub_type, n.size) :
+                                (n.size / 4) + getOctreeLeafHalfExtent(sub_type, n.size / 2);
+    const btVector3 extents(l, l, l);
+    btVector3 node_min = n.center - extents;
+    btVector3 node_max = n.center + extents;
+    if (m_cast)
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-          auto childshape = std::make_shared<btSphereShape>(static_cast<btScalar>((size / 2)));
-          childshape->setUserIndex(shape_index);
-          // Sphere is a special case where you do not modify the margin which is internally set to the radius
-          cow->manage(childshape);
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-      return subshape;
+      const btVector3 cast_center = cast_basis * n.center + cast_origin;
+      const btVector3 cast_extents = abs_cast_basis * extents;
+      node_min.setMin(cast_center - cast_extents);
+      node_max.setMax(cast_center + cast_extents);
     }
-    case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
+
+    if (!TestAabbAgainstAabb2(node_min, node_max, aabb_min, aabb_max))
+      continue;
+
+    if (leaf)
     {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-          auto childshape =
-              std::make_shared<btSphereShape>(static_cast<btScalar>(std::sqrt(2 * ((size / 2) * (size / 2)))));
-          childshape->setUserIndex(shape_index);
-          // Sphere is a special case where you do not modify the margin which is internally set to the radius
-          cow->manage(childshape);
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-      return subshape;
+      callback(n.center, n.size);
+      continue;
+    }
+
+    const btScalar offset = n.size / 4;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      if (!octree.nodeChildExists(n.node, i))
+        continue;
+
+      const btVector3 child_center(n.center.x() + (((i & 1) != 0) ? offset : -offset),
+                                   n.center.y() + (((i & 2) != 0) ? offset : -offset),
+                                   n.center.z() + (((i & 4) != 0) ? offset : -offset));
+      stack.push_back(Node{ octree.getNodeChild(n.node, i), child_center, n.size / 2 });
+    }
+  }
+}
+
+void TesseractOctreeShape::getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const
+{
+  const btVector3 local_center = 0.5 * (m_local_aabb_max + m_local_aabb_min);
+  const btVector3 local_extents = 0.5 * (m_local_aabb_max - m_local_aabb_min);
+  const btMatrix3x3 abs_basis = t.getBasis().absolute();
+
+  const btVector3 center = t(local_center);
+  const btVector3 extents = abs_basis * local_extents;
+  aabbMin = center - extents;
+  aabbMax = center + extents;
+
+  if (m_cast)
+  {
+    const btTransform cast_t = t * m_cast_transform;
+    const btVector3 cast_center = cast_t(local_center);
+    const btVector3 cast_extents = cast_t.getBasis().absolute() * local_extents;
+    aabbMin.setMin(cast_center - cast_extents);
+    aabbMax.setMax(cast_center + cast_extents);
+  }
+}
+
+void TesseractOctreeShape::processAllTriangles(btTriangleCallback* callback,
+                                               const btVector3& aabbMin,
+                                               const btVector3& aabbMax) const
+{
+  const tesseract_geometry::Octree::SubType sub_type = m_geom->getSubType();
+  processOccupiedLeafs(aabbMin, aabbMax, [callback, sub_type](const btVector3& center, btScalar size) {
+    const btScalar l = getOctreeLeafHalfExtent(sub_type, size);
+    btVector3 corners[8];
+    for (int i = 0; i < 8; ++i)
+      corners[i] = center + btVector3(((i & 1) != 0) ? l : -l, ((i & 2) != 0) ? l : -l, ((i & 4) != 0) ? l : -l);
+
+    // Two triangles for each face of the box
+    static const int faces[6][4] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 },
+                                     { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+    for (int f = 0; f < 6; ++f)
+    {
+      btVector3 triangle[3] = { corners[faces[f][0]], corners[faces[f][1]], corners[faces[f][2]] };
+      callback->processTriangle(triangle, 0, 2 * f);
+      triangle[1] = corners[faces[f][2]];
+      triangle[2] = corners[faces[f][3]];
+      callback->processTriangle(triangle, 0, (2 * f) + 1);
     }
+  });
+}
+
+std::shared_ptr<btCollisionShape> createShapePrimitive(const tesseract_geometry::Octree::ConstPtr& geom,
+                                                       CollisionObjectWrapper* /*cow*/,
+                                                       int /*shape_index*/)
+{
+  switch (geom->getSubType())
+  {
+    case tesseract_geometry::Octree::SubType::BOX:
+    case tesseract_geometry::Octree::SubType::SPHERE_INSIDE:
+    case tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE:
+      return std::make_shared<TesseractOctreeShape>(geom);
   }
 
   CONSOLE_BRIDGE_logError("This bullet shape type (%d) is not supported for geometry octree",
@@ -287,7 +573,7 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
     }
     case tesseract_geometry::GeometryType::MESH:
     {
-      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom), cow, shape_index);
+      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom));
       shape->setUserIndex(shape_index);
       shape->setMargin(BULLET_MARGIN);
       break;
@@ -299,6 +585,13 @@ std::shared_ptr<btCollisionShape> createShapePrimitive(const CollisionShapeConst
       shape->setMargin(BULLET_MARGIN);
       break;
     }
+    case tesseract_geometry::GeometryType::SDF_MESH:
+    {
+      shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::SDFMesh>(geom));
+      shape->setUserIndex(shape_index);
+      shape->setMargin(BULLET_MARGIN);
+      break;
+    }
     case tesseract_geometry::GeometryType::OCTREE:
     {
       shape = createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Octree>(geom), cow, shape_index);
@@ -359,10 +652,66 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
     }
   }
 
+  if (getCollisionShape() != nullptr)
+    updateBoundingRadius();
+
   btTransform trans;
   trans.setIdentity();
   setWorldTransform(trans);
 }
 
+bool CollisionObjectWrapper::updateOctreeShapes()
+{
+  bool has_octree = false;
+  if (auto* octree = dynamic_cast<TesseractOctreeShape*>(getCollisionShape()))
+  {
+    octree->update();
+    has_octree = true;
+  }
+  else if (btBroadphaseProxy::isCompound(getCollisionShape()->getShapeType()))
+  {
+    auto* compound = static_cast<btCompoundShape*>(getCollisionShape());
+    for (int i = 0; i < compound->getNumChildShapes(); ++i)
+    {
+      auto* octree = dynamic_cast<TesseractOctreeShape*>(compound->getChildShape(i));
+      if (octree == nullptr)
+        continue;
+
+      // This updates the AABB of the octree in the dynamic AABB tree of the compound
+      if (octree->update())
+        compound->updateChildTransform(i, compound->getChildTransform(i), true);
+
+      has_octree = true;
+    }
+  }
+
+  if (has_octree)
+    updateBoundingRadius();
+
+  return has_octree;
+}
+
+void CollisionObjectWrapper::updateBoundingRadius()
+{
+  btVector3 center;
+  btScalar radius{ 0 };
+  getCollisionShape()->getBoundingSphere(center, radius);
+  m_bounding_radius = static_cast<double>(center.length() + radius);
+}
+
+void CollisionObjectWrapper::setSphereTreeTolerance(double tolerance)
+{
+  if (tolerance <= 0)
+  {
+    m_sphere_trees.clear();
+    m_sphere_tree_tolerance = 0;
+  }
+  else if (m_sphere_trees.empty() || !tesseract_common::almostEqualRelativeAndAbs(tolerance, m_sphere_tree_tolerance))
+  {
+    m_sphere_trees = createSphereTrees(m_shapes, m_shape_poses, tolerance);
+    m_sphere_tree_tolerance = tolerance;
+  }
+}
+
 }  // namespace tesseract_collision_bullet
 }  // namespace tesseract_collision
@@ -46,9 +46,13 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/tesseract_collision_configuration.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 #include <tesseract_collision/bullet/tesseract_compound_collision_algorithm.h>
 #include <tesseract_collision/bullet/tesseract_compound_compound_collision_algorithm.h>
+#include <tesseract_collision/bullet/tesseract_concave_concave_collision_algorithm.h>
 #include <tesseract_collision/bullet/tesseract_convex_convex_algorithm.h>
+#include <tesseract_collision/bullet/tesseract_octree_collision_algorithm.h>
+#include <tesseract_collision/bullet/tesseract_sdf_convex_collision_algorithm.h>
 
 namespace tesseract_collision
 {
@@ -95,16 +99,37 @@ TesseractCollisionConfiguration::TesseractCollisionConfiguration(
   mem = btAlignedAlloc(sizeof(TesseractCompoundCollisionAlgorithm::SwappedCreateFunc), 16);
   m_swappedCompoundCreateFunc = new (mem) TesseractCompoundCollisionAlgorithm::SwappedCreateFunc;
 
+  mem = btAlignedAlloc(sizeof(TesseractConcaveConcaveCollisionAlgorithm::CreateFunc), 16);
+  m_concaveConcaveCreateFunc = new (mem) TesseractConcaveConcaveCollisionAlgorithm::CreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractSDFConvexCollisionAlgorithm::CreateFunc), 16);
+  m_sdfConvexCreateFunc = new (mem) TesseractSDFConvexCollisionAlgorithm::CreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractSDFConvexCollisionAlgorithm::SwappedCreateFunc), 16);
+  m_sdfConvexSwappedCreateFunc = new (mem) TesseractSDFConvexCollisionAlgorithm::SwappedCreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractOctreeCollisionAlgorithm::CreateFunc), 16);
+  m_octreeCreateFunc = new (mem) TesseractOctreeCollisionAlgorithm::CreateFunc;
+
+  mem = btAlignedAlloc(sizeof(TesseractOctreeCollisionAlgorithm::SwappedCreateFunc), 16);
+  m_octreeSwappedCreateFunc = new (mem) TesseractOctreeCollisionAlgorithm::SwappedCreateFunc;
+
   /// calculate maximum element size, big enough to fit any collision algorithm in the memory pool
   int maxSize = sizeof(TesseractConvexConvexAlgorithm);
   int maxSize2 = sizeof(btConvexConcaveCollisionAlgorithm);
   int maxSize3 = sizeof(TesseractCompoundCollisionAlgorithm);
   int maxSize4 = sizeof(TesseractCompoundCompoundCollisionAlgorithm);
+  int maxSize5 = sizeof(TesseractConcaveConcaveCollisionAlgorithm);
+  int maxSize6 = sizeof(TesseractSDFConvexCollisionAlgorithm);
+  int maxSize7 = sizeof(TesseractOctreeCollisionAlgorithm);
 
   int collisionAlgorithmMaxElementSize = btMax(maxSize, constructionInfo.m_customCollisionAlgorithmMaxElementSize);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize2);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize3);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize4);
+  collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize5);
+  collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize6);
+  collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize7);
 
   if (constructionInfo.m_persistentManifoldPool)
   {
@@ -137,5 +162,66 @@ TesseractCollisionConfiguration::TesseractCollisionConfiguration(
   }
 }
 
+TesseractCollisionConfiguration::~TesseractCollisionConfiguration()
+{
+  m_concaveConcaveCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_concaveConcaveCreateFunc);
+
+  m_sdfConvexCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_sdfConvexCreateFunc);
+
+  m_sdfConvexSwappedCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_sdfConvexSwappedCreateFunc);
+
+  m_octreeCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_octreeCreateFunc);
+
+  m_octreeSwappedCreateFunc->~btCollisionAlgorithmCreateFunc();
+  btAlignedFree(m_octreeSwappedCreateFunc);
+}
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getCollisionAlgorithmCreateFunc(int proxyType0,
+                                                                                               int proxyType1)
+{
+  // Compound shapes are processed first so the octree is checked against each child shape
+  if (proxyType0 == TESSERACT_OCTREE_SHAPE_PROXYTYPE && !btBroadphaseProxy::isCompound(proxyType1))
+    return m_octreeCreateFunc;
+
+  if (!btBroadphaseProxy::isCompound(proxyType0) && proxyType1 == TESSERACT_OCTREE_SHAPE_PROXYTYPE)
+    return m_octreeSwappedCreateFunc;
+
+  if (proxyType0 == CUSTOM_CONCAVE_SHAPE_TYPE && btBroadphaseProxy::isConvex(proxyType1))
+    return m_sdfConvexCreateFunc;
+
+  if (btBroadphaseProxy::isConvex(proxyType0) && proxyType1 == CUSTOM_CONCAVE_SHAPE_TYPE)
+    return m_sdfConvexSwappedCreateFunc;
+
+  if (btBroadphaseProxy::isConcave(proxyType0) && btBroadphaseProxy::isConcave(proxyType1))
+    return m_concaveConcaveCreateFunc;
+
+  return btDefaultCollisionConfiguration::getCollisionAlgorithmCreateFunc(proxyType0, proxyType1);
+}
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getClosestPointsAlgorithmCreateFunc(int proxyType0,
+                                                                                                   int proxyType1)
+{
+  // Compound shapes are processed first so the octree is checked against each child shape
+  if (proxyType0 == TESSERACT_OCTREE_SHAPE_PROXYTYPE && !btBroadphaseProxy::isCompound(proxyType1))
+    return m_octreeCreateFunc;
+
+  if (!btBroadphaseProxy::isCompound(proxyType0) && proxyType1 == TESSERACT_OCTREE_SHAPE_PROXYTYPE)
+    return m_octreeSwappedCreateFunc;
+
+  if (proxyType0 == CUSTOM_CONCAVE_SHAPE_TYPE && btBroadphaseProxy::isConvex(proxyType1))
+    return m_sdfConvexCreateFunc;
+
+  if (btBroadphaseProxy::isConvex(proxyType0) && proxyType1 == CUSTOM_CONCAVE_SHAPE_TYPE)
+    return m_sdfConvexSwappedCreateFunc;
+
+  if (btBroadphaseProxy::isConcave(proxyType0) && btBroadphaseProxy::isConcave(proxyType1))
+    return m_concaveConcaveCreateFunc;
+
+  return btDefaultCollisionConfiguration::getClosestPointsAlgorithmCreateFunc(proxyType0, proxyType1);
+}
 }  // namespace tesseract_collision_bullet
 }  // namespace tesseract_collision
@@ -30,7 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/tesseract_compound_collision_algorithm.h>
-#include <tesseract_collision/core/types.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 
 // LCOV_EXCL_START
 namespace tesseract_collision
@@ -118,7 +118,6 @@ public:
   btManifoldResult* m_resultOut;
   btCollisionAlgorithm** m_childCollisionAlgorithms;
   btPersistentManifold* m_sharedManifold;
-  ContactTestData* m_contact_test_data;
 
   TesseractCompoundLeafCallback(const btCollisionObjectWrapper* compoundObjWrap,
                                 const btCollisionObjectWrapper* otherObjWrap,
@@ -134,9 +133,7 @@ public:
     , m_resultOut(resultOut)
     , m_childCollisionAlgorithms(childCollisionAlgorithms)
     , m_sharedManifold(sharedManifold)
-    , m_contact_test_data(static_cast<ContactTestData*>(compoundObjWrap->m_collisionObject->getUserPointer()))
   {
-    btAssert(dynamic_cast<ContactTestData*>(compoundObjWrap->m_collisionObject->getUserPointer()) != nullptr);
   }
 
   void ProcessChildShape(const btCollisionShape* childShape, int index)
@@ -146,7 +143,7 @@ public:
         static_cast<const btCompoundShape*>(m_compoundColObjWrap->getCollisionShape());
     btAssert(index < compoundShape->getNumChildShapes());
 
-    if (m_contact_test_data->done)
+    if (isContactTestDone(m_dispatchInfo))
       return;
 
     // backup
@@ -36,7 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #define USE_LOCAL_STACK 1
 
 #include <tesseract_collision/bullet/tesseract_compound_compound_collision_algorithm.h>
-#include <tesseract_collision/core/types.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
 
 // LCOV_EXCL_START
 namespace tesseract_collision
@@ -118,8 +118,6 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
 
   btPersistentManifold* m_sharedManifold;
 
-  ContactTestData* m_contact_test_data;
-
   TesseractCompoundCompoundLeafCallback(const btCollisionObjectWrapper* compound1ObjWrap,
                                         const btCollisionObjectWrapper* compound0ObjWrap,
                                         btDispatcher* dispatcher,
@@ -135,9 +133,7 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
     , m_resultOut(resultOut)
     , m_childCollisionAlgorithmCache(childAlgorithmsCache)
     , m_sharedManifold(sharedManifold)
-    , m_contact_test_data(static_cast<ContactTestData*>(compound1ObjWrap->m_collisionObject->getUserPointer()))
   {
-    btAssert(dynamic_cast<ContactTestData*>(compound1ObjWrap->m_collisionObject->getUserPointer()) != nullptr);
   }
 
   void Process(const btDbvtNode* leaf0, const btDbvtNode* leaf1)
@@ -183,7 +179,7 @@ struct TesseractCompoundCompoundLeafCallback : btDbvt::ICollide
     aabbMin0 -= thresholdVec;
     aabbMax0 += thresholdVec;
 
-    if (m_contact_test_data->done)
+    if (isContactTestDone(m_dispatchInfo))
       return;
 
     if (TestAabbAgainstAabb2(aabbMin0, aabbMax0, aabbMin1, aabbMax1))
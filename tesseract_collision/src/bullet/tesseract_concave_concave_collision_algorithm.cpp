@@ -0,0 +1,168 @@
+/**
+ * @file tesseract_concave_concave_collision_algorithm.cpp
+ * @brief Collision algorithm for two concave triangle mesh shapes
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+#include <BulletCollision/CollisionShapes/btConcaveShape.h>
+#include <BulletCollision/CollisionShapes/btTriangleCallback.h>
+#include <BulletCollision/CollisionShapes/btTriangleShape.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/tesseract_concave_concave_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+
+namespace tesseract_collision
+{
+namespace tesseract_collision_bullet
+{
+/** @brief Checks each triangle of the first concave shape against the second concave shape */
+struct TesseractConcaveTriangleCallback : public btTriangleCallback
+{
+  const btCollisionObjectWrapper* m_concave0Wrap;
+  const btCollisionObjectWrapper* m_concave1Wrap;
+  btDispatcher* m_dispatcher;
+  const btDispatcherInfo& m_dispatchInfo;
+  btManifoldResult* m_resultOut;
+
+  TesseractConcaveTriangleCallback(const btCollisionObjectWrapper* concave0Wrap,
+                                   const btCollisionObjectWrapper* concave1Wrap,
+                                   btDispatcher* dispatcher,
+                                   const btDispatcherInfo& dispatchInfo,
+                                   btManifoldResult* resultOut)
+    : m_concave0Wrap(concave0Wrap)
+    , m_concave1Wrap(concave1Wrap)
+    , m_dispatcher(dispatcher)
+    , m_dispatchInfo(dispatchInfo)
+    , m_resultOut(resultOut)
+  {
+  }
+
+  void processTriangle(btVector3* triangle, int partId, int triangleIndex) override
+  {
+    if (isContactTestDone(m_dispatchInfo))
+      return;
+
+    btTriangleShape triangle_shape(triangle[0], triangle[1], triangle[2]);
+    triangle_shape.setMargin(m_concave0Wrap->getCollisionShape()->getMargin());
+
+    btCollisionObjectWrapper triangleWrap(m_concave0Wrap,
+                                          &triangle_shape,
+                                          m_concave0Wrap->getCollisionObject(),
+                                          m_concave0Wrap->getWorldTransform(),
+                                          partId,
+                                          triangleIndex);
+
+    ebtDispatcherQueryType query_type = (m_resultOut->m_closestPointDistanceThreshold > 0) ?
+                                            BT_CLOSEST_POINT_ALGORITHMS :
+                                            BT_CONTACT_POINT_ALGORITHMS;
+    btCollisionAlgorithm* algo = m_dispatcher->findAlgorithm(&triangleWrap, m_concave1Wrap, nullptr, query_type);
+
+    const btCollisionObjectWrapper* tmpWrap = nullptr;
+    bool is_body0 = (m_resultOut->getBody0Internal() == m_concave0Wrap->getCollisionObject());
+    if (is_body0)
+    {
+      tmpWrap = m_resultOut->getBody0Wrap();
+      m_resultOut->setBody0Wrap(&triangleWrap);
+      m_resultOut->setShapeIdentifiersA(partId, triangleIndex);
+    }
+    else
+    {
+      tmpWrap = m_resultOut->getBody1Wrap();
+      m_resultOut->setBody1Wrap(&triangleWrap);
+      m_resultOut->setShapeIdentifiersB(partId, triangleIndex);
+    }
+
+    algo->processCollision(&triangleWrap, m_concave1Wrap, m_dispatchInfo, m_resultOut);
+
+    if (is_body0)
+      m_resultOut->setBody0Wrap(tmpWrap);
+    else
+      m_resultOut->setBody1Wrap(tmpWrap);
+
+    algo->~btCollisionAlgorithm();
+    m_dispatcher->freeCollisionAlgorithm(algo);
+  }
+};
+
+TesseractConcaveConcaveCollisionAlgorithm::TesseractConcaveConcaveCollisionAlgorithm(
+    const btCollisionAlgorithmConstructionInfo& ci,
+    const btCollisionObjectWrapper* body0Wrap,
+    const btCollisionObjectWrapper* body1Wrap)
+  : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap)
+{
+}
+
+void TesseractConcaveConcaveCollisionAlgorithm::processCollision(const btCollisionObjectWrapper* body0Wrap,
+                                                                 const btCollisionObjectWrapper* body1Wrap,
+                                                                 const btDispatcherInfo& dispatchInfo,
+                                                                 btManifoldResult* resultOut)
+{
+  btAssert(body0Wrap->getCollisionShape()->isConcave());
+  btAssert(body1Wrap->getCollisionShape()->isConcave());
+  const auto* concave_shape0 = static_cast<const btConcaveShape*>(body0Wrap->getCollisionShape());
+
+  // Find the bounding box of the second shape in the frame of the first shape
+  btTransform body1_to_body0 = body0Wrap->getWorldTransform().inverse() * body1Wrap->getWorldTransform();
+  btVector3 aabb_min, aabb_max;
+  body1Wrap->getCollisionShape()->getAabb(body1_to_body0, aabb_min, aabb_max);
+
+  btVector3 extend_aabb(resultOut->m_closestPointDistanceThreshold,
+                        resultOut->m_closestPointDistanceThreshold,
+                        resultOut->m_closestPointDistanceThreshold);
+  aabb_min -= extend_aabb;
+  aabb_max += extend_aabb;
+
+  TesseractConcaveTriangleCallback callback(body0Wrap, body1Wrap, m_dispatcher, dispatchInfo, resultOut);
+  concave_shape0->processAllTriangles(&callback, aabb_min, aabb_max);
+}
+
+btScalar TesseractConcaveConcaveCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* /*body0*/,
+                                                                          btCollisionObject* /*body1*/,
+                                                                          const btDispatcherInfo& /*dispatchInfo*/,
+                                                                          btManifoldResult* /*resultOut*/)
+{
+  return btScalar(1.);
+}
+}  // namespace tesseract_collision_bullet
+}  // namespace tesseract_collision
@@ -0,0 +1,156 @@
+/**
+ * @file tesseract_octree_collision_algorithm.cpp
+ * @brief Collision algorithm for an octree shape and another shape
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+#include <BulletCollision/CollisionShapes/btBoxShape.h>
+#include <BulletCollision/CollisionShapes/btSphereShape.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/tesseract_octree_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+
+namespace tesseract_collision
+{
+namespace tesseract_collision_bullet
+{
+TesseractOctreeCollisionAlgorithm::TesseractOctreeCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                                                     const btCollisionObjectWrapper* body0Wrap,
+                                                                     const btCollisionObjectWrapper* body1Wrap,
+                                                                     bool isSwapped)
+  : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap), m_isSwapped(isSwapped)
+{
+}
+
+void TesseractOctreeCollisionAlgorithm::processCollision(const btCollisionObjectWrapper* body0Wrap,
+                                                         const btCollisionObjectWrapper* body1Wrap,
+                                                         const btDispatcherInfo& dispatchInfo,
+                                                         btManifoldResult* resultOut)
+{
+  const btCollisionObjectWrapper* octree_wrap = (m_isSwapped) ? body1Wrap : body0Wrap;
+  const btCollisionObjectWrapper* other_wrap = (m_isSwapped) ? body0Wrap : body1Wrap;
+  btAssert(octree_wrap->getCollisionShape()->getShapeType() == TESSERACT_OCTREE_SHAPE_PROXYTYPE);
+  const auto* octree_shape = static_cast<const TesseractOctreeShape*>(octree_wrap->getCollisionShape());
+
+  // The bounds of the other shape in the frame of the octree
+  const btTransform& octree_tf = octree_wrap->getWorldTransform();
+  btVector3 aabb_min, aabb_max;
+  other_wrap->getCollisionShape()->getAabb(octree_tf.inverseTimes(other_wrap->getWorldTransform()), aabb_min, aabb_max);
+
+  const btScalar threshold = resultOut->m_closestPointDistanceThreshold;
+  aabb_min -= btVector3(threshold, threshold, threshold);
+  aabb_max += btVector3(threshold, threshold, threshold);
+
+  const tesseract_geometry::Octree::SubType sub_type = octree_shape->getOctree()->getSubType();
+  const btTransform& cast_tf = octree_shape->getCastTransform();
+  const int index = octree_shape->getUserIndex();
+  auto callback = [&](const btVector3& center, btScalar size) {
+    if (isContactTestDone(dispatchInfo))
+      return;
+
+    const btScalar l = size / 2;
+    btBoxShape box(btVector3(l, l, l));
+    box.setMargin(BULLET_MARGIN);
+
+    // Sphere is a special case where you do not modify the margin which is internally set to the radius
+    btSphereShape sphere((sub_type == tesseract_geometry::Octree::SubType::SPHERE_OUTSIDE) ? btSqrt(2 * (l * l)) : l);
+
+    btConvexShape* leaf = (sub_type == tesseract_geometry::Octree::SubType::BOX) ? static_cast<btConvexShape*>(&box) :
+                                                                                    &sphere;
+    leaf->setUserIndex(octree_shape->getUserIndex());
+
+    btTransform leaf_tf;
+    leaf_tf.setIdentity();
+    leaf_tf.setOrigin(center);
+
+    // The cast transform of the leaf is the cast transform of the octree expressed in the frame of the leaf
+    CastHullShape cast_leaf(leaf, leaf_tf.inverse() * cast_tf * leaf_tf);
+    const btCollisionShape* leaf_shape = (octree_shape->isCast()) ? static_cast<btCollisionShape*>(&cast_leaf) : leaf;
+
+    const btTransform leaf_world_tf = octree_tf * leaf_tf;
+    btCollisionObjectWrapper leaf_wrap(
+        octree_wrap, leaf_shape, octree_wrap->getCollisionObject(), leaf_world_tf, -1, index);
+
+    btCollisionAlgorithm* algo =
+        m_dispatcher->findAlgorithm(&leaf_wrap, other_wrap, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+
+    const btCollisionObjectWrapper* tmp_wrap = nullptr;
+
+    /// detect swapping case
+    if (resultOut->getBody0Internal() == octree_wrap->getCollisionObject())
+    {
+      tmp_wrap = resultOut->getBody0Wrap();
+      resultOut->setBody0Wrap(&leaf_wrap);
+      resultOut->setShapeIdentifiersA(-1, index);
+    }
+    else
+    {
+      tmp_wrap = resultOut->getBody1Wrap();
+      resultOut->setBody1Wrap(&leaf_wrap);
+      resultOut->setShapeIdentifiersB(-1, index);
+    }
+
+    algo->processCollision(&leaf_wrap, other_wrap, dispatchInfo, resultOut);
+
+    if (resultOut->getBody0Internal() == octree_wrap->getCollisionObject())
+      resultOut->setBody0Wrap(tmp_wrap);
+    else
+      resultOut->setBody1Wrap(tmp_wrap);
+
+    algo->~btCollisionAlgorithm();
+    m_dispatcher->freeCollisionAlgorithm(algo);
+  };
+
+  octree_shape->processOccupiedLeafs(aabb_min, aabb_max, callback);
+}
+
+btScalar TesseractOctreeCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* /*body0*/,
+                                                                  btCollisionObject* /*body1*/,
+                                                                  const btDispatcherInfo& /*dispatchInfo*/,
+                                                                  btManifoldResult* /*resultOut*/)
+{
+  return btScalar(1.);
+}
+}  // namespace tesseract_collision_bullet
+}  // namespace tesseract_collision
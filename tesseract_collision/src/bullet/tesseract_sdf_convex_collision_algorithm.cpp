@@ -0,0 +1,197 @@
+/**
+ * @file tesseract_sdf_convex_collision_algorithm.cpp
+ * @brief Collision algorithm for a signed distance field mesh shape and a convex shape
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (BSD-2-Clause)
+ * @par
+ * All rights reserved.
+ * @par
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * @par
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ * @par
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+#include <BulletCollision/CollisionShapes/btConvexShape.h>
+#include <BulletCollision/CollisionShapes/btSphereShape.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/tesseract_sdf_convex_collision_algorithm.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+
+namespace tesseract_collision
+{
+namespace tesseract_collision_bullet
+{
+/** @brief The maximum number of support point iterations used to find the deepest point of a convex shape */
+static const int SDF_CONVEX_MAX_ITERATIONS = 8;
+
+/** @brief The deepest point of a convex shape in the signed distance field */
+struct SDFConvexPoint
+{
+  Eigen::Vector3d point;    /**< @brief The point of the convex shape in the frame of the field */
+  Eigen::Vector3d gradient; /**< @brief The normalized gradient of the field at the point */
+  double distance;          /**< @brief The signed distance of the point */
+};
+
+/**
+ * @brief Find the deepest point of a convex shape in the signed distance field
+ * @param sdf The signed distance field
+ * @param convex The convex shape
+ * @param convex_to_sdf The transform of the convex shape in the frame of the field
+ * @return The deepest point found
+ */
+static SDFConvexPoint findDeepestPoint(const SignedDistanceField& sdf,
+                                       const btConvexShape& convex,
+                                       const btTransform& convex_to_sdf)
+{
+  SDFConvexPoint best;
+
+  // The closest point of a sphere lies along the gradient at its center
+  if (convex.getShapeType() == SPHERE_SHAPE_PROXYTYPE)
+  {
+    const Eigen::Vector3d center = convertBtToEigen(convex_to_sdf.getOrigin());
+    const double radius = static_cast<double>(static_cast<const btSphereShape&>(convex).getRadius());
+    best.distance = sdf.getDistance(center, &best.gradient) - radius;
+    best.point = center - (radius * best.gradient);
+    return best;
+  }
+
+  auto getSupportPoint = [&convex, &convex_to_sdf](const Eigen::Vector3d& direction) {
+    const btVector3 local_direction = convertEigenToBt(direction) * convex_to_sdf.getBasis();
+    return convertBtToEigen(convex_to_sdf * convex.localGetSupportingVertex(local_direction));
+  };
+
+  // Start from the deepest of the support points opposite to the gradient at the center and along the axes
+  const Eigen::Vector3d center = convertBtToEigen(convex_to_sdf.getOrigin());
+  Eigen::Vector3d gradient;
+  sdf.getDistance(center, &gradient);
+  best.point = getSupportPoint(-gradient);
+  best.distance = sdf.getDistance(best.point, &best.gradient);
+  for (Eigen::Index axis = 0; axis < 3; ++axis)
+  {
+    for (double sign : { -1.0, 1.0 })
+    {
+      SDFConvexPoint candidate;
+      candidate.point = getSupportPoint(sign * Eigen::Vector3d::Unit(axis));
+      candidate.distance = sdf.getDistance(candidate.point, &candidate.gradient);
+      if (candidate.distance < best.distance)
+        best = candidate;
+    }
+  }
+
+  // Follow the support point opposite to the gradient while it gets deeper
+  const double tolerance = 1e-3 * sdf.getCellSize();
+  for (int i = 0; i < SDF_CONVEX_MAX_ITERATIONS; ++i)
+  {
+    SDFConvexPoint candidate;
+    candidate.point = getSupportPoint(-best.gradient);
+    candidate.distance = sdf.getDistance(candidate.point, &candidate.gradient);
+    if (candidate.distance > best.distance - tolerance)
+      break;
+
+    best = candidate;
+  }
+
+  return best;
+}
+
+TesseractSDFConvexCollisionAlgorithm::TesseractSDFConvexCollisionAlgorithm(
+    btPersistentManifold* mf,
+    const btCollisionAlgorithmConstructionInfo& ci,
+    const btCollisionObjectWrapper* body0Wrap,
+    const btCollisionObjectWrapper* body1Wrap,
+    bool isSwapped)
+  : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap), m_manifoldPtr(mf), m_isSwapped(isSwapped)
+{
+}
+
+TesseractSDFConvexCollisionAlgorithm::~TesseractSDFConvexCollisionAlgorithm()
+{
+  if (m_ownManifold)
+  {
+    if (m_manifoldPtr)
+      m_dispatcher->releaseManifold(m_manifoldPtr);
+  }
+}
+
+void TesseractSDFConvexCollisionAlgorithm::processCollision(const btCollisionObjectWrapper* body0Wrap,
+                                                            const btCollisionObjectWrapper* body1Wrap,
+                                                            const btDispatcherInfo& /*dispatchInfo*/,
+                                                            btManifoldResult* resultOut)
+{
+  if (!m_manifoldPtr)
+  {
+    m_manifoldPtr = m_dispatcher->getNewManifold(body0Wrap->getCollisionObject(), body1Wrap->getCollisionObject());
+    m_ownManifold = true;
+  }
+  resultOut->setPersistentManifold(m_manifoldPtr);
+
+  const btCollisionObjectWrapper* sdf_wrap = (m_isSwapped) ? body1Wrap : body0Wrap;
+  const btCollisionObjectWrapper* convex_wrap = (m_isSwapped) ? body0Wrap : body1Wrap;
+  btAssert(sdf_wrap->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE);
+  btAssert(convex_wrap->getCollisionShape()->isConvex());
+  const auto* sdf_shape = static_cast<const TesseractSDFMeshShape*>(sdf_wrap->getCollisionShape());
+  const auto* convex_shape = static_cast<const btConvexShape*>(convex_wrap->getCollisionShape());
+
+  const btTransform& sdf_tf = sdf_wrap->getWorldTransform();
+  const SDFConvexPoint deepest = findDeepestPoint(
+      *sdf_shape->getSignedDistanceField(), *convex_shape, sdf_tf.inverse() * convex_wrap->getWorldTransform());
+
+  if (deepest.distance > static_cast<double>(resultOut->m_closestPointDistanceThreshold))
+    return;
+
+  // The gradient points from the field towards the convex shape
+  const btVector3 point = sdf_tf * convertEigenToBt(deepest.point);
+  const btVector3 normal = sdf_tf.getBasis() * convertEigenToBt(deepest.gradient);
+  const auto depth = static_cast<btScalar>(deepest.distance);
+  if (m_isSwapped)
+    resultOut->addContactPoint(normal, point - (normal * depth), depth);
+  else
+    resultOut->addContactPoint(-normal, point, depth);
+
+  if (m_ownManifold)
+    resultOut->refreshContactPoints();
+}
+
+btScalar TesseractSDFConvexCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* /*body0*/,
+                                                                     btCollisionObject* /*body1*/,
+                                                                     const btDispatcherInfo& /*dispatchInfo*/,
+                                                                     btManifoldResult* /*resultOut*/)
+{
+  return btScalar(1.);
+}
+}  // namespace tesseract_collision_bullet
+}  // namespace tesseract_collision
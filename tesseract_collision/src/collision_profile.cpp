@@ -11,6 +11,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
 #include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
 
 static const std::size_t DIM = 10;
 
@@ -160,9 +161,9 @@ std::vector<Eigen::Isometry3d> getTransforms(std::size_t num_poses)
   std::vector<Eigen::Isometry3d> poses(num_poses);
   for (std::size_t i = 0; i < num_poses; ++i)
   {
-    double x = (rand() / RAND_MAX) * double(DIM);
-    double y = (rand() / RAND_MAX) * double(DIM);
-    double z = (rand() / RAND_MAX) * double(DIM);
+    double x = (static_cast<double>(rand()) / RAND_MAX) * double(DIM);
+    double y = (static_cast<double>(rand()) / RAND_MAX) * double(DIM);
+    double z = (static_cast<double>(rand()) / RAND_MAX) * double(DIM);
     poses[i] = Eigen::Isometry3d::Identity();
     poses[i].translation() = Eigen::Vector3d(x, y, z);
   }
@@ -181,8 +182,7 @@ void runDiscreteProfile(bool use_single_link, bool use_convex_mesh, double conta
   std::vector<std::size_t> checker_contacts = { 0, 0, 0 };
 
   std::printf("Total number of shape: %d\n", int(DIM * DIM * DIM));
-  //  for (std::size_t i = 0; i < checkers.size(); ++i)
-  for (std::size_t i = 0; i < 2; ++i)
+  for (std::size_t i = 0; i < checkers.size(); ++i)
   {
     addCollisionObjects(*checkers[i], use_single_link, use_convex_mesh);
     checkers[i]->setCollisionMarginData(CollisionMarginData(contact_distance));
@@ -209,10 +209,11 @@ void runContinuousProfile(bool use_single_link, bool use_convex_mesh, double con
 {
   auto bt_simple_checker = std::make_shared<tesseract_collision_bullet::BulletCastSimpleManager>();
   auto bt_bvh_checker = std::make_shared<tesseract_collision_bullet::BulletCastBVHManager>();
+  auto fcl_bvh_checker = std::make_shared<tesseract_collision_fcl::FCLCastBVHManager>();
 
   std::vector<Eigen::Isometry3d> poses = getTransforms(50);
-  std::vector<ContinuousContactManager::Ptr> checkers = { bt_simple_checker, bt_bvh_checker };
-  std::vector<std::string> checker_names = { "BtCastSimple", "BtCastBVH" };
+  std::vector<ContinuousContactManager::Ptr> checkers = { bt_simple_checker, bt_bvh_checker, fcl_bvh_checker };
+  std::vector<std::string> checker_names = { "BtCastSimple", "BtCastBVH", "FCLCastBVH" };
   std::vector<std::size_t> checker_contacts = { 0, 0, 0 };
 
   Eigen::Isometry3d delta_pose;
@@ -220,8 +221,7 @@ void runContinuousProfile(bool use_single_link, bool use_convex_mesh, double con
   delta_pose.translation() = Eigen::Vector3d(0.5, 0.5, 0.5);
 
   std::printf("Total number of shape: %d\n", int(DIM * DIM * DIM));
-  //  for (std::size_t i = 0; i < checkers.size(); ++i)
-  for (std::size_t i = 0; i < 2; ++i)
+  for (std::size_t i = 0; i < checkers.size(); ++i)
   {
     addCollisionObjects(*checkers[i], use_single_link, use_convex_mesh);
     checkers[i]->setCollisionMarginData(CollisionMarginData(contact_distance));
@@ -0,0 +1,318 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_collision/convex_decomposition/convex_decomposition_cache.h>
+
+namespace tesseract_collision
+{
+/** @brief Identifies a convex decomposition cache file */
+static const uint32_t CACHE_FILE_MAGIC = 0x43445854;  // "TXDC"
+
+/** @brief The version of the cache file format, which must be incremented whenever the format changes */
+static const uint32_t CACHE_FILE_VERSION = 1;
+
+static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double), "The vertices are expected to be tightly packed");
+
+/** @brief Add bytes to a 64 bit FNV-1a hash */
+static void hashBytes(uint64_t& hash, const void* data, std::size_t size)
+{
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+}
+
+static uint64_t computeHash(const tesseract_common::VectorVector3d& vertices,
+                            const Eigen::VectorXi& faces,
+                            const std::string& cache_key)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  const auto num_vertices = static_cast<uint64_t>(vertices.size());
+  const auto num_faces = static_cast<uint64_t>(faces.size());
+  hashBytes(hash, &num_vertices, sizeof(num_vertices));
+  hashBytes(hash, vertices.data(), vertices.size() * sizeof(Eigen::Vector3d));
+  hashBytes(hash, &num_faces, sizeof(num_faces));
+  hashBytes(hash, faces.data(), static_cast<std::size_t>(faces.size()) * sizeof(int));
+  hashBytes(hash, cache_key.data(), cache_key.size());
+  return hash;
+}
+
+template <typename T>
+static void writeValue(std::ostream& os, const T& value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool readValue(std::istream& is, T& value)
+{
+  return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+/**
+ * @brief Write the header of a cache file which identifies the input of the convex decomposition
+ * @details The header holds the hash, the cache key and the size of the input so a hash collision is unlikely to
+ * return the results of a different mesh
+ */
+static void writeHeader(std::ostream& os,
+                        uint64_t hash,
+                        const std::string& cache_key,
+                        const tesseract_common::VectorVector3d& vertices,
+                        const Eigen::VectorXi& faces)
+{
+  writeValue(os, CACHE_FILE_MAGIC);
+  writeValue(os, CACHE_FILE_VERSION);
+  writeValue(os, hash);
+  writeValue(os, static_cast<uint64_t>(cache_key.size()));
+  os.write(cache_key.data(), static_cast<std::streamsize>(cache_key.size()));
+  writeValue(os, static_cast<uint64_t>(vertices.size()));
+  writeValue(os, static_cast<uint64_t>(faces.size()));
+}
+
+/** @brief Check the header of a cache file matches the header written for the provided input */
+static bool checkHeader(std::istream& is,
+                        uint64_t hash,
+                        const std::string& cache_key,
+                        const tesseract_common::VectorVector3d& vertices,
+                        const Eigen::VectorXi& faces)
+{
+  std::ostringstream expected;
+  writeHeader(expected, hash, cache_key, vertices, faces);
+  const std::string expected_header = expected.str();
+
+  std::string header(expected_header.size(), '\0');
+  if (!is.read(&header[0], static_cast<std::streamsize>(header.size())))
+    return false;
+
+  return (header == expected_header);
+}
+
+static void writeConvexMeshes(std::ostream& os, const std::vector<tesseract_geometry::ConvexMesh::Ptr>& meshes)
+{
+  writeValue(os, static_cast<uint64_t>(meshes.size()));
+  for (const auto& mesh : meshes)
+  {
+    const tesseract_common::VectorVector3d& vertices = *mesh->getVertices();
+    const Eigen::VectorXi& faces = *mesh->getFaces();
+    writeValue(os, static_cast<uint64_t>(vertices.size()));
+    os.write(reinterpret_cast<const char*>(vertices.data()),
+             static_cast<std::streamsize>(vertices.size() * sizeof(Eigen::Vector3d)));
+    writeValue(os, static_cast<int32_t>(mesh->getFaceCount()));
+    writeValue(os, static_cast<uint64_t>(faces.size()));
+    os.write(reinterpret_cast<const char*>(faces.data()),
+             static_cast<std::streamsize>(static_cast<std::size_t>(faces.size()) * sizeof(int)));
+  }
+}
+
+/**
+ * @brief Check the faces of a mesh are a list of polygons with at least three valid vertex indices
+ * @return True if the faces hold face_count polygons and nothing else
+ */
+static bool checkFaces(const Eigen::VectorXi& faces, int32_t face_count, uint64_t num_vertices)
+{
+  Eigen::Index i = 0;
+  for (int32_t f = 0; f < face_count; ++f)
+  {
+    if (i >= faces.size() || faces[i] < 3 || faces[i] >= faces.size() - i)
+      return false;
+
+    const Eigen::Index end = i + 1 + faces[i];
+    for (++i; i < end; ++i)
+    {
+      if (faces[i] < 0 || static_cast<uint64_t>(faces[i]) >= num_vertices)
+        return false;
+    }
+  }
+
+  return (i == faces.size());
+}
+
+/**
+ * @brief Read the convex meshes of a cache file
+ * @details The sizes read from the file are bounded by the remaining size of the file before allocating, so a corrupt
+ * file is rejected instead of requesting an arbitrary amount of memory
+ */
+static bool readConvexMeshes(std::istream& is, std::vector<tesseract_geometry::ConvexMesh::Ptr>& meshes)
+{
+  const std::streamoff body_start = is.tellg();
+  if (body_start < 0 || !is.seekg(0, std::ios::end))
+    return false;
+
+  const std::streamoff file_end = is.tellg();
+  if (file_end < body_start || !is.seekg(body_start))
+    return false;
+
+  auto remaining = static_cast<uint64_t>(file_end - body_start);
+  auto consume = [&remaining](uint64_t count, uint64_t size) {
+    if (count > remaining / size)
+      return false;
+
+    remaining -= count * size;
+    return true;
+  };
+
+  uint64_t num_meshes{ 0 };
+  if (!consume(1, sizeof(num_meshes)) || !readValue(is, num_meshes))
+    return false;
+
+  // Each mesh has at least its vertex count, face count and faces size
+  if (num_meshes > remaining / (sizeof(uint64_t) + sizeof(int32_t) + sizeof(uint64_t)))
+    return false;
+
+  for (uint64_t i = 0; i < num_meshes; ++i)
+  {
+    uint64_t num_vertices{ 0 };
+    if (!consume(1, sizeof(num_vertices)) || !readValue(is, num_vertices))
+      return false;
+
+    if (!consume(num_vertices, sizeof(Eigen::Vector3d)))
+      return false;
+
+    auto vertices = std::make_shared<tesseract_common::VectorVector3d>(num_vertices);
+    if (!is.read(reinterpret_cast<char*>(vertices->data()),
+                 static_cast<std::streamsize>(num_vertices * sizeof(Eigen::Vector3d))))
+      return false;
+
+    int32_t face_count{ 0 };
+    uint64_t faces_size{ 0 };
+    if (!consume(1, sizeof(face_count)) || !readValue(is, face_count) || !consume(1, sizeof(faces_size)) ||
+        !readValue(is, faces_size))
+      return false;
+
+    if (face_count <= 0 || !consume(faces_size, sizeof(int)))
+      return false;
+
+    auto faces = std::make_shared<Eigen::VectorXi>(static_cast<Eigen::Index>(faces_size));
+    if (!is.read(reinterpret_cast<char*>(faces->data()),
+                 static_cast<std::streamsize>(faces_size * sizeof(int))))
+      return false;
+
+    if (!checkFaces(*faces, face_count, num_vertices))
+      return false;
+
+    meshes.push_back(std::make_shared<tesseract_geometry::ConvexMesh>(vertices, faces, face_count));
+  }
+
+  // The file must end after the last mesh
+  return (remaining == 0 && is.peek() == std::char_traits<char>::eof());
+}
+
+ConvexDecompositionCache::ConvexDecompositionCache(ConvexDecomposition::ConstPtr decomposition,
+                                                   std::string cache_directory)
+  : decomposition_(std::move(decomposition)), cache_directory_(std::move(cache_directory))
+{
+  if (decomposition_ == nullptr)
+    throw std::runtime_error("ConvexDecompositionCache: The convex decomposition is a nullptr");
+}
+
+std::vector<tesseract_geometry::ConvexMesh::Ptr>
+ConvexDecompositionCache::compute(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& faces) const
+{
+  ConvexDecompositionStatus status;
+  return compute(vertices, faces, status);
+}
+
+std::vector<tesseract_geometry::ConvexMesh::Ptr>
+ConvexDecompositionCache::compute(const tesseract_common::VectorVector3d& vertices,
+                                  const Eigen::VectorXi& faces,
+                                  ConvexDecompositionStatus& status) const
+{
+  const std::string cache_key = decomposition_->getCacheKey();
+  if (cache_key.empty())
+    return decomposition_->compute(vertices, faces, status);
+
+  const uint64_t hash = computeHash(vertices, faces, cache_key);
+  const std::string file_path = getCacheFilePath(vertices, faces);
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> output;
+  {
+    std::ifstream is(file_path, std::ios::binary);
+    if (is.is_open())
+    {
+      bool loaded{ false };
+      try
+      {
+        loaded = checkHeader(is, hash, cache_key, vertices, faces) && readConvexMeshes(is, output);
+      }
+      catch (const std::exception& e)
+      {
+        CONSOLE_BRIDGE_logWarn("Failed to read convex decomposition cache file: %s", e.what());
+      }
+
+      if (loaded)
+      {
+        CONSOLE_BRIDGE_logDebug("Loaded convex decomposition from cache file: %s", file_path.c_str());
+        status.setProgress(100, "Loaded from cache");
+        return output;
+      }
+
+      CONSOLE_BRIDGE_logWarn("Ignoring invalid convex decomposition cache file: %s", file_path.c_str());
+      output.clear();
+    }
+  }
+
+  output = decomposition_->compute(vertices, faces, status);
+
+  // Failed or cancelled decompositions are not cached
+  if (output.empty())
+    return output;
+
+  tesseract_common::fs::path directory(cache_directory_);
+  boost::system::error_code ec;
+  tesseract_common::fs::create_directories(directory, ec);
+  if (ec)
+  {
+    CONSOLE_BRIDGE_logWarn("Failed to create convex decomposition cache directory: %s", cache_directory_.c_str());
+    return output;
+  }
+
+  // Write to a unique temporary file and rename it so readers never see a partially written file
+  tesseract_common::fs::path tmp_path = file_path + "." + tesseract_common::fs::unique_path().string() + ".tmp";
+  {
+    std::ofstream os(tmp_path.string(), std::ios::binary | std::ios::trunc);
+    writeHeader(os, hash, cache_key, vertices, faces);
+    writeConvexMeshes(os, output);
+    os.close();
+    if (!os)
+    {
+      CONSOLE_BRIDGE_logWarn("Failed to write convex decomposition cache file: %s", tmp_path.string().c_str());
+      tesseract_common::fs::remove(tmp_path, ec);
+      return output;
+    }
+  }
+
+  tesseract_common::fs::rename(tmp_path, file_path, ec);
+  if (ec)
+  {
+    CONSOLE_BRIDGE_logWarn("Failed to write convex decomposition cache file: %s", file_path.c_str());
+    tesseract_common::fs::remove(tmp_path, ec);
+  }
+
+  return output;
+}
+
+std::string ConvexDecompositionCache::getCacheKey() const { return decomposition_->getCacheKey(); }
+
+const std::string& ConvexDecompositionCache::getCacheDirectory() const { return cache_directory_; }
+
+std::string ConvexDecompositionCache::getCacheFilePath(const tesseract_common::VectorVector3d& vertices,
+                                                       const Eigen::VectorXi& faces) const
+{
+  const std::string cache_key = decomposition_->getCacheKey();
+  if (cache_key.empty())
+    return {};
+
+  std::stringstream file_name;
+  file_name << std::hex << std::setw(16) << std::setfill('0') << computeHash(vertices, faces, cache_key) << ".tcd";
+  return (tesseract_common::fs::path(cache_directory_) / file_name.str()).string();
+}
+
+}  // namespace tesseract_collision
@@ -13,12 +13,28 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_collision
 {
+/** @brief Get a human readable list of the parameters */
+static std::string getParametersString(const HACDParameters& params)
+{
+  std::stringstream msg;
+  msg << "+ Parameters" << std::endl;
+  msg << "\t compacity_weight           " << params.compacity_weight << std::endl;
+  msg << "\t volume_weight              " << params.volume_weight << std::endl;
+  msg << "\t max. concavity             " << params.concavity << std::endl;
+  msg << "\t min number of clusters     " << params.min_num_clusters << std::endl;
+  msg << "\t add extra dist points      " << ((params.add_extra_dist_points) ? "true" : "false") << std::endl;
+  msg << "\t add neighbours dist points " << ((params.add_neighbours_dist_points) ? "true" : "false") << std::endl;
+  msg << "\t add faces points           " << ((params.add_faces_points) ? "true" : "false") << std::endl;
+
+  return msg.str();
+}
+
 ConvexDecompositionHACD::ConvexDecompositionHACD(const HACDParameters& params) : params_(params) {}
 
 std::vector<tesseract_geometry::ConvexMesh::Ptr>
 ConvexDecompositionHACD::compute(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& faces) const
 {
-  params_.print();
+  CONSOLE_BRIDGE_logDebug("%s", getParametersString(params_).c_str());
 
   std::vector<HACD::Vec3<HACD::Real>> points_local;
   points_local.reserve(vertices.size());
@@ -98,19 +114,16 @@ ConvexDecompositionHACD::compute(const tesseract_common::VectorVector3d& vertice
   return output;
 }
 
-void HACDParameters::print() const
+std::string ConvexDecompositionHACD::getCacheKey() const
 {
-  std::stringstream msg;
-  msg << "+ Parameters" << std::endl;
-  msg << "\t compacity_weight           " << compacity_weight << std::endl;
-  msg << "\t volume_weight              " << volume_weight << std::endl;
-  msg << "\t max. concavity             " << concavity << std::endl;
-  msg << "\t min number of clusters     " << min_num_clusters << std::endl;
-  msg << "\t add extra dist points      " << ((add_extra_dist_points) ? "true" : "false") << std::endl;
-  msg << "\t add neighbours dist points " << ((add_neighbours_dist_points) ? "true" : "false") << std::endl;
-  msg << "\t add faces points           " << ((add_faces_points) ? "true" : "false") << std::endl;
-
-  std::cout << msg.str();
+  // The doubles are written in hexadecimal so the key is exact
+  std::stringstream key;
+  key << "HACD" << std::hexfloat << " " << params_.compacity_weight << " " << params_.volume_weight << " "
+      << params_.concavity << " " << params_.max_num_vertices_per_ch << " " << params_.min_num_clusters << " "
+      << params_.add_extra_dist_points << " " << params_.add_neighbours_dist_points << " " << params_.add_faces_points;
+  return key.str();
 }
 
+void HACDParameters::print() const { std::cout << getParametersString(*this); }
+
 }  // namespace tesseract_collision
@@ -9,15 +9,43 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_collision
 {
+/** @brief Get a human readable list of the parameters */
+static std::string getParametersString(const VHACDParameters& params)
+{
+  std::stringstream msg;
+  msg << "+ Parameters" << std::endl;
+  msg << "\t resolution                                  " << params.resolution << std::endl;
+  msg << "\t Max number of convex-hulls                  " << params.max_convehulls << std::endl;
+  msg << "\t max. concavity                              " << params.concavity << std::endl;
+  msg << "\t plane down-sampling                         " << params.plane_downsampling << std::endl;
+  msg << "\t convex-hull down-sampling                   " << params.convexhull_downsampling << std::endl;
+  msg << "\t alpha                                       " << params.alpha << std::endl;
+  msg << "\t beta                                        " << params.beta << std::endl;
+  msg << "\t pca                                         " << params.pca << std::endl;
+  msg << "\t mode                                        " << params.mode << std::endl;
+  msg << "\t max. vertices per convex-hull               " << params.max_num_vertices_per_ch << std::endl;
+  msg << "\t min. volume to add vertices to convex-hulls " << params.min_volume_per_ch << std::endl;
+  msg << "\t convex-hull approximation                   " << params.convexhull_approximation << std::endl;
+  msg << "\t OpenCL acceleration                         " << params.ocl_acceleration << std::endl;
+  //  msg << "\t OpenCL platform ID                          " << oclPlatformID << std::endl;
+  //  msg << "\t OpenCL device ID                            " << oclDeviceID << std::endl;
+
+  return msg.str();
+}
+
+/**
+ * @brief Forwards the progress of VHACD to the convex decomposition status and cancels VHACD when requested
+ * @details VHACD reports its progress frequently, so this is also used to poll for cancellation
+ */
 class ProgressCallback : public VHACD::IVHACD::IUserCallback
 {
 public:
-  ProgressCallback() = default;
+  ProgressCallback(VHACD::IVHACD& vhacd, ConvexDecompositionStatus& status) : vhacd_(vhacd), status_(status) {}
   ~ProgressCallback() override = default;
-  ProgressCallback(const ProgressCallback&) = default;
-  ProgressCallback& operator=(const ProgressCallback&) = default;
-  ProgressCallback(ProgressCallback&&) = default;
-  ProgressCallback& operator=(ProgressCallback&&) = default;
+  ProgressCallback(const ProgressCallback&) = delete;
+  ProgressCallback& operator=(const ProgressCallback&) = delete;
+  ProgressCallback(ProgressCallback&&) = delete;
+  ProgressCallback& operator=(ProgressCallback&&) = delete;
 
   void Update(double overallProgress,
               double stageProgress,
@@ -25,11 +53,20 @@ public:
               const std::string& stage,
               const std::string& operation) override
   {
-    std::cout << std::setfill(' ') << std::setw(3) << std::lround(overallProgress + 0.5) << "% "
-              << "[ " << stage << " " << std::setfill(' ') << std::setw(3) << lround(stageProgress + 0.5) << "% ] "
-              << operation << " " << std::setfill(' ') << std::setw(3) << std::lround(operationProgress + 0.5) << "%"
-              << std::endl;
+    status_.setProgress(overallProgress, stage);
+    if (status_.isCancelled())
+      vhacd_.Cancel();
+
+    std::stringstream msg;
+    msg << std::setfill(' ') << std::setw(3) << std::lround(overallProgress + 0.5) << "% "
+        << "[ " << stage << " " << std::setfill(' ') << std::setw(3) << lround(stageProgress + 0.5) << "% ] "
+        << operation << " " << std::setfill(' ') << std::setw(3) << std::lround(operationProgress + 0.5) << "%";
+    CONSOLE_BRIDGE_logDebug("%s", msg.str().c_str());
   }
+
+private:
+  VHACD::IVHACD& vhacd_;
+  ConvexDecompositionStatus& status_;
 };
 
 ConvexDecompositionVHACD::ConvexDecompositionVHACD(const VHACDParameters& params) : params_(params) {}
@@ -37,7 +74,19 @@ ConvexDecompositionVHACD::ConvexDecompositionVHACD(const VHACDParameters& params
 std::vector<tesseract_geometry::ConvexMesh::Ptr>
 ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertices, const Eigen::VectorXi& faces) const
 {
-  params_.print();
+  ConvexDecompositionStatus status;
+  return compute(vertices, faces, status);
+}
+
+std::vector<tesseract_geometry::ConvexMesh::Ptr>
+ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertices,
+                                  const Eigen::VectorXi& faces,
+                                  ConvexDecompositionStatus& status) const
+{
+  if (status.isCancelled())
+    return {};
+
+  CONSOLE_BRIDGE_logDebug("%s", getParametersString(params_).c_str());
 
   std::vector<double> points_local;
   points_local.reserve(vertices.size() * 3);
@@ -61,10 +110,10 @@ ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertic
     triangles_local.push_back(static_cast<unsigned int>(faces(i++)));
   }
 
-  // run V-HACD
+  // run V-HACD, which uses OpenMP for the voxelization and clipping when available
   VHACD::IVHACD* interfaceVHACD = VHACD::CreateVHACD();
 
-  ProgressCallback progress_callback;
+  ProgressCallback progress_callback(*interfaceVHACD, status);
   VHACD::IVHACD::Parameters p;
   p.m_concavity = params_.concavity;
   p.m_alpha = params_.alpha;
@@ -82,7 +131,8 @@ ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertic
   p.m_projectHullVertices = params_.project_hull_vertices;
   p.m_callback = &progress_callback;
 
-  bool res = interfaceVHACD->Compute(&points_local[0],
+  // The status may have been cancelled before the first progress update
+  bool res = !status.isCancelled() && interfaceVHACD->Compute(&points_local[0],
                                      static_cast<unsigned int>(points_local.size() / 3),
                                      (const uint32_t*)(&triangles_local[0]),
                                      static_cast<unsigned int>(triangles_local.size() / 3),
@@ -111,6 +161,7 @@ ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertic
       int ch_num_faces = tesseract_collision::createConvexHull(*ch_vertices, *ch_faces, *vhacd_vertices);
       output.push_back(std::make_shared<tesseract_geometry::ConvexMesh>(ch_vertices, ch_faces, ch_num_faces));
     }
+    status.setProgress(100, "Finished");
   }
   else
   {
@@ -123,27 +174,18 @@ ConvexDecompositionVHACD::compute(const tesseract_common::VectorVector3d& vertic
   return output;
 }
 
-void VHACDParameters::print() const
+std::string ConvexDecompositionVHACD::getCacheKey() const
 {
-  std::stringstream msg;
-  msg << "+ Parameters" << std::endl;
-  msg << "\t resolution                                  " << resolution << std::endl;
-  msg << "\t Max number of convex-hulls                  " << max_convehulls << std::endl;
-  msg << "\t max. concavity                              " << concavity << std::endl;
-  msg << "\t plane down-sampling                         " << plane_downsampling << std::endl;
-  msg << "\t convex-hull down-sampling                   " << convexhull_downsampling << std::endl;
-  msg << "\t alpha                                       " << alpha << std::endl;
-  msg << "\t beta                                        " << beta << std::endl;
-  msg << "\t pca                                         " << pca << std::endl;
-  msg << "\t mode                                        " << mode << std::endl;
-  msg << "\t max. vertices per convex-hull               " << max_num_vertices_per_ch << std::endl;
-  msg << "\t min. volume to add vertices to convex-hulls " << min_volume_per_ch << std::endl;
-  msg << "\t convex-hull approximation                   " << convexhull_approximation << std::endl;
-  msg << "\t OpenCL acceleration                         " << ocl_acceleration << std::endl;
-  //  msg << "\t OpenCL platform ID                          " << oclPlatformID << std::endl;
-  //  msg << "\t OpenCL device ID                            " << oclDeviceID << std::endl;
-
-  std::cout << msg.str();
+  // The doubles are written in hexadecimal so the key is exact
+  std::stringstream key;
+  key << "VHACD" << std::hexfloat << " " << params_.concavity << " " << params_.alpha << " " << params_.beta << " "
+      << params_.min_volume_per_ch << " " << params_.resolution << " " << params_.max_num_vertices_per_ch << " "
+      << params_.plane_downsampling << " " << params_.convexhull_downsampling << " " << params_.pca << " "
+      << params_.mode << " " << params_.convexhull_approximation << " " << params_.max_convehulls << " "
+      << params_.project_hull_vertices;
+  return key.str();
 }
 
+void VHACDParameters::print() const { std::cout << getParametersString(*this); }
+
 }  // namespace tesseract_collision
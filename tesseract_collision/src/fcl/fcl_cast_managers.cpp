@@ -0,0 +1,374 @@
+/**
+ * @file fcl_cast_managers.cpp
+ * @brief Tesseract FCL continuous contact manager implementation.
+ *
+ * @author agent
+ * @date October 16, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
+
+namespace tesseract_collision
+{
+namespace tesseract_collision_fcl
+{
+static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
+static const tesseract_common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
+
+FCLCastBVHManager::FCLCastBVHManager()
+{
+  static_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
+  dynamic_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
+  collision_margin_data_ = CollisionMarginData(0);
+}
+
+ContinuousContactManager::Ptr FCLCastBVHManager::clone() const
+{
+  auto manager = std::make_shared<FCLCastBVHManager>();
+  manager->object_ids_ = std::make_shared<ObjectIdRegistry>(*object_ids_);
+
+  // The cloned collision objects keep their cast transforms, which are applied when the margin data is set
+  for (const auto& cow : link2cow_)
+    manager->addCollisionObject(cow.second->clone());
+
+  manager->setActiveCollisionObjects(active_);
+  manager->setCollisionMarginData(collision_margin_data_);
+  manager->setIsContactAllowedFn(fn_);
+
+  return manager;
+}
+
+bool FCLCastBVHManager::addCollisionObject(const std::string& name,
+                                           const int& mask_id,
+                                           const CollisionShapesConst& shapes,
+                                           const tesseract_common::VectorIsometry3d& shape_poses,
+                                           bool enabled)
+{
+  if (link2cow_.find(name) != link2cow_.end())
+    removeCollisionObject(name);
+
+  COW::Ptr new_cow = createFCLCollisionObject(name, mask_id, shapes, shape_poses, enabled);
+  if (new_cow != nullptr)
+  {
+    addCollisionObject(new_cow);
+    return true;
+  }
+
+  return false;
+}
+
+const CollisionShapesConst& FCLCastBVHManager::getCollisionObjectGeometries(const std::string& name) const
+{
+  auto cow = link2cow_.find(name);
+  return (cow != link2cow_.end()) ? cow->second->getCollisionGeometries() : EMPTY_COLLISION_SHAPES_CONST;
+}
+
+const tesseract_common::VectorIsometry3d&
+FCLCastBVHManager::getCollisionObjectGeometriesTransforms(const std::string& name) const
+{
+  auto cow = link2cow_.find(name);
+  return (cow != link2cow_.end()) ? cow->second->getCollisionGeometriesTransforms() :
+                                    EMPTY_COLLISION_SHAPES_TRANSFORMS;
+}
+
+bool FCLCastBVHManager::hasCollisionObject(const std::string& name) const
+{
+  return (link2cow_.find(name) != link2cow_.end());
+}
+
+bool FCLCastBVHManager::removeCollisionObject(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    std::vector<CollisionObjectPtr>& objects = it->second->getCollisionObjects();
+    fcl_co_count_ -= objects.size();
+    for (auto& co : objects)
+    {
+      static_manager_->unregisterObject(co.get());
+      dynamic_manager_->unregisterObject(co.get());
+    }
+
+    collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    link2cow_.erase(name);
+    return true;
+  }
+  return false;
+}
+
+bool FCLCastBVHManager::enableCollisionObject(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    it->second->m_enabled = true;
+    return true;
+  }
+  return false;
+}
+
+bool FCLCastBVHManager::disableCollisionObject(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    it->second->m_enabled = false;
+    return true;
+  }
+  return false;
+}
+
+bool FCLCastBVHManager::updateCollisionObjectGeometries(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  // The fcl collision objects stay registered, so only their AABB is updated in the broadphase
+  COW::Ptr& cow = it->second;
+  if (!cow->updateOctreeGeometries())
+    return true;
+
+  if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+    static_manager_->update(cow->getCollisionObjectsRaw());
+  else
+    dynamic_manager_->update(cow->getCollisionObjectsRaw());
+
+  return true;
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
+{
+  setCollisionObjectsTransform(name, pose, pose);
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                     const tesseract_common::VectorIsometry3d& poses)
+{
+  setCollisionObjectsTransform(names, poses, poses);
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
+{
+  static_update_.clear();
+  dynamic_update_.clear();
+  for (const auto& transform : transforms)
+  {
+    auto it = link2cow_.find(transform.first);
+    if (it != link2cow_.end())
+      queueCollisionObjectTransform(*it->second, transform.second, transform.second);
+  }
+
+  updateQueuedCollisionObjects();
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const std::string& name,
+                                                     const Eigen::Isometry3d& pose1,
+                                                     const Eigen::Isometry3d& pose2)
+{
+  auto it = link2cow_.find(name);
+  if (it != link2cow_.end())
+  {
+    static_update_.clear();
+    dynamic_update_.clear();
+    queueCollisionObjectTransform(*it->second, pose1, pose2);
+    updateQueuedCollisionObjects();
+  }
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
+                                                     const tesseract_common::VectorIsometry3d& pose1,
+                                                     const tesseract_common::VectorIsometry3d& pose2)
+{
+  assert(names.size() == pose1.size());
+  assert(names.size() == pose2.size());
+  static_update_.clear();
+  dynamic_update_.clear();
+  for (auto i = 0u; i < names.size(); ++i)
+  {
+    auto it = link2cow_.find(names[i]);
+    if (it != link2cow_.end())
+      queueCollisionObjectTransform(*it->second, pose1[i], pose2[i]);
+  }
+
+  updateQueuedCollisionObjects();
+}
+
+void FCLCastBVHManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& pose1,
+                                                     const tesseract_common::TransformMap& pose2)
+{
+  assert(pose1.size() == pose2.size());
+  static_update_.clear();
+  dynamic_update_.clear();
+  for (const auto& transform : pose1)
+  {
+    auto it = link2cow_.find(transform.first);
+    auto it2 = pose2.find(transform.first);
+    assert(it2 != pose2.end());
+    if (it != link2cow_.end() && it2 != pose2.end())
+      queueCollisionObjectTransform(*it->second, transform.second, it2->second);
+  }
+
+  updateQueuedCollisionObjects();
+}
+
+const std::vector<std::string>& FCLCastBVHManager::getCollisionObjects() const { return collision_objects_; }
+
+void FCLCastBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
+{
+  active_ = names;
+
+  std::vector<std::string> sorted_active = active_;
+  std::sort(sorted_active.begin(), sorted_active.end());
+
+  bool changed = false;
+  for (auto& co : link2cow_)
+  {
+    if (updateCollisionObjectFilters(
+            isLinkActiveSorted(sorted_active, co.first), co.second, static_manager_, dynamic_manager_))
+      changed = true;
+  }
+
+  // This causes a refit on the bvh tree, which is only required if objects were moved between the trees.
+  if (changed)
+  {
+    dynamic_manager_->update();
+    static_manager_->update();
+  }
+}
+
+const std::vector<std::string>& FCLCastBVHManager::getActiveCollisionObjects() const { return active_; }
+
+void FCLCastBVHManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
+                                               CollisionMarginOverrideType override_type)
+{
+  collision_margin_data_.apply(collision_margin_data, override_type);
+  onCollisionMarginDataChanged();
+}
+
+void FCLCastBVHManager::setDefaultCollisionMarginData(double default_collision_margin)
+{
+  collision_margin_data_.setDefaultCollisionMargin(default_collision_margin);
+  onCollisionMarginDataChanged();
+}
+
+void FCLCastBVHManager::setPairCollisionMarginData(const std::string& name1,
+                                                   const std::string& name2,
+                                                   double collision_margin)
+{
+  collision_margin_data_.setPairCollisionMargin(name1, name2, collision_margin);
+  onCollisionMarginDataChanged();
+}
+
+const CollisionMarginData& FCLCastBVHManager::getCollisionMarginData() const { return collision_margin_data_; }
+void FCLCastBVHManager::setIsContactAllowedFn(IsContactAllowedFn fn) { fn_ = fn; }
+IsContactAllowedFn FCLCastBVHManager::getIsContactAllowedFn() const { return fn_; }
+
+void FCLCastBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+
+  if (!static_manager_->empty())
+    static_manager_->collide(dynamic_manager_.get(), &cdata, &castCallback);
+
+  if (!cdata.done && !dynamic_manager_->empty())
+    dynamic_manager_->collide(&cdata, &castCallback);
+}
+
+void FCLCastBVHManager::addCollisionObject(COW::Ptr cow)
+{
+  std::size_t cnt = cow->getCollisionObjectsRaw().size();
+  fcl_co_count_ += cnt;
+  static_update_.reserve(fcl_co_count_);
+  dynamic_update_.reserve(fcl_co_count_);
+  cow->setObjectId(object_ids_->intern(cow->getName()));
+  link2cow_[cow->getName()] = cow;
+  collision_objects_.push_back(cow->getName());
+
+  std::vector<CollisionObjectPtr>& objects = cow->getCollisionObjects();
+  if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+  {
+    // If static add to static manager
+    for (auto& co : objects)
+      static_manager_->registerObject(co.get());
+  }
+  else
+  {
+    for (auto& co : objects)
+      dynamic_manager_->registerObject(co.get());
+  }
+
+  // If active links is not empty update filters to respace the active links list
+  if (!active_.empty())
+    updateCollisionObjectFilters(active_, cow, static_manager_, dynamic_manager_);
+
+  // This causes a refit on the bvh tree.
+  dynamic_manager_->update();
+  static_manager_->update();
+}
+
+void FCLCastBVHManager::queueCollisionObjectTransform(COW& cow,
+                                                      const Eigen::Isometry3d& pose1,
+                                                      const Eigen::Isometry3d& pose2)
+{
+  std::vector<CollisionObjectRawPtr>& co = cow.getCollisionObjectsRaw();
+  if (cow.m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+  {
+    // Like the BulletCastBVHManager only active collision objects are cast
+    cow.setCollisionObjectsTransform(pose1);
+    static_update_.insert(static_update_.end(), co.begin(), co.end());
+  }
+  else
+  {
+    cow.setCollisionObjectsTransform(pose1, pose2);
+    dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+  }
+}
+
+void FCLCastBVHManager::updateQueuedCollisionObjects()
+{
+  // This is because FCL supports batch update which only rebalances the tree once
+  if (!static_update_.empty())
+    static_manager_->update(static_update_);
+
+  if (!dynamic_update_.empty())
+    dynamic_manager_->update(dynamic_update_);
+}
+
+void FCLCastBVHManager::onCollisionMarginDataChanged()
+{
+  static_update_.clear();
+  dynamic_update_.clear();
+
+  for (auto& cow : link2cow_)
+  {
+    cow.second->setContactDistanceThreshold(collision_margin_data_.getMaxCollisionMargin() / 2.0);
+    std::vector<CollisionObjectRawPtr>& co = cow.second->getCollisionObjectsRaw();
+    if (cow.second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+      static_update_.insert(static_update_.end(), co.begin(), co.end());
+    else
+      dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+  }
+
+  updateQueuedCollisionObjects();
+}
+}  // namespace tesseract_collision_fcl
+}  // namespace tesseract_collision
@@ -56,6 +56,13 @@ void FCLCollisionObjectWrapper::setContactDistanceThreshold(double contact_dista
 
 double FCLCollisionObjectWrapper::getContactDistanceThreshold() const { return contact_distance_; }
 
+void FCLCollisionObjectWrapper::setCollisionGeometry(
+    const std::shared_ptr<fcl::CollisionGeometry<double>>& collision_geometry)
+{
+  cgeom = collision_geometry;
+  cgeom_const = collision_geometry;
+}
+
 void FCLCollisionObjectWrapper::updateAABB()
 {
   if (t.linear().isIdentity())
@@ -74,5 +81,16 @@ void FCLCollisionObjectWrapper::updateAABB()
   }
 }
 
+void FCLCollisionObjectWrapper::updateCastAABB(const fcl::Transform3<double>& cast_tf, double sweep_distance)
+{
+  // The bounding sphere is used at both ends, so the AABB contains the object at any orientation along the motion
+  fcl::Vector3<double> center0 = t * cgeom->aabb_center;
+  fcl::Vector3<double> center1 = cast_tf * cgeom->aabb_center;
+  fcl::Vector3<double> delta =
+      fcl::Vector3<double>::Constant(cgeom->aabb_radius + contact_distance_ + sweep_distance);
+  aabb.min_ = center0.cwiseMin(center1) - delta;
+  aabb.max_ = center0.cwiseMax(center1) + delta;
+}
+
 }  // namespace tesseract_collision_fcl
 }  // namespace tesseract_collision
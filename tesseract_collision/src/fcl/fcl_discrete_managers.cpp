@@ -59,12 +59,19 @@ DiscreteContactManager::Ptr FCLDiscreteBVHManager::clone() const
 {
   auto manager = std::make_shared<FCLDiscreteBVHManager>();
 
+  // Keep the interned ids so collision objects handles and id keyed results are valid for the clone
+  manager->object_ids_ = std::make_shared<ObjectIdRegistry>(*object_ids_);
+
   for (const auto& cow : link2cow_)
     manager->addCollisionObject(cow.second->clone());
 
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(collision_margin_data_);
   manager->setIsContactAllowedFn(fn_);
+  manager->setContactPairCacheEnabled(pair_cache_ != nullptr);
+  if (pair_cache_ != nullptr && pair_cache_->isDistanceBoundEnabled())
+    manager->setDistanceBoundEnabled(true, pair_cache_->getSearchMargin());
+  manager->setSphereTreeEnabled(sphere_tree_tolerance_ > 0, sphere_tree_tolerance_);
 
   return manager;
 }
@@ -122,7 +129,10 @@ bool FCLDiscreteBVHManager::removeCollisionObject(const std::string& name)
     }
 
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    id2cow_[static_cast<std::size_t>(it->second->getObjectId())] = nullptr;
     link2cow_.erase(name);
+    if (pair_cache_ != nullptr)
+      pair_cache_->clear();
     return true;
   }
   return false;
@@ -150,6 +160,28 @@ bool FCLDiscreteBVHManager::disableCollisionObject(const std::string& name)
   return false;
 }
 
+bool FCLDiscreteBVHManager::updateCollisionObjectGeometries(const std::string& name)
+{
+  auto it = link2cow_.find(name);
+  if (it == link2cow_.end())
+    return false;
+
+  // The fcl collision objects stay registered, so only their AABB is updated in the broadphase
+  COW::Ptr& cow = it->second;
+  if (!cow->updateOctreeGeometries())
+    return true;
+
+  if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+    static_manager_->update(cow->getCollisionObjectsRaw());
+  else
+    dynamic_manager_->update(cow->getCollisionObjectsRaw());
+
+  if (pair_cache_ != nullptr)
+    pair_cache_->clear();
+
+  return true;
+}
+
 void FCLDiscreteBVHManager::setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose)
 {
   auto it = link2cow_.find(name);
@@ -184,32 +216,10 @@ void FCLDiscreteBVHManager::setCollisionObjectsTransform(const std::vector<std::
   {
     auto it = link2cow_.find(names[i]);
     if (it != link2cow_.end())
-    {
-      const Eigen::Isometry3d& cur_tf = it->second->getCollisionObjectsTransform();
-      // Note: If the transform has not changed do not updated to prevent unnecessary rebalancing of the BVH tree
-      if (!cur_tf.translation().isApprox(poses[i].translation(), 1e-8) ||
-          !cur_tf.rotation().isApprox(poses[i].rotation(), 1e-8))
-      {
-        it->second->setCollisionObjectsTransform(poses[i]);
-        std::vector<CollisionObjectRawPtr>& co = it->second->getCollisionObjectsRaw();
-        if (it->second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
-        {
-          static_update_.insert(static_update_.end(), co.begin(), co.end());
-        }
-        else
-        {
-          dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
-        }
-      }
-    }
+      queueCollisionObjectTransform(*it->second, poses[i]);
   }
 
-  // This is because FCL supports batch update which only rebalances the tree once
-  if (!static_update_.empty())
-    static_manager_->update(static_update_);
-
-  if (!dynamic_update_.empty())
-    dynamic_manager_->update(dynamic_update_);
+  updateQueuedCollisionObjects();
 }
 
 void FCLDiscreteBVHManager::setCollisionObjectsTransform(const tesseract_common::TransformMap& transforms)
@@ -220,32 +230,37 @@ void FCLDiscreteBVHManager::setCollisionObjectsTransform(const tesseract_common:
   {
     auto it = link2cow_.find(transform.first);
     if (it != link2cow_.end())
-    {
-      const Eigen::Isometry3d& cur_tf = it->second->getCollisionObjectsTransform();
-      // Note: If the transform has not changed do not updated to prevent unnecessary rebalancing of the BVH tree
-      if (!cur_tf.translation().isApprox(transform.second.translation(), 1e-8) ||
-          !cur_tf.rotation().isApprox(transform.second.rotation(), 1e-8))
-      {
-        it->second->setCollisionObjectsTransform(transform.second);
-        std::vector<CollisionObjectRawPtr>& co = it->second->getCollisionObjectsRaw();
-        if (it->second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
-        {
-          static_update_.insert(static_update_.end(), co.begin(), co.end());
-        }
-        else
-        {
-          dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
-        }
-      }
-    }
+      queueCollisionObjectTransform(*it->second, transform.second);
   }
 
-  // This is because FCL supports batch update which only rebalances the tree once
-  if (!static_update_.empty())
-    static_manager_->update(static_update_);
+  updateQueuedCollisionObjects();
+}
 
-  if (!dynamic_update_.empty())
-    dynamic_manager_->update(dynamic_update_);
+CollisionObjectsHandle FCLDiscreteBVHManager::createCollisionObjectsHandle(const std::vector<std::string>& names)
+{
+  return tesseract_collision::createCollisionObjectsHandle(names, *object_ids_);
+}
+
+void FCLDiscreteBVHManager::setCollisionObjectsTransform(const CollisionObjectsHandle& handle,
+                                                         const tesseract_common::VectorIsometry3d& poses)
+{
+  if (handle.ids.size() != handle.names.size())
+  {
+    setCollisionObjectsTransform(handle.names, poses);
+    return;
+  }
+
+  assert(handle.ids.size() == poses.size());
+  static_update_.clear();
+  dynamic_update_.clear();
+  for (std::size_t i = 0; i < handle.ids.size(); ++i)
+  {
+    const auto id = static_cast<std::size_t>(handle.ids[i]);
+    if (id < id2cow_.size() && id2cow_[id] != nullptr)
+      queueCollisionObjectTransform(*id2cow_[id], poses[i]);
+  }
+
+  updateQueuedCollisionObjects();
 }
 
 const std::vector<std::string>& FCLDiscreteBVHManager::getCollisionObjects() const { return collision_objects_; }
@@ -254,15 +269,54 @@ void FCLDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::str
 {
   active_ = names;
 
+  std::vector<std::string> sorted_active = active_;
+  std::sort(sorted_active.begin(), sorted_active.end());
+
+  bool changed = false;
   for (auto& co : link2cow_)
-    updateCollisionObjectFilters(active_, co.second, static_manager_, dynamic_manager_);
+  {
+    if (updateCollisionObjectFilters(
+            isLinkActiveSorted(sorted_active, co.first), co.second, static_manager_, dynamic_manager_))
+      changed = true;
+  }
 
-  // This causes a refit on the bvh tree.
-  dynamic_manager_->update();
-  static_manager_->update();
+  // This causes a refit on the bvh tree, which is only required if objects were moved between the trees.
+  if (changed)
+  {
+    dynamic_manager_->update();
+    static_manager_->update();
+  }
 }
 
 const std::vector<std::string>& FCLDiscreteBVHManager::getActiveCollisionObjects() const { return active_; }
+
+void FCLDiscreteBVHManager::setContactPairCacheEnabled(bool enabled)
+{
+  if (!enabled)
+    pair_cache_ = nullptr;
+  else if (pair_cache_ == nullptr)
+    pair_cache_ = std::make_shared<ContactPairCache>();
+}
+
+void FCLDiscreteBVHManager::setDistanceBoundEnabled(bool enabled, double search_margin)
+{
+  if (enabled)
+    setContactPairCacheEnabled(true);
+
+  if (pair_cache_ != nullptr)
+    pair_cache_->setDistanceBound(enabled, search_margin);
+}
+
+ContactPairCache::ConstPtr FCLDiscreteBVHManager::getContactPairCache() const { return pair_cache_; }
+
+void FCLDiscreteBVHManager::setSphereTreeEnabled(bool enabled, double tolerance)
+{
+  sphere_tree_tolerance_ = (enabled) ? tolerance : 0;
+  for (auto& cow : link2cow_)
+    cow.second->setSphereTreeTolerance(sphere_tree_tolerance_);
+}
+
+bool FCLDiscreteBVHManager::isSphereTreeEnabled() const { return sphere_tree_tolerance_ > 0; }
 void FCLDiscreteBVHManager::setCollisionMarginData(CollisionMarginData collision_margin_data,
                                                    CollisionMarginOverrideType override_type)
 {
@@ -316,28 +370,146 @@ void selfCollisionContactTest(ContactTestData& cdata,
   }
 }
 
-void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+/**
+ * @brief Run the broadphase and narrowphase checks for the provided contact test data
+ * @param cdata The contact test data passed to the callback
+ * @param static_manager The broadphase manager containing the static objects
+ * @param dynamic_manager The broadphase manager containing the dynamic objects
+ */
+static void runContactTest(ContactTestData& cdata,
+                           const std::unique_ptr<fcl::BroadPhaseCollisionManagerd>& static_manager,
+                           const std::unique_ptr<fcl::BroadPhaseCollisionManagerd>& dynamic_manager)
 {
-  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
-  if (collision_margin_data_.getMaxCollisionMargin() > 0 && request.calculate_distance)
+  if (cdata.collision_margin_data.getMaxCollisionMargin() > 0 && cdata.req.calculate_distance)
   {
     // TODO: Should the order be flipped?
-    if (!static_manager_->empty())
-      static_manager_->collide(dynamic_manager_.get(), &cdata, &distanceCallback);
+    if (!static_manager->empty())
+      static_manager->collide(dynamic_manager.get(), &cdata, &distanceCallback);
 
     // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
-    if (!cdata.done && !dynamic_manager_->empty())
-      dynamic_manager_->collide(&cdata, &distanceCallback);
+    if (!cdata.done && !dynamic_manager->empty())
+      dynamic_manager->collide(&cdata, &distanceCallback);
   }
   else
   {
     // TODO: Should the order be flipped?
-    if (!static_manager_->empty())
-      static_manager_->collide(dynamic_manager_.get(), &cdata, &collisionCallback);
+    if (!static_manager->empty())
+      static_manager->collide(dynamic_manager.get(), &cdata, &collisionCallback);
 
     // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
-    if (!cdata.done && !dynamic_manager_->empty())
-      dynamic_manager_->collide(&cdata, &collisionCallback);
+    if (!cdata.done && !dynamic_manager->empty())
+      dynamic_manager->collide(&cdata, &collisionCallback);
+  }
+}
+
+void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
+{
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  cdata.pair_cache = pair_cache_.get();
+  runContactTest(cdata, static_manager_, dynamic_manager_);
+}
+
+void FCLDiscreteBVHManager::contactTest(ContactResultIdMap& collisions, const ContactRequest& request)
+{
+  collisions.setObjectIdRegistry(object_ids_);
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  cdata.pair_cache = pair_cache_.get();
+  runContactTest(cdata, static_manager_, dynamic_manager_);
+}
+
+void FCLDiscreteBVHManager::contactTest(ContactDistanceResultMap& collisions, const ContactRequest& request)
+{
+  collisions.setObjectIdRegistry(object_ids_);
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions);
+  cdata.pair_cache = pair_cache_.get();
+  runContactTest(cdata, static_manager_, dynamic_manager_);
+}
+
+void FCLDiscreteBVHManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                             const std::vector<tesseract_common::TransformMap>& states,
+                                             const ContactRequest& request)
+{
+  collisions.resize(states.size());
+  if (states.empty())
+    return;
+
+  // The contact test data is shared by all states, only the result container changes between states
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions[0]);
+  cdata.pair_cache = pair_cache_.get();
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    setCollisionObjectsTransform(states[i]);
+
+    collisions[i].clear();
+    cdata.res = &collisions[i];
+    cdata.done = false;
+    cdata.num_contacts = 0;
+    runContactTest(cdata, static_manager_, dynamic_manager_);
+  }
+}
+
+void FCLDiscreteBVHManager::batchContactTest(std::vector<ContactResultMap>& collisions,
+                                             const std::vector<std::string>& names,
+                                             const tesseract_common::VectorIsometry3d& poses,
+                                             const ContactRequest& request)
+{
+  assert(!names.empty() && (poses.size() % names.size()) == 0);
+  const std::size_t num_states = (names.empty()) ? 0 : poses.size() / names.size();
+
+  collisions.resize(num_states);
+  if (num_states == 0)
+    return;
+
+  // Lookup the collision objects once for all states
+  std::vector<COW*> cows;
+  cows.reserve(names.size());
+  for (const auto& name : names)
+  {
+    auto it = link2cow_.find(name);
+    cows.push_back((it != link2cow_.end()) ? it->second.get() : nullptr);
+  }
+
+  // The contact test data is shared by all states, only the result container changes between states
+  ContactTestData cdata(active_, collision_margin_data_, fn_, request, collisions[0]);
+  cdata.pair_cache = pair_cache_.get();
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    const std::size_t offset = i * names.size();
+    static_update_.clear();
+    dynamic_update_.clear();
+    for (std::size_t j = 0; j < cows.size(); ++j)
+    {
+      COW* cow = cows[j];
+      if (cow == nullptr)
+        continue;
+
+      const Eigen::Isometry3d& pose = poses[offset + j];
+      const Eigen::Isometry3d& cur_tf = cow->getCollisionObjectsTransform();
+      // Note: If the transform has not changed do not updated to prevent unnecessary rebalancing of the BVH tree
+      if (!cur_tf.translation().isApprox(pose.translation(), 1e-8) ||
+          !cur_tf.rotation().isApprox(pose.rotation(), 1e-8))
+      {
+        cow->setCollisionObjectsTransform(pose);
+        std::vector<CollisionObjectRawPtr>& co = cow->getCollisionObjectsRaw();
+        if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+          static_update_.insert(static_update_.end(), co.begin(), co.end());
+        else
+          dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+      }
+    }
+
+    // This is because FCL supports batch update which only rebalances the tree once
+    if (!static_update_.empty())
+      static_manager_->update(static_update_);
+
+    if (!dynamic_update_.empty())
+      dynamic_manager_->update(dynamic_update_);
+
+    collisions[i].clear();
+    cdata.res = &collisions[i];
+    cdata.done = false;
+    cdata.num_contacts = 0;
+    runContactTest(cdata, static_manager_, dynamic_manager_);
   }
 }
 
@@ -347,8 +519,16 @@ void FCLDiscreteBVHManager::addCollisionObject(COW::Ptr cow)
   fcl_co_count_ += cnt;
   static_update_.reserve(fcl_co_count_);
   dynamic_update_.reserve(fcl_co_count_);
+  cow->setObjectId(object_ids_->intern(cow->getName()));
+  if (static_cast<std::size_t>(cow->getObjectId()) >= id2cow_.size())
+    id2cow_.resize(object_ids_->size());
+  id2cow_[static_cast<std::size_t>(cow->getObjectId())] = cow;
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
+  if (sphere_tree_tolerance_ > 0)
+    cow->setSphereTreeTolerance(sphere_tree_tolerance_);
+  if (pair_cache_ != nullptr)
+    pair_cache_->clear();
 
   std::vector<CollisionObjectPtr>& objects = cow->getCollisionObjects();
   if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
@@ -372,6 +552,31 @@ void FCLDiscreteBVHManager::addCollisionObject(COW::Ptr cow)
   static_manager_->update();
 }
 
+void FCLDiscreteBVHManager::queueCollisionObjectTransform(COW& cow, const Eigen::Isometry3d& pose)
+{
+  const Eigen::Isometry3d& cur_tf = cow.getCollisionObjectsTransform();
+  // Note: If the transform has not changed do not updated to prevent unnecessary rebalancing of the BVH tree
+  if (!cur_tf.translation().isApprox(pose.translation(), 1e-8) || !cur_tf.rotation().isApprox(pose.rotation(), 1e-8))
+  {
+    cow.setCollisionObjectsTransform(pose);
+    std::vector<CollisionObjectRawPtr>& co = cow.getCollisionObjectsRaw();
+    if (cow.m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
+      static_update_.insert(static_update_.end(), co.begin(), co.end());
+    else
+      dynamic_update_.insert(dynamic_update_.end(), co.begin(), co.end());
+  }
+}
+
+void FCLDiscreteBVHManager::updateQueuedCollisionObjects()
+{
+  // This is because FCL supports batch update which only rebalances the tree once
+  if (!static_update_.empty())
+    static_manager_->update(static_update_);
+
+  if (!dynamic_update_.empty())
+    dynamic_manager_->update(dynamic_update_);
+}
+
 void FCLDiscreteBVHManager::onCollisionMarginDataChanged()
 {
   static_update_.clear();
@@ -49,7 +49,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <fcl/geometry/shape/cone-inl.h>
 #include <fcl/geometry/shape/capsule-inl.h>
 #include <fcl/geometry/octree/octree-inl.h>
+#include <limits>
 #include <memory>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/fcl/fcl_utils.h>
@@ -95,9 +97,13 @@ CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Mesh::ConstP
   const tesseract_common::VectorVector3d& vertices = *(geom->getVertices());
   const Eigen::VectorXi& triangles = *(geom->getTriangles());
 
-  auto g = std::make_shared<fcl::BVHModel<fcl::OBBRSSd>>();
   if (vertice_count > 0 && triangle_count > 0)
   {
+    ShapeCacheKey key(geom->getVertices(), geom->getTriangles());
+    CollisionGeometryPtr cached = getShapeCache().get(key);
+    if (cached != nullptr)
+      return cached;
+
     std::vector<fcl::Triangle> tri_indices(static_cast<size_t>(triangle_count));
     for (int i = 0; i < triangle_count; ++i)
     {
@@ -107,11 +113,13 @@ CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Mesh::ConstP
                                                           static_cast<size_t>(triangles[(4 * i) + 3]));
     }
 
+    auto g = std::make_shared<fcl::BVHModel<fcl::OBBRSSd>>();
     g->beginModel();
     g->addSubModel(vertices, tri_indices);
     g->endModel();
+    g->computeLocalAABB();
 
-    return g;
+    return getShapeCache().insert(key, g);
   }
 
   CONSOLE_BRIDGE_logError("The mesh is empty!");
@@ -125,15 +133,29 @@ CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::ConvexMesh::
 
   if (vertice_count > 0 && face_count > 0)
   {
+    ShapeCacheKey key(geom->getVertices(), geom->getFaces());
+    CollisionGeometryPtr cached = getShapeCache().get(key);
+    if (cached != nullptr)
+      return cached;
+
     auto faces = std::make_shared<const std::vector<int>>(geom->getFaces()->data(),
                                                           geom->getFaces()->data() + geom->getFaces()->size());
-    return std::make_shared<fcl::Convexd>(geom->getVertices(), face_count, faces);
+    auto g = std::make_shared<fcl::Convexd>(geom->getVertices(), face_count, faces);
+    g->computeLocalAABB();
+
+    return getShapeCache().insert(key, g);
   }
 
   CONSOLE_BRIDGE_logError("The mesh is empty!");
   return nullptr;
 }
 
+ShapeCache<fcl::CollisionGeometryd>& getShapeCache()
+{
+  static ShapeCache<fcl::CollisionGeometryd> cache;
+  return cache;
+}
+
 CollisionGeometryPtr createShapePrimitive(const tesseract_geometry::Octree::ConstPtr& geom)
 {
   switch (geom->getSubType())
@@ -183,6 +205,16 @@ CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom)
     {
       return createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::Mesh>(geom));
     }
+    case tesseract_geometry::GeometryType::SDF_MESH:
+    {
+      // FCL has no signed distance field shape so the triangles are checked as a regular mesh
+      auto sdf_mesh = std::static_pointer_cast<const tesseract_geometry::SDFMesh>(geom);
+      return createShapePrimitive(std::make_shared<const tesseract_geometry::Mesh>(sdf_mesh->getVertices(),
+                                                                                   sdf_mesh->getTriangles(),
+                                                                                   sdf_mesh->getTriangleCount(),
+                                                                                   sdf_mesh->getResource(),
+                                                                                   sdf_mesh->getScale()));
+    }
     case tesseract_geometry::GeometryType::CONVEX_MESH:
     {
       return createShapePrimitive(std::static_pointer_cast<const tesseract_geometry::ConvexMesh>(geom));
@@ -200,6 +232,85 @@ CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom)
   }
 }
 
+/**
+ * @brief Process a contact of the distance only query without computing the full contact result
+ * @param cdata The collision results
+ * @param distance The signed distance
+ * @param p1 The nearest point on the first object in world coordinates
+ * @param p2 The nearest point on the second object in world coordinates
+ * @param normal The normal in world coordinates pointing from the first to the second object
+ * @param cd1 The first collision object
+ * @param cd2 The second collision object
+ */
+static void processDistanceContact(ContactTestData& cdata,
+                                   double distance,
+                                   const Eigen::Vector3d& p1,
+                                   const Eigen::Vector3d& p2,
+                                   const Eigen::Vector3d& normal,
+                                   const CollisionObjectWrapper& cd1,
+                                   const CollisionObjectWrapper& cd2)
+{
+  ContactDistanceResult contact{};
+  contact.distance = distance;
+  contact.link_ids[0] = cd1.getObjectId();
+  contact.link_ids[1] = cd2.getObjectId();
+  if (cdata.req.calculate_nearest_points)
+  {
+    Eigen::Map<Eigen::Vector3d>(contact.nearest_points[0].data()) = p1;
+    Eigen::Map<Eigen::Vector3d>(contact.nearest_points[1].data()) = p2;
+    Eigen::Map<Eigen::Vector3d>(contact.normal.data()) = normal;
+  }
+
+  processDistanceResult(cdata, contact, cd1.getName(), cd2.getName());
+}
+
+void processContact(ContactTestData& cdata,
+                    ContactResult& contact,
+                    const CollisionObjectWrapper& cd1,
+                    const CollisionObjectWrapper& cd2)
+{
+  if (cdata.pair_cache_entry != nullptr)
+  {
+    contact.link_names[0] = cd1.getName();
+    contact.link_names[1] = cd2.getName();
+    cdata.pair_cache_entry->contacts.push_back(contact);
+  }
+
+  if (cdata.res_distance != nullptr)
+  {
+    contact.link_names[0] = cd1.getName();
+    contact.link_names[1] = cd2.getName();
+    if (!cdata.req.is_valid || cdata.req.is_valid(contact))
+      processDistanceResult(
+          cdata, toContactDistanceResult(contact, cdata.req.calculate_nearest_points), cd1.getName(), cd2.getName());
+
+    return;
+  }
+
+  if (cdata.res_ids != nullptr)
+  {
+    if (cdata.req.is_valid)
+    {
+      contact.link_names[0] = cd1.getName();
+      contact.link_names[1] = cd2.getName();
+    }
+
+    ObjectPairId pc = getObjectPairId(cd1.getObjectId(), cd2.getObjectId());
+    bool found = (cdata.res_ids->find(pc) != cdata.res_ids->end());
+    processResult(cdata, contact, pc, cd1.getName(), cd2.getName(), found);
+    return;
+  }
+
+  contact.link_names[0] = cd1.getName();
+  contact.link_names[1] = cd2.getName();
+
+  ObjectPairKey pc = getObjectPairKey(cd1.getName(), cd2.getName());
+  const auto& it = cdata.res->find(pc);
+  bool found = (it != cdata.res->end());
+
+  processResult(cdata, contact, pc, found);
+}
+
 bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
 {
   auto* cdata = reinterpret_cast<ContactTestData*>(data);
@@ -225,24 +336,81 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
   std::size_t num_contacts = (cdata->req.contact_limit > 0) ? static_cast<std::size_t>(cdata->req.contact_limit) :
                                                               std::numeric_limits<std::size_t>::max();
   if (cdata->req.type == ContactTestType::FIRST)
+  {
     num_contacts = 1;
+  }
+  else if (cdata->req.type == ContactTestType::LIMITED)
+  {
+    // Only request the contacts that can still be stored
+    if (cdata->req.contact_limit > 0)
+      num_contacts = static_cast<std::size_t>(cdata->req.contact_limit - cdata->num_contacts);
+
+    if (cdata->req.pair_contact_limit > 0)
+      num_contacts = std::min(num_contacts, static_cast<std::size_t>(cdata->req.pair_contact_limit));
+  }
+
+  // The contacts depend on the number of contacts requested and if the penetration is calculated
+  const std::size_t settings = (num_contacts << 1U) | (cdata->req.calculate_penetration ? 1U : 0U);
+  ContactPairCacheScope cache_scope(*cdata);
+  if (cache_scope.isEnabled() && cache_scope.lookup(*cd1,
+                                                    cd1->getShapeIndex(o1),
+                                                    cd1->getCollisionObjectsTransform(),
+                                                    *cd2,
+                                                    cd2->getShapeIndex(o2),
+                                                    cd2->getCollisionObjectsTransform(),
+                                                    cdata->collision_margin_data.getMaxCollisionMargin(),
+                                                    settings))
+    return cdata->done;
+
+  double sphere_tree_distance{ 0 };
+  if (isSphereTreeSeparated(*cdata,
+                            *cd1,
+                            cd1->getShapeIndex(o1),
+                            cd1->getCollisionObjectsTransform(),
+                            *cd2,
+                            cd2->getShapeIndex(o2),
+                            cd2->getCollisionObjectsTransform(),
+                            cdata->collision_margin_data.getMaxCollisionMargin(),
+                            sphere_tree_distance))
+  {
+    cache_scope.setDistance(sphere_tree_distance);
+    return false;
+  }
+
+  // fcl::collide only detects penetration so the distance bound of the pair stays unknown
 
   fcl::CollisionResultd col_result;
   fcl::collide(o1, o2, fcl::CollisionRequestd(num_contacts, cdata->req.calculate_penetration, 1, false), col_result);
 
-  if (col_result.isCollision())
+  if (col_result.isCollision() && cdata->res_distance != nullptr && !cdata->req.is_valid &&
+      cdata->pair_cache_entry == nullptr)
+  {
+    // The distance only query does not need the transforms and local points
+    for (size_t i = 0; i < col_result.numContacts() && !cdata->done; ++i)
+    {
+      const fcl::Contactd& fcl_contact = col_result.getContact(i);
+      processDistanceContact(*cdata,
+                             -1.0 * fcl_contact.penetration_depth,
+                             fcl_contact.pos,
+                             fcl_contact.pos,
+                             fcl_contact.normal,
+                             *cd1,
+                             *cd2);
+    }
+  }
+  else if (col_result.isCollision())
   {
     Eigen::Isometry3d tf1 = cd1->getCollisionObjectsTransform();
     Eigen::Isometry3d tf2 = cd2->getCollisionObjectsTransform();
     Eigen::Isometry3d tf1_inv = tf1.inverse();
     Eigen::Isometry3d tf2_inv = tf2.inverse();
 
-    for (size_t i = 0; i < col_result.numContacts(); ++i)
+    for (size_t i = 0; i < col_result.numContacts() && !cdata->done; ++i)
     {
       const fcl::Contactd& fcl_contact = col_result.getContact(i);
       ContactResult contact;
-      contact.link_names[0] = cd1->getName();
-      contact.link_names[1] = cd2->getName();
+      contact.link_ids[0] = cd1->getObjectId();
+      contact.link_ids[1] = cd2->getObjectId();
       contact.shape_id[0] = static_cast<int>(cd1->getShapeIndex(o1));
       contact.shape_id[1] = static_cast<int>(cd2->getShapeIndex(o2));
       contact.subshape_id[0] = static_cast<int>(fcl_contact.b1);
@@ -258,11 +426,7 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
       contact.distance = -1.0 * fcl_contact.penetration_depth;
       contact.normal = fcl_contact.normal;
 
-      ObjectPairKey pc = getObjectPairKey(cd1->getName(), cd2->getName());
-      const auto& it = cdata->res->find(pc);
-      bool found = (it != cdata->res->end());
-
-      processResult(*cdata, contact, pc, found);
+      processContact(*cdata, contact, *cd1, *cd2);
     }
   }
 
@@ -291,11 +455,59 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
   if (!needs_collision)
     return false;
 
+  ContactPairCacheScope cache_scope(*cdata);
+  if (cache_scope.isEnabled() && cache_scope.lookup(*cd1,
+                                                    cd1->getShapeIndex(o1),
+                                                    cd1->getCollisionObjectsTransform(),
+                                                    *cd2,
+                                                    cd2->getShapeIndex(o2),
+                                                    cd2->getCollisionObjectsTransform(),
+                                                    cdata->collision_margin_data.getMaxCollisionMargin()))
+    return cdata->done;
+
+  double sphere_tree_distance{ 0 };
+  if (isSphereTreeSeparated(*cdata,
+                            *cd1,
+                            cd1->getShapeIndex(o1),
+                            cd1->getCollisionObjectsTransform(),
+                            *cd2,
+                            cd2->getShapeIndex(o2),
+                            cd2->getCollisionObjectsTransform(),
+                            cdata->collision_margin_data.getMaxCollisionMargin(),
+                            sphere_tree_distance))
+  {
+    cache_scope.setDistance(sphere_tree_distance);
+    return false;
+  }
+
+  // fcl::distance computes the distance of the pair regardless of the contact distance
+  cache_scope.searchDistance(std::numeric_limits<double>::max());
+
+  // The distance only query does not need the transforms and local points, and the nearest points only if requested.
+  // The contact pair cache stores the full contact results.
+  const bool distance_only =
+      (cdata->res_distance != nullptr && !cdata->req.is_valid && cdata->pair_cache_entry == nullptr);
+
   fcl::DistanceResultd fcl_result;
-  fcl::DistanceRequestd fcl_request(true, true);
+  fcl::DistanceRequestd fcl_request(!distance_only || cdata->req.calculate_nearest_points, true);
   double d = fcl::distance(o1, o2, fcl_request, fcl_result);
+  updateContactPairCacheDistance(*cdata, d);
 
-  if (d < cdata->collision_margin_data.getMaxCollisionMargin())
+  if (distance_only && d < cdata->collision_margin_data.getMaxCollisionMargin())
+  {
+    Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+    if (cdata->req.calculate_nearest_points)
+      normal = (fcl_result.min_distance * (fcl_result.nearest_points[1] - fcl_result.nearest_points[0])).normalized();
+
+    processDistanceContact(*cdata,
+                           fcl_result.min_distance,
+                           fcl_result.nearest_points[0],
+                           fcl_result.nearest_points[1],
+                           normal,
+                           *cd1,
+                           *cd2);
+  }
+  else if (d < cdata->collision_margin_data.getMaxCollisionMargin())
   {
     Eigen::Isometry3d tf1 = cd1->getCollisionObjectsTransform();
     Eigen::Isometry3d tf2 = cd2->getCollisionObjectsTransform();
@@ -303,8 +515,8 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
     Eigen::Isometry3d tf2_inv = tf2.inverse();
 
     ContactResult contact;
-    contact.link_names[0] = cd1->getName();
-    contact.link_names[1] = cd2->getName();
+    contact.link_ids[0] = cd1->getObjectId();
+    contact.link_ids[1] = cd2->getObjectId();
     contact.shape_id[0] = cd1->getShapeIndex(o1);
     contact.shape_id[1] = cd2->getShapeIndex(o2);
     contact.subshape_id[0] = static_cast<int>(fcl_result.b1);
@@ -323,13 +535,190 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
     // TODO: There is an issue with FCL need to track down
     assert(!std::isnan(contact.nearest_points[0](0)));
 
-    ObjectPairKey pc = getObjectPairKey(cd1->getName(), cd2->getName());
-    const auto& it = cdata->res->find(pc);
-    bool found = (it != cdata->res->end());
+    processContact(*cdata, contact, *cd1, *cd2);
+  }
+
+  return cdata->done;
+}
+
+/** @brief Get an upper bound of the distance any point of a collision object moves along its cast motion */
+static double getCastMotionBound(const CollisionObjectWrapper& cow)
+{
+  return getMotionBound(
+      cow.getCollisionObjectsTransform(), cow.getCollisionObjectsCastTransform(), cow.getBoundingRadius());
+}
+
+/** @brief Set the continuous contact data of a moving collision object in the contact result */
+static void
+setCastContactData(ContactResult& contact, std::size_t index, const CollisionObjectWrapper& cow, double time)
+{
+  if (cow.m_collisionFilterGroup != CollisionFilterGroups::KinematicFilter)
+    return;
+
+  contact.cc_time[index] = time;
+  contact.cc_transform[index] = cow.getCollisionObjectsCastTransform();
+  if (time <= 0)
+    contact.cc_type[index] = ContinuousCollisionType::CCType_Time0;
+  else if (time >= 1)
+    contact.cc_type[index] = ContinuousCollisionType::CCType_Time1;
+  else
+    contact.cc_type[index] = ContinuousCollisionType::CCType_Between;
+}
 
-    processResult(*cdata, contact, pc, found);
+bool castCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
+{
+  auto* cdata = reinterpret_cast<ContactTestData*>(data);
+
+  if (cdata->done)
+    return true;
+
+  const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
+  const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
+  assert(cd1->getName() != cd2->getName());
+
+  bool needs_collision = cd1->m_enabled && cd2->m_enabled &&
+                         (cd1->m_collisionFilterGroup & cd2->m_collisionFilterMask) &&
+                         (cd2->m_collisionFilterGroup & cd1->m_collisionFilterMask) &&
+                         !isContactAllowed(cd1->getName(), cd2->getName(), cdata->fn, false);
+
+  assert(std::find(cdata->active->begin(), cdata->active->end(), cd1->getName()) != cdata->active->end() ||
+         std::find(cdata->active->begin(), cdata->active->end(), cd2->getName()) != cdata->active->end());
+
+  if (!needs_collision)
+    return false;
+
+  // The fcl collision objects are located at the start of the motion
+  const Eigen::Isometry3d shape_tf1 = cd1->getCollisionObjectsTransform().inverse() * o1->getTransform();
+  const Eigen::Isometry3d shape_tf2 = cd2->getCollisionObjectsTransform().inverse() * o2->getTransform();
+  const double motion_bound = getCastMotionBound(*cd1) + getCastMotionBound(*cd2);
+
+  // The distance of meshes is zero when they intersect, so a collision margin of zero includes touching objects
+  const double margin = detail::getCollisionMargin(*cdata, cd1->getName(), cd2->getName());
+  const double target_distance = std::max(margin, 0.0);
+
+  fcl::DistanceRequestd fcl_request(true, true);
+  fcl::DistanceResultd fcl_result;
+  double distance{ 0 };
+  auto isWithinMargin = [&](double time) {
+    fcl_result.clear();
+    distance = fcl::distance(o1->collisionGeometry().get(),
+                             cd1->getCastTransform(time) * shape_tf1,
+                             o2->collisionGeometry().get(),
+                             cd2->getCastTransform(time) * shape_tf2,
+                             fcl_request,
+                             fcl_result);
+    return (margin > 0) ? (distance < margin) : (distance <= margin);
+  };
+
+  // An interval of the motion skipped by a forced step, with the distances at its ends
+  struct SkippedInterval
+  {
+    double start_time;
+    double start_distance;
+    double end_time;
+    double end_distance;
+    bool end_within_margin;
+  };
+
+  // Search a skipped interval for the first time within the collision margin, visiting its subintervals in order of
+  // time. A subinterval is passed if the distances at its ends and the motion bound rule out coming within the
+  // collision margin by more than FCL_CAST_TOLERANCE in between. Otherwise it is split in half, so a forced step never
+  // moves past a thin obstacle.
+  double contact_time{ 0 };
+  std::vector<SkippedInterval> skipped_intervals;
+  auto findSkippedContact = [&](const SkippedInterval& skipped, double tolerance) {
+    skipped_intervals.clear();
+    skipped_intervals.push_back(skipped);
+    while (!skipped_intervals.empty())
+    {
+      const SkippedInterval interval = skipped_intervals.back();
+      skipped_intervals.pop_back();
+
+      const double duration = interval.end_time - interval.start_time;
+      const double min_distance = (interval.start_distance + interval.end_distance - motion_bound * duration) / 2;
+      if (!interval.end_within_margin && min_distance > target_distance - FCL_CAST_TOLERANCE)
+        continue;
+
+      // A subinterval shorter than the tolerance is only left when it ends within the collision margin
+      if (duration <= tolerance)
+      {
+        contact_time = interval.end_time;
+        isWithinMargin(contact_time);
+        return true;
+      }
+
+      const double time = (interval.start_time + interval.end_time) / 2;
+      const bool within_margin = isWithinMargin(time);
+      skipped_intervals.push_back(
+          { time, distance, interval.end_time, interval.end_distance, interval.end_within_margin });
+      skipped_intervals.push_back({ interval.start_time, interval.start_distance, time, distance, within_margin });
+    }
+    return false;
+  };
+
+  if (!isWithinMargin(contact_time))
+  {
+    if (motion_bound <= 0)
+      return false;
+
+    // A pair that stays just outside of the collision margin only advances by the minimum step, so the minimum step is
+    // raised after every FCL_CAST_MAX_ITERATIONS steps to bound the number of steps needed to reach the end of the
+    // motion. A raised minimum step may move past the first time within the collision margin, so the interval it
+    // skipped is searched.
+    const double tolerance = FCL_CAST_TOLERANCE / motion_bound;
+    double min_step = tolerance;
+    for (int i = 1;; ++i)
+    {
+      // The objects are not within the collision margin along the whole motion
+      if (contact_time >= 1)
+        return false;
+
+      if (i % FCL_CAST_MAX_ITERATIONS == 0)
+        min_step *= 10;
+
+      const double step = (distance - target_distance) / motion_bound;
+      const double last_time = contact_time;
+      const double last_distance = distance;
+      contact_time = std::min(contact_time + std::max(step, min_step), 1.0);
+      const bool within_margin = isWithinMargin(contact_time);
+      if (step < min_step && min_step > tolerance)
+      {
+        const double end_distance = distance;
+        if (findSkippedContact({ last_time, last_distance, contact_time, end_distance, within_margin }, tolerance))
+          break;
+
+        distance = end_distance;
+      }
+      else if (within_margin)
+        break;
+    }
   }
 
+  const Eigen::Isometry3d tf1 = cd1->getCastTransform(contact_time);
+  const Eigen::Isometry3d tf2 = cd2->getCastTransform(contact_time);
+
+  ContactResult contact;
+  contact.link_ids[0] = cd1->getObjectId();
+  contact.link_ids[1] = cd2->getObjectId();
+  contact.shape_id[0] = cd1->getShapeIndex(o1);
+  contact.shape_id[1] = cd2->getShapeIndex(o2);
+  contact.subshape_id[0] = static_cast<int>(fcl_result.b1);
+  contact.subshape_id[1] = static_cast<int>(fcl_result.b2);
+  contact.nearest_points[0] = fcl_result.nearest_points[0];
+  contact.nearest_points[1] = fcl_result.nearest_points[1];
+  contact.nearest_points_local[0] = tf1.inverse() * contact.nearest_points[0];
+  contact.nearest_points_local[1] = tf2.inverse() * contact.nearest_points[1];
+  contact.transform[0] = cd1->getCollisionObjectsTransform();
+  contact.transform[1] = cd2->getCollisionObjectsTransform();
+  contact.type_id[0] = cd1->getTypeID();
+  contact.type_id[1] = cd2->getTypeID();
+  contact.distance = fcl_result.min_distance;
+  contact.normal = (fcl_result.min_distance * (contact.nearest_points[1] - contact.nearest_points[0])).normalized();
+  setCastContactData(contact, 0, *cd1, contact_time);
+  setCastContactData(contact, 1, *cd2, contact_time);
+
+  processContact(*cdata, contact, *cd1, *cd2);
+
   return cdata->done;
 }
 
@@ -337,7 +726,11 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
                                                const int& type_id,
                                                CollisionShapesConst shapes,
                                                tesseract_common::VectorIsometry3d shape_poses)
-  : name_(std::move(name)), type_id_(type_id), shapes_(std::move(shapes)), shape_poses_(std::move(shape_poses))
+  : name_(std::move(name))
+  , type_id_(type_id)
+  , world_pose_(Eigen::Isometry3d::Identity())
+  , shapes_(std::move(shapes))
+  , shape_poses_(std::move(shape_poses))
 {
   assert(!shapes_.empty());
   assert(!shape_poses_.empty());
@@ -350,8 +743,15 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
   collision_geometries_.reserve(shapes_.size());
   collision_objects_.reserve(shapes_.size());
   collision_objects_raw_.reserve(shapes_.size());
+  shape_indices_.reserve(shapes_.size());
+  octree_revisions_.reserve(shapes_.size());
   for (std::size_t i = 0; i < shapes_.size(); ++i)
   {
+    // The revision is read first so an update in between is processed again by the next update
+    std::size_t revision = 0;
+    if (shapes_[i]->getType() == tesseract_geometry::GeometryType::OCTREE)
+      revision = static_cast<const tesseract_geometry::Octree&>(*shapes_[i]).getRevision();
+
     CollisionGeometryPtr subshape = createShapePrimitive(shapes_[i]);
     if (subshape != nullptr)
     {
@@ -362,10 +762,56 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
       co->updateAABB();
       collision_objects_.push_back(co);
       collision_objects_raw_.push_back(co.get());
+      shape_indices_.push_back(i);
+      octree_revisions_.push_back(revision);
+
+      bounding_radius_ =
+          std::max(bounding_radius_, (shape_poses_[i] * subshape->aabb_center).norm() + subshape->aabb_radius);
     }
   }
 }
 
+bool CollisionObjectWrapper::updateOctreeGeometries()
+{
+  bool changed = false;
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+  {
+    const CollisionShapeConstPtr& shape = shapes_[shape_indices_[i]];
+    if (shape->getType() != tesseract_geometry::GeometryType::OCTREE)
+      continue;
+
+    const std::size_t revision = static_cast<const tesseract_geometry::Octree&>(*shape).getRevision();
+    if (revision == octree_revisions_[i])
+      continue;
+
+    CollisionGeometryPtr subshape = createShapePrimitive(shape);
+    if (subshape == nullptr)
+      continue;
+
+    // The geometry is shared with the clones, so it is replaced instead of changed
+    collision_geometries_[i] = subshape;
+    collision_objects_[i]->setCollisionGeometry(subshape);
+    octree_revisions_[i] = revision;
+    changed = true;
+  }
+
+  if (!changed)
+    return false;
+
+  bounding_radius_ = 0;
+  for (std::size_t i = 0; i < collision_geometries_.size(); ++i)
+    bounding_radius_ = std::max(bounding_radius_,
+                                (shape_poses_[shape_indices_[i]] * collision_geometries_[i]->aabb_center).norm() +
+                                    collision_geometries_[i]->aabb_radius);
+
+  if (cast_)
+    setCollisionObjectsTransform(world_pose_, world_cast_pose_);
+  else
+    setCollisionObjectsTransform(world_pose_);
+
+  return true;
+}
+
 int CollisionObjectWrapper::getShapeIndex(const fcl::CollisionObjectd* co) const
 {
   auto it = std::find_if(collision_objects_.begin(), collision_objects_.end(), [&co](const CollisionObjectPtr& c) {
@@ -378,5 +824,56 @@ int CollisionObjectWrapper::getShapeIndex(const fcl::CollisionObjectd* co) const
   return -1;
 }
 
+void CollisionObjectWrapper::setCollisionObjectsTransform(const Eigen::Isometry3d& pose1,
+                                                          const Eigen::Isometry3d& pose2)
+{
+  world_pose_ = pose1;
+  world_cast_pose_ = pose2;
+  cast_ = true;
+
+  // Compared to moving along the straight line between its start and end location a point at distance r from the
+  // origin deviates at most r * angle^2 / 8 because of the rotation
+  const double angle = Eigen::AngleAxisd(pose1.linear().transpose() * pose2.linear()).angle();
+  const double sweep_distance = bounding_radius_ * angle * angle / 8.0;
+  for (unsigned i = 0; i < collision_objects_.size(); ++i)
+  {
+    CollisionObjectPtr& co = collision_objects_[i];
+    const Eigen::Isometry3d& shape_pose = shape_poses_[shape_indices_[i]];
+    co->setTransform(pose1 * shape_pose);
+    co->updateCastAABB(pose2 * shape_pose, sweep_distance);
+  }
+}
+
+Eigen::Isometry3d CollisionObjectWrapper::getCastTransform(double time) const
+{
+  if (!cast_ || time <= 0)
+    return world_pose_;
+
+  if (time >= 1)
+    return world_cast_pose_;
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  pose.linear() = Eigen::Quaterniond(world_pose_.linear())
+                      .slerp(time, Eigen::Quaterniond(world_cast_pose_.linear()))
+                      .toRotationMatrix();
+  pose.translation() = (1.0 - time) * world_pose_.translation() + time * world_cast_pose_.translation();
+  return pose;
+}
+
+void CollisionObjectWrapper::setSphereTreeTolerance(double tolerance)
+{
+  // The shape index of a collision object only matches the shapes if all of them are supported by fcl
+  if (tolerance <= 0 || collision_objects_.size() != shapes_.size())
+  {
+    sphere_trees_.clear();
+    sphere_tree_tolerance_ = 0;
+  }
+  else if (sphere_trees_.empty() || !tesseract_common::almostEqualRelativeAndAbs(tolerance, sphere_tree_tolerance_))
+  {
+    sphere_trees_ = createSphereTrees(shapes_, shape_poses_, tolerance);
+    sphere_tree_tolerance_ = tolerance;
+  }
+}
+
 }  // namespace tesseract_collision_fcl
 }  // namespace tesseract_collision
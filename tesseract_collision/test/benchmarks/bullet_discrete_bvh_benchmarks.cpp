@@ -3,6 +3,8 @@
 
 #include <tesseract_collision/test_suite/benchmarks/primatives_benchmarks.hpp>
 #include <tesseract_collision/test_suite/benchmarks/large_dataset_benchmarks.hpp>
+#include <tesseract_collision/test_suite/benchmarks/batch_contact_test_benchmarks.hpp>
+#include <tesseract_collision/test_suite/benchmarks/mesh_benchmarks.hpp>
 #include <tesseract_collision/test_suite/benchmarks/benchmark_utils.hpp>
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
 
@@ -214,6 +216,60 @@ int main(int argc, char** argv)
           ->Unit(benchmark::TimeUnit::kNanosecond);
     }
   }
+  //////////////////////////////////////
+  // Batch contactTest
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int, int)> BM_BATCH_CONTACT_TEST_FUNC =
+        BM_BATCH_CONTACT_TEST;
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int, int)> BM_BATCH_CONTACT_TEST_LOOP_FUNC =
+        BM_BATCH_CONTACT_TEST_LOOP;
+    std::vector<int> num_states = { 1, 10, 100 };
+
+    for (const auto& num_state : num_states)
+    {
+      std::string name = "BM_BATCH_CONTACT_TEST_" + checker->name() + "_STATES_" + std::to_string(num_state);
+      benchmark::RegisterBenchmark(name.c_str(), BM_BATCH_CONTACT_TEST_FUNC, checker->clone(), 4, num_state)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+    for (const auto& num_state : num_states)
+    {
+      std::string name = "BM_BATCH_CONTACT_TEST_LOOP_" + checker->name() + "_STATES_" + std::to_string(num_state);
+      benchmark::RegisterBenchmark(name.c_str(), BM_BATCH_CONTACT_TEST_LOOP_FUNC, checker->clone(), 4, num_state)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  //////////////////////////////////////
+  // Large mesh
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int)> BM_ADD_MESH_COLLISION_OBJECT_FUNC =
+        BM_ADD_MESH_COLLISION_OBJECT;
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int)> BM_MESH_CONTACT_TEST_FUNC =
+        BM_MESH_CONTACT_TEST;
+    std::vector<int> edge_sizes = { 10, 50, 160 };
+
+    for (const auto& edge_size : edge_sizes)
+    {
+      std::string triangles = std::to_string(2 * edge_size * edge_size);
+      std::string name = "BM_ADD_MESH_COLLISION_OBJECT_" + checker->name() + "_TRIANGLES_" + triangles;
+      benchmark::RegisterBenchmark(name.c_str(), BM_ADD_MESH_COLLISION_OBJECT_FUNC, checker->clone(), edge_size)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMillisecond);
+    }
+    for (const auto& edge_size : edge_sizes)
+    {
+      std::string triangles = std::to_string(2 * edge_size * edge_size);
+      std::string name = "BM_MESH_CONTACT_TEST_" + checker->name() + "_TRIANGLES_" + triangles;
+      benchmark::RegisterBenchmark(name.c_str(), BM_MESH_CONTACT_TEST_FUNC, checker->clone(), edge_size)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
   //////////////////////////////////////
   // Large Dataset contactTest
   //////////////////////////////////////
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Eigen>
+
+#include <tesseract_collision/test_suite/benchmarks/cast_benchmarks.hpp>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
+
+using namespace tesseract_collision;
+using namespace test_suite;
+
+int main(int argc, char** argv)
+{
+  // Both continuous contact managers are registered so their results are compared side by side
+  const std::vector<ContinuousContactManager::ConstPtr> checkers = {
+    std::make_shared<tesseract_collision_bullet::BulletCastBVHManager>(),
+    std::make_shared<tesseract_collision_fcl::FCLCastBVHManager>()
+  };
+  const std::vector<std::string> checker_names = { tesseract_collision_bullet::BulletCastBVHManager::name(),
+                                                   tesseract_collision_fcl::FCLCastBVHManager::name() };
+
+  //////////////////////////////////////
+  // Primitive contactTest
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, ContinuousContactManager::Ptr, bool)> BM_CAST_PRIMITIVE_CONTACT_TEST_FUNC =
+        BM_CAST_PRIMITIVE_CONTACT_TEST;
+    for (std::size_t i = 0; i < checkers.size(); ++i)
+    {
+      for (bool in_contact : { true, false })
+      {
+        std::string name = "BM_CAST_PRIMITIVE_CONTACT_TEST_" + checker_names[i] +
+                           ((in_contact) ? "_IN_CONTACT" : "_NOT_IN_CONTACT");
+        benchmark::RegisterBenchmark(
+            name.c_str(), BM_CAST_PRIMITIVE_CONTACT_TEST_FUNC, checkers[i]->clone(), in_contact)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // Mesh contactTest
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, ContinuousContactManager::Ptr, int)> BM_CAST_MESH_CONTACT_TEST_FUNC =
+        BM_CAST_MESH_CONTACT_TEST;
+    std::vector<int> edge_sizes = { 10, 50, 160 };
+    for (std::size_t i = 0; i < checkers.size(); ++i)
+    {
+      for (const auto& edge_size : edge_sizes)
+      {
+        std::string triangles = std::to_string(2 * edge_size * edge_size);
+        std::string name = "BM_CAST_MESH_CONTACT_TEST_" + checker_names[i] + "_TRIANGLES_" + triangles;
+        benchmark::RegisterBenchmark(name.c_str(), BM_CAST_MESH_CONTACT_TEST_FUNC, checkers[i]->clone(), edge_size)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Eigen>
+
+#include <tesseract_collision/test_suite/benchmarks/octree_benchmarks.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
+
+using namespace tesseract_collision;
+using namespace test_suite;
+
+int main(int argc, char** argv)
+{
+  const std::vector<DiscreteContactManager::ConstPtr> discrete_checkers = {
+    std::make_shared<tesseract_collision_bullet::BulletDiscreteBVHManager>(),
+    std::make_shared<tesseract_collision_fcl::FCLDiscreteBVHManager>()
+  };
+  const std::vector<std::string> discrete_checker_names = {
+    tesseract_collision_bullet::BulletDiscreteBVHManager::name(), tesseract_collision_fcl::FCLDiscreteBVHManager::name()
+  };
+
+  const std::vector<ContinuousContactManager::ConstPtr> cast_checkers = {
+    std::make_shared<tesseract_collision_bullet::BulletCastBVHManager>(),
+    std::make_shared<tesseract_collision_fcl::FCLCastBVHManager>()
+  };
+  const std::vector<std::string> cast_checker_names = { tesseract_collision_bullet::BulletCastBVHManager::name(),
+                                                        tesseract_collision_fcl::FCLCastBVHManager::name() };
+
+  // The floor has edge_size^2 occupied leafs, up to a million
+  const std::vector<int> edge_sizes = { 10, 100, 1000 };
+
+  //////////////////////////////////////
+  // Add octree collision object
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int)> BM_ADD_OCTREE_COLLISION_OBJECT_FUNC =
+        BM_ADD_OCTREE_COLLISION_OBJECT;
+    for (std::size_t i = 0; i < discrete_checkers.size(); ++i)
+    {
+      for (const auto& edge_size : edge_sizes)
+      {
+        std::string voxels = std::to_string(edge_size * edge_size);
+        std::string name = "BM_ADD_OCTREE_COLLISION_OBJECT_" + discrete_checker_names[i] + "_VOXELS_" + voxels;
+        benchmark::RegisterBenchmark(
+            name.c_str(), BM_ADD_OCTREE_COLLISION_OBJECT_FUNC, discrete_checkers[i]->clone(), edge_size)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // Octree contactTest
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int)> BM_OCTREE_CONTACT_TEST_FUNC =
+        BM_OCTREE_CONTACT_TEST;
+    for (std::size_t i = 0; i < discrete_checkers.size(); ++i)
+    {
+      for (const auto& edge_size : edge_sizes)
+      {
+        std::string voxels = std::to_string(edge_size * edge_size);
+        std::string name = "BM_OCTREE_CONTACT_TEST_" + discrete_checker_names[i] + "_VOXELS_" + voxels;
+        benchmark::RegisterBenchmark(
+            name.c_str(), BM_OCTREE_CONTACT_TEST_FUNC, discrete_checkers[i]->clone(), edge_size)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // Octree cast contactTest
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, ContinuousContactManager::Ptr, int)> BM_CAST_OCTREE_CONTACT_TEST_FUNC =
+        BM_CAST_OCTREE_CONTACT_TEST;
+    for (std::size_t i = 0; i < cast_checkers.size(); ++i)
+    {
+      for (const auto& edge_size : edge_sizes)
+      {
+        std::string voxels = std::to_string(edge_size * edge_size);
+        std::string name = "BM_CAST_OCTREE_CONTACT_TEST_" + cast_checker_names[i] + "_VOXELS_" + voxels;
+        benchmark::RegisterBenchmark(
+            name.c_str(), BM_CAST_OCTREE_CONTACT_TEST_FUNC, cast_checkers[i]->clone(), edge_size)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
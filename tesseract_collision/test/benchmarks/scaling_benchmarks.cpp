@@ -0,0 +1,257 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Eigen>
+
+#include <tesseract_collision/test_suite/benchmarks/scaling_benchmarks.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
+
+using namespace tesseract_collision;
+using namespace test_suite;
+
+/**
+ * @brief Create the name of a scaling benchmark
+ * @param type The name of the benchmark, followed by the manager, shape, objects, margin and contact test type
+ */
+static std::string createName(const std::string& type,
+                              const std::string& checker_name,
+                              ScalingShapeType shape_type,
+                              int num_objects,
+                              double margin,
+                              ContactTestType test_type)
+{
+  return type + "_" + checker_name + "_" + ScalingShapeTypeStrings[static_cast<std::size_t>(shape_type)] +
+         "_OBJECTS_" + std::to_string(num_objects) + "_MARGIN_" + std::to_string(margin) + "_" +
+         ContactTestTypeStrings[static_cast<std::size_t>(test_type)];
+}
+
+int main(int argc, char** argv)
+{
+  const std::vector<DiscreteContactManager::ConstPtr> discrete_checkers = {
+    std::make_shared<tesseract_collision_bullet::BulletDiscreteSimpleManager>(),
+    std::make_shared<tesseract_collision_bullet::BulletDiscreteBVHManager>(),
+    std::make_shared<tesseract_collision_fcl::FCLDiscreteBVHManager>()
+  };
+  const std::vector<std::string> discrete_checker_names = {
+    tesseract_collision_bullet::BulletDiscreteSimpleManager::name(),
+    tesseract_collision_bullet::BulletDiscreteBVHManager::name(),
+    tesseract_collision_fcl::FCLDiscreteBVHManager::name()
+  };
+
+  const std::vector<ContinuousContactManager::ConstPtr> cast_checkers = {
+    std::make_shared<tesseract_collision_bullet::BulletCastSimpleManager>(),
+    std::make_shared<tesseract_collision_bullet::BulletCastBVHManager>(),
+    std::make_shared<tesseract_collision_fcl::FCLCastBVHManager>()
+  };
+  const std::vector<std::string> cast_checker_names = { tesseract_collision_bullet::BulletCastSimpleManager::name(),
+                                                        tesseract_collision_bullet::BulletCastBVHManager::name(),
+                                                        tesseract_collision_fcl::FCLCastBVHManager::name() };
+
+  const std::vector<ScalingShapeType> shape_types = { ScalingShapeType::PRIMITIVE,
+                                                      ScalingShapeType::CONVEX_MESH,
+                                                      ScalingShapeType::MESH,
+                                                      ScalingShapeType::OCTREE,
+                                                      ScalingShapeType::COMPOUND };
+
+  const std::vector<ContactTestType> test_types = {
+    ContactTestType::FIRST, ContactTestType::CLOSEST, ContactTestType::ALL, ContactTestType::LIMITED
+  };
+
+  // The full sweeps take a long time so only a subset is run on CI
+  const bool ci_only = (std::string(BENCHMARK_ARGS).compare("CI_ONLY") == 0);
+  const std::vector<int> num_objects_sweep = (ci_only) ? std::vector<int>{ 1, 8, 64 } :
+                                                         std::vector<int>{ 1, 8, 64, 216, 512, 1000 };
+  const std::vector<double> margin_sweep = (ci_only) ? std::vector<double>{ 0.0, 0.1 } :
+                                                       std::vector<double>{ 0.0, 0.025, 0.05, 0.1, 0.25, 0.5 };
+  const int default_num_objects = 64;
+  const double default_margin = 0.05;
+
+  std::function<void(
+      benchmark::State&, DiscreteContactManager::Ptr, ScalingShapeType, int, double, ContactTestType)>
+      BM_SCALING_CONTACT_TEST_FUNC = BM_SCALING_CONTACT_TEST;
+  std::function<void(
+      benchmark::State&, ContinuousContactManager::Ptr, ScalingShapeType, int, double, ContactTestType)>
+      BM_SCALING_CAST_CONTACT_TEST_FUNC = BM_SCALING_CAST_CONTACT_TEST;
+
+  //////////////////////////////////////
+  // Contact test types
+  //////////////////////////////////////
+  for (const auto& shape_type : shape_types)
+  {
+    for (const auto& test_type : test_types)
+    {
+      for (std::size_t i = 0; i < discrete_checkers.size(); ++i)
+      {
+        std::string name = createName("BM_SCALING_CONTACT_TEST",
+                                      discrete_checker_names[i],
+                                      shape_type,
+                                      default_num_objects,
+                                      default_margin,
+                                      test_type);
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_SCALING_CONTACT_TEST_FUNC,
+                                     discrete_checkers[i]->clone(),
+                                     shape_type,
+                                     default_num_objects,
+                                     default_margin,
+                                     test_type)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+
+      for (std::size_t i = 0; i < cast_checkers.size(); ++i)
+      {
+        std::string name = createName("BM_SCALING_CAST_CONTACT_TEST",
+                                      cast_checker_names[i],
+                                      shape_type,
+                                      default_num_objects,
+                                      default_margin,
+                                      test_type);
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_SCALING_CAST_CONTACT_TEST_FUNC,
+                                     cast_checkers[i]->clone(),
+                                     shape_type,
+                                     default_num_objects,
+                                     default_margin,
+                                     test_type)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // Number of objects
+  //////////////////////////////////////
+  for (const auto& shape_type : shape_types)
+  {
+    for (const auto& num_objects : num_objects_sweep)
+    {
+      for (std::size_t i = 0; i < discrete_checkers.size(); ++i)
+      {
+        std::string name = createName("BM_SCALING_CONTACT_TEST",
+                                      discrete_checker_names[i],
+                                      shape_type,
+                                      num_objects,
+                                      default_margin,
+                                      ContactTestType::CLOSEST);
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_SCALING_CONTACT_TEST_FUNC,
+                                     discrete_checkers[i]->clone(),
+                                     shape_type,
+                                     num_objects,
+                                     default_margin,
+                                     ContactTestType::CLOSEST)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+
+      for (std::size_t i = 0; i < cast_checkers.size(); ++i)
+      {
+        std::string name = createName("BM_SCALING_CAST_CONTACT_TEST",
+                                      cast_checker_names[i],
+                                      shape_type,
+                                      num_objects,
+                                      default_margin,
+                                      ContactTestType::CLOSEST);
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_SCALING_CAST_CONTACT_TEST_FUNC,
+                                     cast_checkers[i]->clone(),
+                                     shape_type,
+                                     num_objects,
+                                     default_margin,
+                                     ContactTestType::CLOSEST)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // Collision margin
+  //////////////////////////////////////
+  for (const auto& shape_type : shape_types)
+  {
+    for (const auto& margin : margin_sweep)
+    {
+      for (std::size_t i = 0; i < discrete_checkers.size(); ++i)
+      {
+        std::string name = createName("BM_SCALING_CONTACT_TEST",
+                                      discrete_checker_names[i],
+                                      shape_type,
+                                      default_num_objects,
+                                      margin,
+                                      ContactTestType::ALL);
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_SCALING_CONTACT_TEST_FUNC,
+                                     discrete_checkers[i]->clone(),
+                                     shape_type,
+                                     default_num_objects,
+                                     margin,
+                                     ContactTestType::ALL)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+
+      for (std::size_t i = 0; i < cast_checkers.size(); ++i)
+      {
+        std::string name = createName("BM_SCALING_CAST_CONTACT_TEST",
+                                      cast_checker_names[i],
+                                      shape_type,
+                                      default_num_objects,
+                                      margin,
+                                      ContactTestType::ALL);
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     BM_SCALING_CAST_CONTACT_TEST_FUNC,
+                                     cast_checkers[i]->clone(),
+                                     shape_type,
+                                     default_num_objects,
+                                     margin,
+                                     ContactTestType::ALL)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
+  //////////////////////////////////////
+  // Clone
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, ScalingShapeType, int)> BM_SCALING_CLONE_FUNC =
+        BM_SCALING_CLONE<DiscreteContactManager>;
+    std::function<void(benchmark::State&, ContinuousContactManager::Ptr, ScalingShapeType, int)>
+        BM_SCALING_CAST_CLONE_FUNC = BM_SCALING_CLONE<ContinuousContactManager>;
+    for (const auto& shape_type : shape_types)
+    {
+      for (const auto& num_objects : num_objects_sweep)
+      {
+        const std::string suffix = "_" + ScalingShapeTypeStrings[static_cast<std::size_t>(shape_type)] +
+                                   "_OBJECTS_" + std::to_string(num_objects);
+        for (std::size_t i = 0; i < discrete_checkers.size(); ++i)
+        {
+          std::string name = "BM_SCALING_CLONE_" + discrete_checker_names[i] + suffix;
+          benchmark::RegisterBenchmark(
+              name.c_str(), BM_SCALING_CLONE_FUNC, discrete_checkers[i]->clone(), shape_type, num_objects)
+              ->UseRealTime()
+              ->Unit(benchmark::TimeUnit::kMicrosecond);
+        }
+
+        for (std::size_t i = 0; i < cast_checkers.size(); ++i)
+        {
+          std::string name = "BM_SCALING_CLONE_" + cast_checker_names[i] + suffix;
+          benchmark::RegisterBenchmark(
+              name.c_str(), BM_SCALING_CAST_CLONE_FUNC, cast_checkers[i]->clone(), shape_type, num_objects)
+              ->UseRealTime()
+              ->Unit(benchmark::TimeUnit::kMicrosecond);
+        }
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
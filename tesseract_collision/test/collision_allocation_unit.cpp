@@ -0,0 +1,149 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+
+using namespace tesseract_collision;
+
+namespace
+{
+std::atomic<long> allocation_count{ 0 };
+std::atomic<bool> count_allocations{ false };
+}  // namespace
+
+#ifdef __GLIBC__
+// Interpose the C allocation functions so the allocations of operator new, the Eigen aligned allocator and the Bullet
+// aligned allocator are all counted
+extern "C" {
+void* __libc_malloc(std::size_t size);                 // NOLINT
+void* __libc_calloc(std::size_t n, std::size_t size);  // NOLINT
+void* __libc_realloc(void* ptr, std::size_t size);     // NOLINT
+
+void* malloc(std::size_t size)  // NOLINT
+{
+  if (count_allocations.load(std::memory_order_relaxed))
+    ++allocation_count;
+
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t n, std::size_t size)  // NOLINT
+{
+  if (count_allocations.load(std::memory_order_relaxed))
+    ++allocation_count;
+
+  return __libc_calloc(n, size);
+}
+
+void* realloc(void* ptr, std::size_t size)  // NOLINT
+{
+  if (count_allocations.load(std::memory_order_relaxed))
+    ++allocation_count;
+
+  return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+/** @brief Count the number of heap allocations made while running the function */
+template <typename Fn>
+long countAllocations(Fn fn)
+{
+  allocation_count = 0;
+  count_allocations = true;
+  fn();
+  count_allocations = false;
+  return allocation_count.load();
+}
+
+/** @brief Add a grid of overlapping spheres and return two sets of poses where the same spheres overlap */
+void addCollisionObjects(DiscreteContactManager& checker,
+                         std::vector<std::string>& link_names,
+                         std::array<tesseract_common::VectorIsometry3d, 2>& poses)
+{
+  for (int x = 0; x < 3; ++x)
+  {
+    for (int y = 0; y < 3; ++y)
+    {
+      CollisionShapesConst obj_shapes;
+      tesseract_common::VectorIsometry3d obj_poses;
+      obj_shapes.push_back(std::make_shared<tesseract_geometry::Sphere>(0.25));
+      obj_poses.push_back(Eigen::Isometry3d::Identity());
+
+      link_names.push_back("sphere_link_" + std::to_string(x) + std::to_string(y));
+      checker.addCollisionObject(link_names.back(), 0, obj_shapes, obj_poses);
+
+      Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+      pose.translation() = Eigen::Vector3d(0.4 * static_cast<double>(x), 0.4 * static_cast<double>(y), 0);
+      poses[0].push_back(pose);
+      pose.translation().z() = 0.01 * static_cast<double>(x + y);
+      poses[1].push_back(pose);
+    }
+  }
+
+  checker.setActiveCollisionObjects(link_names);
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+}
+
+/** @brief Check repeated contact tests reusing the results containers do not allocate once warmed up */
+void runTest(DiscreteContactManager& checker)
+{
+#ifndef __GLIBC__
+  GTEST_SKIP() << "Counting allocations requires glibc";
+#endif
+
+  std::vector<std::string> link_names;
+  std::array<tesseract_common::VectorIsometry3d, 2> poses;
+  addCollisionObjects(checker, link_names, poses);
+
+  std::vector<ContactTestType> test_types = { ContactTestType::ALL, ContactTestType::CLOSEST, ContactTestType::FIRST };
+  for (const auto& test_type : test_types)
+  {
+    ContactRequest request(test_type);
+    ContactResultIdMap results;
+    ContactDistanceResultMap distance_results;
+    auto run = [&]() {
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+        checker.setCollisionObjectsTransform(link_names, poses[i % 2]);
+
+        results.clear();
+        checker.contactTest(results, request);
+
+        distance_results.clear();
+        checker.contactTest(distance_results, request);
+      }
+    };
+
+    // Warm up so the results containers, the broadphase and the collision algorithm pools reach their final size
+    run();
+    ASSERT_FALSE(results.empty());
+    ASSERT_FALSE(distance_results.empty());
+
+    EXPECT_EQ(countAllocations(run), 0) << "Contact test type " << static_cast<int>(test_type);
+  }
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionAllocationUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionAllocationUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  runTest(checker);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
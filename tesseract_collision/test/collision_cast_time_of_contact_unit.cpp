@@ -0,0 +1,46 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_cast_time_of_contact_unit.hpp>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, FCLContinuousBVHCollisionLinearTimeOfContactUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLCastBVHManager checker;
+  test_suite::runLinearTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLContinuousBVHCollisionMeshTimeOfContactUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLCastBVHManager checker;
+  test_suite::runMeshTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLContinuousBVHCollisionGrazeTimeOfContactUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLCastBVHManager checker;
+  test_suite::runGrazeTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLContinuousBVHCollisionThinObstacleTimeOfContactUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLCastBVHManager checker;
+  test_suite::runThinObstacleTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLContinuousBVHCollisionRotationTimeOfContactUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLCastBVHManager checker;
+  test_suite::runRotationTest(checker);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_contact_result_id_map_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, ObjectIdRegistryUnit)  // NOLINT
+{
+  ObjectIdRegistry registry;
+  EXPECT_EQ(registry.intern("link_1"), 0);
+  EXPECT_EQ(registry.intern("link_2"), 1);
+  EXPECT_EQ(registry.intern("link_1"), 0);
+  EXPECT_EQ(registry.getId("link_2"), 1);
+  EXPECT_EQ(registry.getId("link_3"), -1);
+  EXPECT_EQ(registry.getName(1), "link_2");
+  EXPECT_EQ(registry.size(), 2u);
+
+  EXPECT_EQ(getObjectPairId(3, 7), getObjectPairId(7, 3));
+  EXPECT_NE(getObjectPairId(3, 7), getObjectPairId(3, 8));
+}
+
+TEST(TesseractCollisionUnit, ContactResultIdMapUnit)  // NOLINT
+{
+  auto registry = std::make_shared<ObjectIdRegistry>();
+  for (int i = 0; i < 100; ++i)
+    registry->intern("link_" + std::to_string(i));
+
+  ContactResultIdMap results(registry);
+  EXPECT_TRUE(results.empty());
+  EXPECT_TRUE(results.find(getObjectPairId(0, 1)) == results.end());
+
+  // Insert enough entries to force the table to grow
+  for (int i = 0; i < 99; ++i)
+  {
+    ContactResult cr;
+    cr.distance = static_cast<double>(i);
+    cr.link_ids[0] = i;
+    cr.link_ids[1] = i + 1;
+    auto it = results.insert(std::make_pair(getObjectPairId(i, i + 1), ContactResultVector{ cr }));
+    EXPECT_TRUE(it.second);
+  }
+  EXPECT_EQ(results.size(), 99u);
+
+  // Inserting an existing key does not replace it
+  auto it = results.insert(std::make_pair(getObjectPairId(1, 0), ContactResultVector()));
+  EXPECT_FALSE(it.second);
+  EXPECT_EQ(it.first->second.size(), 1u);
+
+  for (int i = 0; i < 99; ++i)
+  {
+    auto found = results.find(getObjectPairId(i + 1, i));
+    ASSERT_TRUE(found != results.end());
+    EXPECT_NEAR(found->second[0].distance, static_cast<double>(i), 1e-8);
+  }
+
+  results[getObjectPairId(0, 1)].emplace_back();
+  EXPECT_EQ(results[getObjectPairId(0, 1)].size(), 2u);
+  EXPECT_EQ(results.size(), 99u);
+
+  auto names = results.getObjectNames(getObjectPairId(10, 9));
+  EXPECT_EQ(names.first, "link_10");
+  EXPECT_EQ(names.second, "link_9");
+
+  ContactResultMap converted;
+  results.toContactResultMap(converted);
+  EXPECT_EQ(converted.size(), 99u);
+  const auto& cr = converted.at(std::make_pair(std::string("link_10"), std::string("link_9")));
+  EXPECT_EQ(cr[0].link_names[0], "link_9");
+  EXPECT_EQ(cr[0].link_names[1], "link_10");
+
+  results.clear();
+  EXPECT_TRUE(results.empty());
+  EXPECT_TRUE(results.find(getObjectPairId(0, 1)) == results.end());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionContactResultIdMapUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionContactResultIdMapUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionContactResultIdMapUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
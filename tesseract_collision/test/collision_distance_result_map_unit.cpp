@@ -0,0 +1,89 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_distance_result_map_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, ContactDistanceResultMapUnit)  // NOLINT
+{
+  auto registry = std::make_shared<ObjectIdRegistry>();
+  for (int i = 0; i < 100; ++i)
+    registry->intern("link_" + std::to_string(i));
+
+  ContactDistanceResultMap results(registry);
+  EXPECT_TRUE(results.empty());
+  EXPECT_TRUE(results.find(getObjectPairId(0, 1)) == results.end());
+
+  // Insert enough entries to force the table to grow
+  for (int i = 0; i < 99; ++i)
+  {
+    ContactDistanceResult dr{};
+    dr.distance = static_cast<double>(i);
+    dr.link_ids = { i + 1, i };
+    auto it = results.insert(dr);
+    EXPECT_TRUE(it.second);
+  }
+  EXPECT_EQ(results.size(), 99u);
+  EXPECT_EQ(results.getResults().size(), 99u);
+
+  // Inserting an existing pair does not replace it
+  ContactDistanceResult dr{};
+  dr.distance = -1;
+  dr.link_ids = { 0, 1 };
+  auto it = results.insert(dr);
+  EXPECT_FALSE(it.second);
+  EXPECT_NEAR(it.first->distance, 0, 1e-8);
+
+  for (int i = 0; i < 99; ++i)
+  {
+    auto found = results.find(getObjectPairId(i, i + 1));
+    ASSERT_TRUE(found != results.end());
+    EXPECT_NEAR(found->distance, static_cast<double>(i), 1e-8);
+  }
+
+  auto names = results.getObjectNames(*results.find(getObjectPairId(9, 10)));
+  EXPECT_EQ(names.first, "link_10");
+  EXPECT_EQ(names.second, "link_9");
+
+  results.clear();
+  EXPECT_TRUE(results.empty());
+  EXPECT_TRUE(results.find(getObjectPairId(0, 1)) == results.end());
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionDistanceResultMapUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionDistanceResultMapUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHParallelCollisionDistanceResultMapUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  checker.setNarrowphaseThreads(2);
+  test_suite::runTest(checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionDistanceResultMapUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  test_suite::runTest(checker);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
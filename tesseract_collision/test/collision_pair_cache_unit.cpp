@@ -0,0 +1,68 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_pair_cache_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionPairCacheUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  tesseract_collision_bullet::BulletDiscreteSimpleManager uncached_checker;
+  test_suite::runTest(checker, uncached_checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionPairCacheUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  tesseract_collision_bullet::BulletDiscreteBVHManager uncached_checker;
+  test_suite::runTest(checker, uncached_checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHParallelCollisionPairCacheUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  checker.setNarrowphaseThreads(2);
+  tesseract_collision_bullet::BulletDiscreteBVHManager uncached_checker;
+  test_suite::runTest(checker, uncached_checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionPairCacheUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  tesseract_collision_fcl::FCLDiscreteBVHManager uncached_checker;
+  test_suite::runTest(checker, uncached_checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionDistanceBoundUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  tesseract_collision_bullet::BulletDiscreteSimpleManager uncached_checker;
+  test_suite::runDistanceBoundTest(checker, uncached_checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionDistanceBoundUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  tesseract_collision_bullet::BulletDiscreteBVHManager uncached_checker;
+  test_suite::runDistanceBoundTest(checker, uncached_checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionDistanceBoundUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  tesseract_collision_fcl::FCLDiscreteBVHManager uncached_checker;
+  test_suite::runDistanceBoundTest(checker, uncached_checker);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,231 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/core/shape_cache.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/bullet/bullet_utils.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/fcl/fcl_utils.h>
+
+using namespace tesseract_collision;
+
+/**
+ * @brief Create a box mesh with a side length of one which is scaled by the provided scale
+ * @param scale The scale applied to the vertices
+ * @param resource The resource the mesh was loaded from
+ */
+tesseract_geometry::Mesh::Ptr createBoxMesh(const Eigen::Vector3d& scale,
+                                           const tesseract_common::Resource::Ptr& resource)
+{
+  auto vertices = std::make_shared<tesseract_common::VectorVector3d>();
+  for (int i = 0; i < 8; ++i)
+  {
+    Eigen::Vector3d v((i & 1) ? 0.5 : -0.5, (i & 2) ? 0.5 : -0.5, (i & 4) ? 0.5 : -0.5);
+    vertices->push_back(v.cwiseProduct(scale));
+  }
+
+  std::vector<std::array<int, 3>> faces = { { 0, 2, 1 }, { 1, 2, 3 }, { 4, 5, 6 }, { 5, 7, 6 },
+                                            { 0, 1, 4 }, { 1, 5, 4 }, { 2, 6, 3 }, { 3, 6, 7 },
+                                            { 0, 4, 2 }, { 2, 4, 6 }, { 1, 3, 5 }, { 3, 7, 5 } };
+  auto triangles = std::make_shared<Eigen::VectorXi>(4 * faces.size());
+  for (std::size_t i = 0; i < faces.size(); ++i)
+  {
+    auto idx = static_cast<Eigen::Index>(4 * i);
+    (*triangles)[idx] = 3;
+    (*triangles)[idx + 1] = faces[i][0];
+    (*triangles)[idx + 2] = faces[i][1];
+    (*triangles)[idx + 3] = faces[i][2];
+  }
+
+  return std::make_shared<tesseract_geometry::Mesh>(vertices, triangles, resource, scale);
+}
+
+/** @brief Add the mesh and a sphere to the checker and return the contacts for the sphere at the provided location */
+ContactResultMap runContactTest(DiscreteContactManager& checker,
+                                const tesseract_geometry::Mesh::ConstPtr& mesh,
+                                const Eigen::Vector3d& sphere_location)
+{
+  CollisionShapesConst mesh_shapes = { mesh };
+  tesseract_common::VectorIsometry3d mesh_poses = { Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("mesh_link", 0, mesh_shapes, mesh_poses);
+
+  CollisionShapesConst sphere_shapes = { std::make_shared<tesseract_geometry::Sphere>(0.25) };
+  tesseract_common::VectorIsometry3d sphere_poses = { Eigen::Isometry3d::Identity() };
+  checker.addCollisionObject("sphere_link", 0, sphere_shapes, sphere_poses);
+
+  checker.setActiveCollisionObjects({ "mesh_link", "sphere_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  tesseract_common::TransformMap location;
+  location["mesh_link"] = Eigen::Isometry3d::Identity();
+  location["sphere_link"] = Eigen::Isometry3d::Identity();
+  location["sphere_link"].translation() = sphere_location;
+  checker.setCollisionObjectsTransform(location);
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  return result;
+}
+
+TEST(TesseractCollisionUnit, ShapeCacheUnit)  // NOLINT
+{
+  ShapeCache<int> cache;
+  auto data0 = std::make_shared<int>(0);
+  auto data1 = std::make_shared<int>(1);
+  ShapeCacheKey key(data0, data1);
+  ShapeCacheKey name_key("package://test/mesh.stl");
+
+  EXPECT_TRUE(cache.get(key) == nullptr);
+
+  auto shape = std::make_shared<int>(5);
+  std::weak_ptr<int> weak_shape = shape;
+  shape = cache.insert(key, shape);
+  EXPECT_EQ(*shape, 5);
+  EXPECT_EQ(cache.get(key), shape);
+  EXPECT_TRUE(cache.get(name_key) == nullptr);
+  EXPECT_TRUE(cache.get(ShapeCacheKey(data1, data0)) == nullptr);
+
+  // A second insert returns the shape which is already in use, a cached shape can be added with another key
+  auto other_shape = std::make_shared<int>(6);
+  EXPECT_EQ(cache.insert(key, other_shape), shape);
+  EXPECT_EQ(cache.insert(name_key, shape), shape);
+  EXPECT_EQ(cache.get(name_key), shape);
+  EXPECT_EQ(cache.size(), 2u);
+
+  // The cache does not keep released shapes alive and removes their entries
+  shape.reset();
+  EXPECT_TRUE(weak_shape.expired());
+  EXPECT_TRUE(cache.get(key) == nullptr);
+  EXPECT_TRUE(cache.get(name_key) == nullptr);
+  EXPECT_EQ(cache.size(), 0u);
+
+  // The cache does not keep the data buffers alive, and a key of released buffers does not match new buffers
+  other_shape = cache.insert(key, other_shape);
+  std::weak_ptr<int> weak_data0 = data0;
+  data0.reset();
+  EXPECT_TRUE(weak_data0.expired());
+  auto new_data0 = std::make_shared<int>(0);
+  EXPECT_TRUE(cache.get(ShapeCacheKey(new_data0, data1)) == nullptr);
+  EXPECT_EQ(cache.size(), 1u);
+  other_shape.reset();
+  EXPECT_EQ(cache.size(), 0u);
+
+  // Shapes in use are not affected by clearing the cache
+  auto new_shape = cache.insert(name_key, std::make_shared<int>(7));
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(*new_shape, 7);
+  new_shape.reset();
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(TesseractCollisionUnit, BulletShapeCacheUnit)  // NOLINT
+{
+  using namespace tesseract_collision_bullet;
+
+  auto resource = std::make_shared<tesseract_common::BytesResource>("package://test/bullet_box.stl",
+                                                                    std::vector<uint8_t>());
+  tesseract_geometry::Mesh::Ptr mesh = createBoxMesh(Eigen::Vector3d(1, 1, 1), resource);
+  ShapeCacheKey key(mesh->getVertices(), mesh->getTriangles());
+
+  {
+    std::shared_ptr<btCollisionShape> shape0 = createShapePrimitive(mesh, nullptr, 0);
+    std::shared_ptr<btCollisionShape> shape1 = createShapePrimitive(mesh->clone(), nullptr, 1);
+    ASSERT_TRUE(shape0 != nullptr);
+    ASSERT_TRUE(shape1 != nullptr);
+    ASSERT_EQ(shape0->getShapeType(), SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE);
+    ASSERT_EQ(shape1->getShapeType(), SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE);
+
+    // Both share the triangle mesh shape but the user index is stored per instance
+    auto* scaled0 = static_cast<TesseractScaledBvhTriangleMeshShape*>(shape0.get());
+    auto* scaled1 = static_cast<TesseractScaledBvhTriangleMeshShape*>(shape1.get());
+    EXPECT_EQ(scaled0->getMeshShape(), scaled1->getMeshShape());
+    EXPECT_EQ(getMeshShapeCache().get(key), scaled0->getMeshShape());
+    EXPECT_EQ(shape0->getUserIndex(), 0);
+    EXPECT_EQ(shape1->getUserIndex(), 1);
+
+    // A scaled mesh loaded from the same resource shares the shape through the scaling
+    tesseract_geometry::Mesh::Ptr scaled_mesh = createBoxMesh(Eigen::Vector3d(2, 1, 3), resource);
+    std::shared_ptr<btCollisionShape> shape2 = createShapePrimitive(scaled_mesh, nullptr, 0);
+    auto* scaled2 = static_cast<TesseractScaledBvhTriangleMeshShape*>(shape2.get());
+    EXPECT_EQ(scaled2->getMeshShape(), scaled0->getMeshShape());
+    EXPECT_NEAR(scaled2->getLocalScaling().x(), 2, 1e-6);
+    EXPECT_NEAR(scaled2->getLocalScaling().y(), 1, 1e-6);
+    EXPECT_NEAR(scaled2->getLocalScaling().z(), 3, 1e-6);
+
+    // A mesh with different vertices from the same resource does not share the shape
+    tesseract_geometry::Mesh::Ptr other_mesh = createBoxMesh(Eigen::Vector3d(1, 1, 1), resource);
+    auto other_vertices = std::make_shared<tesseract_common::VectorVector3d>(*other_mesh->getVertices());
+    other_vertices->front() *= 2;
+    other_mesh = std::make_shared<tesseract_geometry::Mesh>(other_vertices, other_mesh->getTriangles(), resource);
+    std::shared_ptr<btCollisionShape> shape3 = createShapePrimitive(other_mesh, nullptr, 0);
+    EXPECT_NE(static_cast<TesseractScaledBvhTriangleMeshShape*>(shape3.get())->getMeshShape(),
+              scaled0->getMeshShape());
+  }
+
+  // The shape is released once it is no longer used
+  EXPECT_TRUE(getMeshShapeCache().get(key) == nullptr);
+
+  // Contact managers share the shape and the scaling is applied in the contact test
+  {
+    BulletDiscreteBVHManager checker;
+    ContactResultMap result = runContactTest(checker, mesh, Eigen::Vector3d(1.1, 0, 0));
+    EXPECT_TRUE(result.empty());
+    TesseractBvhTriangleMeshShape::Ptr shape = getMeshShapeCache().get(key);
+    EXPECT_TRUE(shape != nullptr);
+
+    BulletDiscreteBVHManager scaled_checker;
+    tesseract_geometry::Mesh::Ptr scaled_mesh = createBoxMesh(Eigen::Vector3d(2, 2, 2), resource);
+    result = runContactTest(scaled_checker, scaled_mesh, Eigen::Vector3d(1.1, 0, 0));
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_NEAR(result.begin()->second[0].distance, -0.15, 1e-4);
+    EXPECT_EQ(getMeshShapeCache().get(key), shape);
+
+    DiscreteContactManager::Ptr cloned_checker = checker.clone();
+    EXPECT_EQ(getMeshShapeCache().get(key), shape);
+  }
+  EXPECT_TRUE(getMeshShapeCache().get(key) == nullptr);
+}
+
+TEST(TesseractCollisionUnit, FCLShapeCacheUnit)  // NOLINT
+{
+  using namespace tesseract_collision_fcl;
+
+  tesseract_geometry::Mesh::Ptr mesh = createBoxMesh(Eigen::Vector3d(1, 1, 1), nullptr);
+  ShapeCacheKey key(mesh->getVertices(), mesh->getTriangles());
+
+  {
+    CollisionGeometryPtr shape0 = createShapePrimitive(mesh);
+    CollisionGeometryPtr shape1 = createShapePrimitive(mesh->clone());
+    ASSERT_TRUE(shape0 != nullptr);
+    EXPECT_EQ(shape0, shape1);
+    EXPECT_EQ(getShapeCache().get(key), shape0);
+
+    // FCL can not scale a geometry so a scaled mesh creates a new geometry
+    CollisionGeometryPtr shape2 = createShapePrimitive(createBoxMesh(Eigen::Vector3d(2, 2, 2), nullptr));
+    EXPECT_NE(shape2, shape0);
+  }
+  EXPECT_TRUE(getShapeCache().get(key) == nullptr);
+
+  {
+    FCLDiscreteBVHManager checker;
+    ContactResultMap result = runContactTest(checker, mesh, Eigen::Vector3d(0.6, 0, 0));
+    EXPECT_FALSE(result.empty());
+    CollisionGeometryPtr shape = getShapeCache().get(key);
+    EXPECT_TRUE(shape != nullptr);
+
+    FCLDiscreteBVHManager other_checker;
+    runContactTest(other_checker, mesh, Eigen::Vector3d(0.6, 0, 0));
+    EXPECT_EQ(getShapeCache().get(key), shape);
+  }
+  EXPECT_TRUE(getShapeCache().get(key) == nullptr);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
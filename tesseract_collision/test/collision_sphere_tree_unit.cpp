@@ -0,0 +1,65 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_collision/test_suite/collision_sphere_tree_unit.hpp>
+#include <tesseract_collision/bullet/bullet_discrete_simple_manager.h>
+#include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract_collision/fcl/fcl_discrete_managers.h>
+
+using namespace tesseract_collision;
+
+TEST(TesseractCollisionUnit, SphereTreeUnit)  // NOLINT
+{
+  test_suite::runSphereTreeTest();
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionSphereTreeUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  tesseract_collision_bullet::BulletDiscreteSimpleManager exact_checker;
+  test_suite::runTest(checker, exact_checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionSphereTreeUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  tesseract_collision_bullet::BulletDiscreteBVHManager exact_checker;
+  test_suite::runTest(checker, exact_checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionSphereTreeUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  tesseract_collision_fcl::FCLDiscreteBVHManager exact_checker;
+  test_suite::runTest(checker, exact_checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteSimpleCollisionSphereTreeContainedUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteSimpleManager checker;
+  tesseract_collision_bullet::BulletDiscreteSimpleManager exact_checker;
+  test_suite::runContainedTest(checker, exact_checker);
+}
+
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionSphereTreeContainedUnit)  // NOLINT
+{
+  tesseract_collision_bullet::BulletDiscreteBVHManager checker;
+  tesseract_collision_bullet::BulletDiscreteBVHManager exact_checker;
+  test_suite::runContainedTest(checker, exact_checker);
+}
+
+TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionSphereTreeContainedUnit)  // NOLINT
+{
+  tesseract_collision_fcl::FCLDiscreteBVHManager checker;
+  tesseract_collision_fcl::FCLDiscreteBVHManager exact_checker;
+  test_suite::runContainedTest(checker, exact_checker);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
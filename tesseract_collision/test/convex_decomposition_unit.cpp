@@ -0,0 +1,234 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_collision/convex_decomposition/convex_decomposition_cache.h>
+
+using namespace tesseract_collision;
+
+/** @brief A convex decomposition which returns the bounding box of each mesh and counts the number of calls */
+class BoxDecomposition : public ConvexDecomposition
+{
+public:
+  BoxDecomposition(std::string cache_key) : cache_key_(std::move(cache_key)) {}
+
+  using ConvexDecomposition::compute;
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& vertices,
+                                                           const Eigen::VectorXi& /*faces*/) const override
+  {
+    ++num_calls;
+    Eigen::AlignedBox3d box;
+    for (const auto& v : vertices)
+      box.extend(v);
+
+    auto box_vertices = std::make_shared<tesseract_common::VectorVector3d>();
+    for (int i = 0; i < 8; ++i)
+      box_vertices->push_back(box.corner(static_cast<Eigen::AlignedBox3d::CornerType>(i)));
+
+    auto box_faces = std::make_shared<Eigen::VectorXi>(8);
+    *box_faces << 3, 0, 1, 2, 3, 1, 3, 2;
+    return { std::make_shared<tesseract_geometry::ConvexMesh>(box_vertices, box_faces, 2) };
+  }
+
+  std::string getCacheKey() const override { return cache_key_; }
+
+  mutable std::atomic<int> num_calls{ 0 };
+
+private:
+  std::string cache_key_;
+};
+
+/** @brief A convex decomposition which runs until it is cancelled */
+class BlockingDecomposition : public ConvexDecomposition
+{
+public:
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& /*vertices*/,
+                                                           const Eigen::VectorXi& /*faces*/) const override
+  {
+    return {};
+  }
+
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> compute(const tesseract_common::VectorVector3d& /*vertices*/,
+                                                           const Eigen::VectorXi& /*faces*/,
+                                                           ConvexDecompositionStatus& status) const override
+  {
+    status.setProgress(50, "Blocking");
+    while (!status.isCancelled())
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    return {};
+  }
+};
+
+TEST(TesseractConvexDecompositionUnit, ConvexDecompositionAsyncUnit)  // NOLINT
+{
+  tesseract_common::VectorVector3d vertices = { Eigen::Vector3d(0, 0, 0),
+                                                Eigen::Vector3d(1, 0, 0),
+                                                Eigen::Vector3d(0, 2, 0),
+                                                Eigen::Vector3d(0, 0, 3) };
+  Eigen::VectorXi faces(8);
+  faces << 3, 0, 1, 2, 3, 0, 1, 3;
+
+  // Several decompositions run concurrently
+  auto decomposition = std::make_shared<BoxDecomposition>("");
+  std::vector<ConvexDecompositionTask> tasks;
+  for (int i = 0; i < 4; ++i)
+    tasks.push_back(decomposition->computeAsync(vertices, faces));
+
+  for (const auto& task : tasks)
+  {
+    ASSERT_EQ(task.get().size(), 1u);
+    EXPECT_TRUE(task.isReady());
+    EXPECT_NEAR(task.getStatus().getProgress(), 100, 1e-8);
+    EXPECT_FALSE(task.getStatus().isCancelled());
+  }
+  EXPECT_EQ(decomposition->num_calls, 4);
+
+  // A running decomposition is cancelled, the task keeps the decomposition alive
+  auto blocking_decomposition = std::make_shared<BlockingDecomposition>();
+  ConvexDecompositionTask task = blocking_decomposition->computeAsync(vertices, faces);
+  blocking_decomposition.reset();
+  EXPECT_FALSE(task.isReady());
+  task.cancel();
+  EXPECT_TRUE(task.get().empty());
+  EXPECT_TRUE(task.getStatus().isCancelled());
+
+  // A cancelled status skips the decomposition
+  ConvexDecompositionStatus status;
+  status.cancel();
+  EXPECT_TRUE(decomposition->compute(vertices, faces, status).empty());
+  EXPECT_EQ(decomposition->num_calls, 4);
+}
+
+TEST(TesseractConvexDecompositionUnit, ConvexDecompositionCacheUnit)  // NOLINT
+{
+  const tesseract_common::fs::path cache_directory =
+      tesseract_common::fs::temp_directory_path() / tesseract_common::fs::unique_path();
+
+  tesseract_common::VectorVector3d vertices = { Eigen::Vector3d(0, 0, 0),
+                                                Eigen::Vector3d(1, 0, 0),
+                                                Eigen::Vector3d(0, 2, 0),
+                                                Eigen::Vector3d(0, 0, 3) };
+  Eigen::VectorXi faces(8);
+  faces << 3, 0, 1, 2, 3, 0, 1, 3;
+
+  auto decomposition = std::make_shared<BoxDecomposition>("box 1");
+  ConvexDecompositionCache cache(decomposition, cache_directory.string());
+  EXPECT_EQ(cache.getCacheKey(), "box 1");
+  EXPECT_EQ(cache.getCacheDirectory(), cache_directory.string());
+
+  // The first call computes the decomposition and creates the cache directory
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> result = cache.compute(vertices, faces);
+  EXPECT_EQ(decomposition->num_calls, 1);
+  ASSERT_EQ(result.size(), 1u);
+  EXPECT_TRUE(tesseract_common::fs::exists(cache.getCacheFilePath(vertices, faces)));
+
+  // A new cache using the same directory loads the results from the file
+  auto other_decomposition = std::make_shared<BoxDecomposition>("box 1");
+  ConvexDecompositionCache other_cache(other_decomposition, cache_directory.string());
+  std::vector<tesseract_geometry::ConvexMesh::Ptr> cached_result = other_cache.compute(vertices, faces);
+  EXPECT_EQ(other_decomposition->num_calls, 0);
+  ASSERT_EQ(cached_result.size(), 1u);
+  EXPECT_EQ(cached_result[0]->getFaceCount(), result[0]->getFaceCount());
+  EXPECT_EQ(*cached_result[0]->getFaces(), *result[0]->getFaces());
+  ASSERT_EQ(cached_result[0]->getVertices()->size(), 8u);
+  for (std::size_t i = 0; i < 8; ++i)
+    EXPECT_TRUE(cached_result[0]->getVertices()->at(i).isApprox(result[0]->getVertices()->at(i), 0));
+
+  // Changing the vertices, faces or cache key uses a different file
+  tesseract_common::VectorVector3d moved_vertices = vertices;
+  moved_vertices[3].z() = 4;
+  EXPECT_NE(cache.getCacheFilePath(moved_vertices, faces), cache.getCacheFilePath(vertices, faces));
+  cached_result = other_cache.compute(moved_vertices, faces);
+  EXPECT_EQ(other_decomposition->num_calls, 1);
+  ASSERT_EQ(cached_result.size(), 1u);
+  EXPECT_NEAR(cached_result[0]->getVertices()->at(7).z(), 4, 1e-12);
+
+  Eigen::VectorXi other_faces(4);
+  other_faces << 3, 0, 1, 2;
+  EXPECT_NE(cache.getCacheFilePath(vertices, other_faces), cache.getCacheFilePath(vertices, faces));
+
+  ConvexDecompositionCache changed_key_cache(std::make_shared<BoxDecomposition>("box 2"), cache_directory.string());
+  EXPECT_NE(changed_key_cache.getCacheFilePath(vertices, faces), cache.getCacheFilePath(vertices, faces));
+
+  // An invalid file is ignored and replaced
+  {
+    std::ofstream os(cache.getCacheFilePath(vertices, faces), std::ios::binary | std::ios::trunc);
+    os << "invalid";
+  }
+  result = cache.compute(vertices, faces);
+  EXPECT_EQ(decomposition->num_calls, 2);
+  ASSERT_EQ(result.size(), 1u);
+  result = cache.compute(vertices, faces);
+  EXPECT_EQ(decomposition->num_calls, 2);
+  ASSERT_EQ(result.size(), 1u);
+
+  // A truncated or corrupt body is ignored and replaced. The body of the box is the mesh count, the vertex count, 8
+  // vertices, the face count, the faces size and 8 face values.
+  const std::size_t body_size = 8 + 8 + 8 * 24 + 4 + 8 + 8 * 4;
+  auto corruptCacheFile = [&](const std::function<void(std::string&)>& corrupt) {
+    std::string data;
+    {
+      std::ifstream is(cache.getCacheFilePath(vertices, faces), std::ios::binary);
+      data.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+    ASSERT_GT(data.size(), body_size);
+    corrupt(data);
+    std::ofstream os(cache.getCacheFilePath(vertices, faces), std::ios::binary | std::ios::trunc);
+    os.write(data.data(), static_cast<std::streamsize>(data.size()));
+  };
+
+  auto setValue = [&](std::string& data, std::size_t body_offset, auto value) {
+    std::memcpy(&data[data.size() - body_size + body_offset], &value, sizeof(value));
+  };
+
+  std::vector<std::function<void(std::string&)>> corruptions = {
+    [&](std::string& data) { data.resize(data.size() - 10); },
+    [&](std::string& data) { setValue(data, 0, std::numeric_limits<uint64_t>::max()); },
+    [&](std::string& data) { setValue(data, 8, std::numeric_limits<uint64_t>::max() / 2); },
+    [&](std::string& data) { setValue(data, 8 + 8 + 8 * 24 + 4, std::numeric_limits<uint64_t>::max()); },
+    [&](std::string& data) { setValue(data, body_size - 4, int32_t(8)); },
+    [&](std::string& data) { setValue(data, body_size - 16, int32_t(-1)); },
+    [&](std::string& data) { setValue(data, body_size - 32, int32_t(2)); },
+  };
+
+  for (const auto& corruption : corruptions)
+  {
+    const int num_calls = decomposition->num_calls;
+    corruptCacheFile(corruption);
+    result = cache.compute(vertices, faces);
+    EXPECT_EQ(decomposition->num_calls, num_calls + 1);
+    ASSERT_EQ(result.size(), 1u);
+    result = cache.compute(vertices, faces);
+    EXPECT_EQ(decomposition->num_calls, num_calls + 1);
+    ASSERT_EQ(result.size(), 1u);
+  }
+
+  // A decomposition without a cache key is not cached
+  auto uncached_decomposition = std::make_shared<BoxDecomposition>("");
+  ConvexDecompositionCache uncached_cache(uncached_decomposition, cache_directory.string());
+  EXPECT_TRUE(uncached_cache.getCacheFilePath(vertices, faces).empty());
+  uncached_cache.compute(vertices, faces);
+  uncached_cache.compute(vertices, faces);
+  EXPECT_EQ(uncached_decomposition->num_calls, 2);
+
+  EXPECT_ANY_THROW(ConvexDecompositionCache(nullptr, cache_directory.string()));  // NOLINT
+
+  tesseract_common::fs::remove_all(cache_directory);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -30,7 +30,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <vector>
 #include <string>
 #include <shared_mutex>
+#include <atomic>
 #include <chrono>
+#include <memory>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -238,6 +240,10 @@ public:
 
   /**
    * @brief Clone the environment
+   *
+   * The scene graph and command history are shared with the clone until either environment is modified. The contact
+   * managers change with every state, so they are cloned, sharing only their collision geometry.
+   *
    * @return A clone of the environment
    */
   Environment::Ptr clone() const;
@@ -379,6 +385,21 @@ public:
   virtual EnvState::Ptr getState(const std::vector<std::string>& joint_names,
                                  const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
 
+  /**
+   * @brief Get the current snapshot of the environment
+   *
+   * This does not lock the environment, so it does not wait for threads updating the environment. The snapshot is
+   * immutable and a new one is published every time the current state changes. The getters of the current state are
+   * based on it.
+   *
+   * The snapshot pointer is read with std::atomic_load, which is not lock-free for shared pointers. The standard
+   * library guards the pointer copy with a mutex from a small global pool, so readers only contend with each other and
+   * the writer for the duration of the reference count update.
+   *
+   * @return The current snapshot, nullptr if the environment has not been initialized
+   */
+  EnvSnapshot::ConstPtr getSnapshot() const;
+
   /** @brief Get the current state of the environment */
   virtual EnvState::ConstPtr getCurrentState() const;
 
@@ -523,6 +544,18 @@ public:
   /** @brief Get a copy of the environments available continuous contact manager by name */
   virtual tesseract_collision::ContinuousContactManager::Ptr getContinuousContactManager(const std::string& name) const;
 
+  /**
+   * @brief Update the collision objects of a link after a new revision of its collision geometries was published
+   *
+   * Only octrees can be updated, see tesseract_geometry::Octree::update. This updates the active contact managers of
+   * the environment. The contact managers returned by the environment before must be updated separately, see
+   * tesseract_collision::DiscreteContactManager::updateCollisionObjectGeometries.
+   *
+   * @param link_name The name of the link
+   * @return False if the link does not exist
+   */
+  virtual bool updateCollisionObjectGeometries(const std::string& link_name);
+
   /** @brief Get the environment collision margin data */
   virtual tesseract_common::CollisionMarginData getCollisionMarginData() const;
 
@@ -741,11 +774,12 @@ protected:
   bool initialized_{ false }; /**< Identifies if the object has been initialized */
   int revision_{ 0 };         /**< This increments when the scene graph is modified */
   int init_revision_{ 0 };    /**< This is the revision number after initialization used when reset is called */
-  Commands commands_;         /**< The history of commands applied to the environment after intialization */
+  /** @brief The history of commands applied to the environment after intialization, shared with clones */
+  std::shared_ptr<Commands> commands_{ std::make_shared<Commands>() };
   tesseract_scene_graph::SceneGraph::Ptr scene_graph_;                   /**< Tesseract Scene Graph */
   tesseract_scene_graph::SceneGraph::ConstPtr scene_graph_const_;        /**< Tesseract Scene Graph Const */
   ManipulatorManager::Ptr manipulator_manager_;                          /**< Managers for the kinematics objects */
-  EnvState::Ptr current_state_;                                          /**< Current state of the environment */
+  DenseEnvState::ConstPtr current_state_;                                /**< Current state of the environment */
   std::chrono::high_resolution_clock::duration current_state_timestamp_; /**< Current state timestamp */
   StateSolver::Ptr state_solver_;                                        /**< Tesseract State Solver */
   std::vector<std::string> link_names_;                                  /**< A vector of link names */
@@ -774,13 +808,45 @@ protected:
   /** @brief The environment can be accessed from multiple threads, need use mutex throughout */
   mutable std::shared_mutex mutex_;
 
-  /** This will update the contact managers transforms */
+  /** This will update the contact managers transforms and publish a new snapshot */
   void currentStateChanged();
 
   /** This will notify the state solver that the environment has changed */
   void environmentChanged();
 
 private:
+  /**
+   * @brief The current snapshot, which must only be accessed using std::atomic_load and std::atomic_store
+   *
+   * These free functions are deprecated in C++20, where this should become a std::atomic<std::shared_ptr>.
+   */
+  EnvSnapshot::ConstPtr snapshot_;
+
+  /** @brief The link names shared by the snapshots, updated when the environment changes */
+  std::shared_ptr<const std::vector<std::string>> snapshot_link_names_{
+    std::make_shared<const std::vector<std::string>>()
+  };
+
+  /** @brief The active joint names shared by the snapshots, updated when the environment changes */
+  std::shared_ptr<const std::vector<std::string>> snapshot_active_joint_names_{
+    std::make_shared<const std::vector<std::string>>()
+  };
+
+  /**
+   * @brief Indicates the scene graph is shared with a clone
+   * @details The shared scene graph is never modified, so the first modification of either environment copies it
+   */
+  mutable std::atomic<bool> scene_graph_shared_{ false };
+
+  /** @brief Publish a snapshot of the current state, this must be called while holding the unique lock */
+  void publishSnapshot();
+
+  /**
+   * @brief Copy the scene graph and command history which are shared with a clone
+   * @details This must be called while holding the unique lock before any of them are modified
+   */
+  void copySharedDataHelper();
+
   bool removeLinkHelper(const std::string& name);
 
   void getCollisionObject(tesseract_collision::CollisionShapesConst& shapes,
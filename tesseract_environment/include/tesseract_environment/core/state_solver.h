@@ -88,12 +88,53 @@ public:
   virtual EnvState::Ptr getState(const std::vector<std::string>& joint_names,
                                  const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
 
+  /**
+   * @brief Get the state of the environment for a given set or subset of joint values, writing into a provided state
+   *
+   * The joints which are not provided keep the values of the provided state. Passing the previous result lets the
+   * solver compute only the transforms affected by the changed joint values, and no memory is allocated once the state
+   * was created with the current name to index table. The state is reset to the current state when it was created
+   * with a different table.
+   *
+   * @param state The state to update
+   * @param joint_names The joint names
+   * @param joint_values The joint values
+   */
+  virtual void getState(DenseEnvState& state,
+                        const std::vector<std::string>& joint_names,
+                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const = 0;
+
+  /**
+   * @brief Get the state of the environment for the values of all joints, writing into a provided state
+   * @param state The state to update
+   * @param joint_values The joint values in the order of getJointNames()
+   */
+  virtual void getState(DenseEnvState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+  {
+    getState(state, getJointNames(), joint_values);
+  }
+
   /**
    * @brief Get the current state of the environment
    * @return
    */
   virtual EnvState::ConstPtr getCurrentState() const = 0;
 
+  /**
+   * @brief Get the name to index table of the dense states
+   * @details A new table is created when the environment changes, until then the dense states share this one
+   * @return The name to index table
+   */
+  virtual EnvStateIndex::ConstPtr getStateIndex() const = 0;
+
+  /**
+   * @brief Get the current state of the environment in contiguous storage
+   * @details The solver publishes a new dense state when its current state changes and never modifies a returned one,
+   * so it can be shared without copying.
+   * @return The dense environment state
+   */
+  virtual DenseEnvState::ConstPtr getDenseCurrentState() const = 0;
+
   /**
    * @brief Get the random state of the environment
    * @return Environment state
@@ -126,6 +167,12 @@ protected:
    */
   virtual void onEnvironmentChanged(const Commands& commands) = 0;
 
+  /**
+   * @brief This is to only be used by the environment when it copies the scene graph it shared with a clone
+   * @param scene_graph The copy of the scene graph provided to init, which will be modified by the environment
+   */
+  virtual void onSceneGraphReplaced(tesseract_scene_graph::SceneGraph::ConstPtr /*scene_graph*/) {}
+
   friend class Environment;
 };
 }  // namespace tesseract_environment
@@ -31,11 +31,14 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 #include <Eigen/StdVector>
+#include <chrono>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include <memory>
 #include <functional>
 #include <map>
+#include <mutex>
 #include <tesseract_scene_graph/graph.h>
 #include <tesseract_common/types.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -43,6 +46,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #ifdef SWIG
 
 %shared_ptr(tesseract_environment::EnvState)
+%shared_ptr(tesseract_environment::EnvStateIndex)
+%shared_ptr(tesseract_environment::DenseEnvState)
 %shared_ptr(tesseract_environment::AdjacencyMapPair)
 %shared_ptr(tesseract_environment::AdjacencyMap)
 
@@ -86,6 +91,217 @@ struct EnvState
   }
 };
 
+/**
+ * @brief The name to index table of a dense environment state
+ *
+ * The state solver creates a new table when the environment changes and shares it with every dense state it creates,
+ * so a table must never be modified after it is created.
+ */
+struct EnvStateIndex
+{
+  using Ptr = std::shared_ptr<EnvStateIndex>;
+  using ConstPtr = std::shared_ptr<const EnvStateIndex>;
+
+  EnvStateIndex() = default;
+
+  /**
+   * @brief Create the table of a state
+   * @param joint_names The names of the joint values, in the order of the state solver joint names
+   * @param state The state providing the link and joint transform names
+   */
+  EnvStateIndex(std::vector<std::string> joint_names, const EnvState& state) : joint_names(std::move(joint_names))
+  {
+    link_names.reserve(state.link_transforms.size());
+    for (const auto& link : state.link_transforms)
+      link_names.push_back(link.first);
+
+    joint_transform_names.reserve(state.joint_transforms.size());
+    for (const auto& joint : state.joint_transforms)
+      joint_transform_names.push_back(joint.first);
+
+    createIndices(joint_indices, this->joint_names);
+    createIndices(link_indices, link_names);
+    createIndices(joint_transform_indices, joint_transform_names);
+  }
+
+  /** @brief The names of the joint values */
+  std::vector<std::string> joint_names;
+
+  /** @brief The names of the link transforms */
+  std::vector<std::string> link_names;
+
+  /** @brief The names of the joint transforms */
+  std::vector<std::string> joint_transform_names;
+
+  /** @brief The joint name to index in the joint values */
+  std::unordered_map<std::string, std::size_t> joint_indices;
+
+  /** @brief The link name to index in the link transforms */
+  std::unordered_map<std::string, std::size_t> link_indices;
+
+  /** @brief The joint name to index in the joint transforms */
+  std::unordered_map<std::string, std::size_t> joint_transform_indices;
+
+private:
+  static void createIndices(std::unordered_map<std::string, std::size_t>& indices,
+                            const std::vector<std::string>& names)
+  {
+    indices.reserve(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i)
+      indices[names[i]] = i;
+  }
+};
+
+/**
+ * @brief This holds a state of the environment in contiguous storage
+ *
+ * The joint values and transforms are stored in the order of a shared name to index table, so copying a dense state
+ * only copies the values. The name based accessors look up the index in the table.
+ */
+struct DenseEnvState
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  using Ptr = std::shared_ptr<DenseEnvState>;
+  using ConstPtr = std::shared_ptr<const DenseEnvState>;
+
+  DenseEnvState() = default;
+
+  /**
+   * @brief Create a state with zero joint values and identity transforms
+   * @param index The name to index table of the state
+   */
+  explicit DenseEnvState(EnvStateIndex::ConstPtr index) : index(std::move(index))
+  {
+    joints.setZero(static_cast<Eigen::Index>(this->index->joint_names.size()));
+    link_transforms.resize(this->index->link_names.size(), Eigen::Isometry3d::Identity());
+    joint_transforms.resize(this->index->joint_transform_names.size(), Eigen::Isometry3d::Identity());
+  }
+
+  /**
+   * @brief Create the dense version of a state
+   * @param index The name to index table of the state
+   * @param state The state, which must contain every name of the table
+   */
+  DenseEnvState(EnvStateIndex::ConstPtr index, const EnvState& state) : index(std::move(index))
+  {
+    const EnvStateIndex& idx = *this->index;
+    joints.resize(static_cast<Eigen::Index>(idx.joint_names.size()));
+    for (std::size_t i = 0; i < idx.joint_names.size(); ++i)
+      joints(static_cast<Eigen::Index>(i)) = state.joints.at(idx.joint_names[i]);
+
+    link_transforms.reserve(idx.link_names.size());
+    for (const auto& link_name : idx.link_names)
+      link_transforms.push_back(state.link_transforms.at(link_name));
+
+    joint_transforms.reserve(idx.joint_transform_names.size());
+    for (const auto& joint_name : idx.joint_transform_names)
+      joint_transforms.push_back(state.joint_transforms.at(joint_name));
+  }
+
+  /** @brief The name to index table of the state */
+  EnvStateIndex::ConstPtr index;
+
+  /** @brief The joint values used for calculating the joint and link transforms */
+  Eigen::VectorXd joints;
+
+  /** @brief The link transforms in world coordinate system */
+  tesseract_common::VectorIsometry3d link_transforms;
+
+  /** @brief The joint transforms in world coordinate system */
+  tesseract_common::VectorIsometry3d joint_transforms;
+
+  double getJointValue(const std::string& joint_name) const
+  {
+    return joints(static_cast<Eigen::Index>(index->joint_indices.at(joint_name)));
+  }
+
+  Eigen::VectorXd getJointValues(const std::vector<std::string>& joint_names) const
+  {
+    Eigen::VectorXd jv;
+    jv.resize(static_cast<long int>(joint_names.size()));
+    for (auto j = 0u; j < joint_names.size(); ++j)
+      jv(j) = getJointValue(joint_names[j]);
+
+    return jv;
+  }
+
+  const Eigen::Isometry3d& getLinkTransform(const std::string& link_name) const
+  {
+    return link_transforms[index->link_indices.at(link_name)];
+  }
+
+  const Eigen::Isometry3d& getJointTransform(const std::string& joint_name) const
+  {
+    return joint_transforms[index->joint_transform_indices.at(joint_name)];
+  }
+
+  /** @brief Convert to the name based state */
+  EnvState toEnvState() const
+  {
+    EnvState state;
+    const EnvStateIndex& idx = *index;
+    for (std::size_t i = 0; i < idx.joint_names.size(); ++i)
+      state.joints[idx.joint_names[i]] = joints(static_cast<Eigen::Index>(i));
+
+    for (std::size_t i = 0; i < idx.link_names.size(); ++i)
+      state.link_transforms[idx.link_names[i]] = link_transforms[i];
+
+    for (std::size_t i = 0; i < idx.joint_transform_names.size(); ++i)
+      state.joint_transforms[idx.joint_transform_names[i]] = joint_transforms[i];
+
+    return state;
+  }
+};
+
+/**
+ * @brief An immutable snapshot of the current state of the environment
+ *
+ * The environment publishes a new snapshot every time its current state changes and never modifies a published
+ * snapshot, so readers holding a snapshot see a consistent state without holding the environment lock.
+ */
+struct EnvSnapshot
+{
+  using Ptr = std::shared_ptr<EnvSnapshot>;
+  using ConstPtr = std::shared_ptr<const EnvSnapshot>;
+
+  /** @brief The current state of the environment in contiguous storage, shared with the state solver */
+  DenseEnvState::ConstPtr dense_state;
+
+  /** @brief The timestamp of the current state */
+  std::chrono::high_resolution_clock::duration timestamp{ 0 };
+
+  /** @brief The revision of the environment the state was computed for */
+  int revision{ 0 };
+
+  /** @brief This increments every time a snapshot is published */
+  unsigned long version{ 0 };
+
+  /** @brief The link names of the environment */
+  std::shared_ptr<const std::vector<std::string>> link_names;
+
+  /** @brief The active joint names of the environment */
+  std::shared_ptr<const std::vector<std::string>> active_joint_names;
+
+  /**
+   * @brief Get the current state of the environment keyed by name
+   * @details It is converted from the dense state on first access and kept with the snapshot, so states which are
+   * never read by name are never converted.
+   * @return The current state of the environment
+   */
+  EnvState::ConstPtr getState() const
+  {
+    std::call_once(state_flag_, [this]() { state_ = std::make_shared<const EnvState>(dense_state->toEnvState()); });
+    return state_;
+  }
+
+private:
+  mutable std::once_flag state_flag_;
+  mutable EnvState::ConstPtr state_;
+};
+
 /** @brief The AdjacencyMapPair struct */
 struct AdjacencyMapPair
 {
@@ -75,25 +75,13 @@ inline void getActiveLinkNamesRecursive(std::vector<std::string>& active_links,
   }
 }
 
-/**
- * @brief Should perform a continuous collision check between two states.
- * @param contacts A vector of vector of ContactMap where each indicie corrisponds to a timestep
- * @param manager A continuous contact manager
- * @param state0 First environment state
- * @param state1 Second environment state
- * @param config CollisionCheckConfig used to specify collision check settings
- * @return True if collision was found, otherwise false.
- */
-inline bool checkTrajectorySegment(std::vector<tesseract_collision::ContactResultMap>& contacts,
-                                   tesseract_collision::ContinuousContactManager& manager,
-                                   const tesseract_environment::EnvState::Ptr& state0,
-                                   const tesseract_environment::EnvState::Ptr& state1,
-                                   const tesseract_collision::CollisionCheckConfig& config)
+namespace detail
+{
+/** @brief Perform the continuous contact test once the transforms of the active links are set */
+inline bool checkTrajectorySegmentHelper(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                         tesseract_collision::ContinuousContactManager& manager,
+                                         const tesseract_collision::CollisionCheckConfig& config)
 {
-  for (const auto& link_name : manager.getActiveCollisionObjects())
-    manager.setCollisionObjectsTransform(
-        link_name, state0->link_transforms[link_name], state1->link_transforms[link_name]);
-
   tesseract_collision::ContactResultMap collisions;
   manager.contactTest(collisions, config.contact_request);
 
@@ -118,24 +106,12 @@ inline bool checkTrajectorySegment(std::vector<tesseract_collision::ContactResul
   return false;
 }
 
-/**
- * @brief Should perform a discrete collision check a state.
- * @param contacts A vector of vector of ContactMap where each indicie corrisponds to a timestep
- * @param manager A discrete contact manager
- * @param state First environment state
- * @param config CollisionCheckConfig used to specify collision check settings
- * @return True if collision was found, otherwise false.
- */
-inline bool checkTrajectoryState(std::vector<tesseract_collision::ContactResultMap>& contacts,
-                                 tesseract_collision::DiscreteContactManager& manager,
-                                 const tesseract_environment::EnvState::Ptr& state,
-                                 const tesseract_collision::CollisionCheckConfig& config)
+/** @brief Perform the discrete contact test once the transforms of the active links are set */
+inline bool checkTrajectoryStateHelper(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                       tesseract_collision::DiscreteContactManager& manager,
+                                       const tesseract_collision::CollisionCheckConfig& config)
 {
   tesseract_collision::ContactResultMap collisions;
-
-  for (const auto& link_name : manager.getActiveCollisionObjects())
-    manager.setCollisionObjectsTransform(link_name, state->link_transforms[link_name]);
-
   manager.contactTest(collisions, config.contact_request);
 
   if (!collisions.empty())
@@ -158,6 +134,89 @@ inline bool checkTrajectoryState(std::vector<tesseract_collision::ContactResultM
 
   return false;
 }
+}  // namespace detail
+
+/**
+ * @brief Should perform a continuous collision check between two states.
+ * @param contacts A vector of vector of ContactMap where each indicie corrisponds to a timestep
+ * @param manager A continuous contact manager
+ * @param state0 First environment state
+ * @param state1 Second environment state
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+inline bool checkTrajectorySegment(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                   tesseract_collision::ContinuousContactManager& manager,
+                                   const tesseract_environment::EnvState::Ptr& state0,
+                                   const tesseract_environment::EnvState::Ptr& state1,
+                                   const tesseract_collision::CollisionCheckConfig& config)
+{
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(
+        link_name, state0->link_transforms[link_name], state1->link_transforms[link_name]);
+
+  return detail::checkTrajectorySegmentHelper(contacts, manager, config);
+}
+
+/**
+ * @brief Should perform a continuous collision check between two dense states.
+ * @param contacts A vector of vector of ContactMap where each indicie corrisponds to a timestep
+ * @param manager A continuous contact manager
+ * @param state0 First environment state
+ * @param state1 Second environment state
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+inline bool checkTrajectorySegment(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                   tesseract_collision::ContinuousContactManager& manager,
+                                   const tesseract_environment::DenseEnvState& state0,
+                                   const tesseract_environment::DenseEnvState& state1,
+                                   const tesseract_collision::CollisionCheckConfig& config)
+{
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(
+        link_name, state0.getLinkTransform(link_name), state1.getLinkTransform(link_name));
+
+  return detail::checkTrajectorySegmentHelper(contacts, manager, config);
+}
+
+/**
+ * @brief Should perform a discrete collision check a state.
+ * @param contacts A vector of vector of ContactMap where each indicie corrisponds to a timestep
+ * @param manager A discrete contact manager
+ * @param state First environment state
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+inline bool checkTrajectoryState(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                 tesseract_collision::DiscreteContactManager& manager,
+                                 const tesseract_environment::EnvState::Ptr& state,
+                                 const tesseract_collision::CollisionCheckConfig& config)
+{
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(link_name, state->link_transforms[link_name]);
+
+  return detail::checkTrajectoryStateHelper(contacts, manager, config);
+}
+
+/**
+ * @brief Should perform a discrete collision check a dense state.
+ * @param contacts A vector of vector of ContactMap where each indicie corrisponds to a timestep
+ * @param manager A discrete contact manager
+ * @param state The environment state
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @return True if collision was found, otherwise false.
+ */
+inline bool checkTrajectoryState(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                                 tesseract_collision::DiscreteContactManager& manager,
+                                 const tesseract_environment::DenseEnvState& state,
+                                 const tesseract_collision::CollisionCheckConfig& config)
+{
+  for (const auto& link_name : manager.getActiveCollisionObjects())
+    manager.setCollisionObjectsTransform(link_name, state.getLinkTransform(link_name));
+
+  return detail::checkTrajectoryStateHelper(contacts, manager, config);
+}
 
 /**
  * @brief Should perform a continuous collision check over the trajectory and stop on first collision.
@@ -185,6 +244,9 @@ inline bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>&
     throw std::runtime_error("checkTrajectory was given continuous contact manager with a trajectory that only has one "
                              "state.");
 
+  // The states are reused for every step so the link transforms are not reallocated
+  tesseract_environment::DenseEnvState state0;
+  tesseract_environment::DenseEnvState state1;
   bool found = false;
   if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
   {
@@ -201,8 +263,8 @@ inline bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>&
 
         for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
         {
-          tesseract_environment::EnvState::Ptr state0 = state_solver.getState(joint_names, subtraj.row(iSubStep));
-          tesseract_environment::EnvState::Ptr state1 = state_solver.getState(joint_names, subtraj.row(iSubStep + 1));
+          state_solver.getState(state0, joint_names, subtraj.row(iSubStep));
+          state_solver.getState(state1, joint_names, subtraj.row(iSubStep + 1));
           if (checkTrajectorySegment(contacts, manager, state0, state1, config))
           {
             found = true;
@@ -233,8 +295,8 @@ inline bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>&
       }
       else
       {
-        tesseract_environment::EnvState::Ptr state0 = state_solver.getState(joint_names, traj.row(iStep));
-        tesseract_environment::EnvState::Ptr state1 = state_solver.getState(joint_names, traj.row(iStep + 1));
+        state_solver.getState(state0, joint_names, traj.row(iStep));
+        state_solver.getState(state1, joint_names, traj.row(iStep + 1));
         if (checkTrajectorySegment(contacts, manager, state0, state1, config))
         {
           found = true;
@@ -265,8 +327,8 @@ inline bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>&
     contacts.reserve(static_cast<size_t>(traj.rows() - 1));
     for (int iStep = 0; iStep < traj.rows() - 1; ++iStep)
     {
-      tesseract_environment::EnvState::Ptr state0 = state_solver.getState(joint_names, traj.row(iStep));
-      tesseract_environment::EnvState::Ptr state1 = state_solver.getState(joint_names, traj.row(iStep + 1));
+      state_solver.getState(state0, joint_names, traj.row(iStep));
+      state_solver.getState(state1, joint_names, traj.row(iStep + 1));
 
       if (checkTrajectorySegment(contacts, manager, state0, state1, config))
       {
@@ -318,9 +380,11 @@ inline bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>&
     throw std::runtime_error("checkTrajectory was given an CollisionEvaluatorType that is inconsistent with the "
                              "ContactManager type");
 
+  // The state is reused for every step so the link transforms are not reallocated
+  tesseract_environment::DenseEnvState state;
   if (traj.rows() == 1)
   {
-    tesseract_environment::EnvState::Ptr state = state_solver.getState(joint_names, traj.row(0));
+    state_solver.getState(state, joint_names, traj.row(0));
     return checkTrajectoryState(contacts, manager, state, config);
   }
 
@@ -343,7 +407,7 @@ inline bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>&
 
         for (int iSubStep = 0; iSubStep < subtraj.rows() - 1; ++iSubStep)
         {
-          tesseract_environment::EnvState::Ptr state = state_solver.getState(joint_names, subtraj.row(iSubStep));
+          state_solver.getState(state, joint_names, subtraj.row(iSubStep));
           if (checkTrajectoryState(contacts, manager, state, config))
           {
             found = true;
@@ -372,7 +436,7 @@ inline bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>&
       }
       else
       {
-        tesseract_environment::EnvState::Ptr state = state_solver.getState(joint_names, traj.row(iStep));
+        state_solver.getState(state, joint_names, traj.row(iStep));
         if (checkTrajectoryState(contacts, manager, state, config))
         {
           found = true;
@@ -401,7 +465,7 @@ inline bool checkTrajectory(std::vector<tesseract_collision::ContactResultMap>&
     contacts.reserve(static_cast<size_t>(traj.rows()));
     for (int iStep = 0; iStep < traj.rows(); ++iStep)
     {
-      tesseract_environment::EnvState::Ptr state = state_solver.getState(joint_names, traj.row(iStep));
+      state_solver.getState(state, joint_names, traj.row(iStep));
       if (checkTrajectoryState(contacts, manager, state, config))
       {
         found = true;
@@ -53,9 +53,17 @@ public:
                          const std::vector<double>& joint_values) const override;
   EnvState::Ptr getState(const std::vector<std::string>& joint_names,
                          const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override;
+  void getState(DenseEnvState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override;
+  void getState(DenseEnvState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override;
 
   EnvState::ConstPtr getCurrentState() const override;
 
+  EnvStateIndex::ConstPtr getStateIndex() const override;
+
+  DenseEnvState::ConstPtr getDenseCurrentState() const override;
+
   EnvState::Ptr getRandomState() const override;
 
   const std::vector<std::string>& getJointNames() const override;
@@ -63,6 +71,16 @@ public:
   const tesseract_common::KinematicLimits& getLimits() const override;
 
 private:
+  /** @brief A step of the program computing the dense states */
+  struct DenseStep
+  {
+    const KDL::Segment* segment{ nullptr }; /**< The segment computed by the step */
+    std::size_t parent_link_index{ 0 };     /**< The index of the parent link transform */
+    std::size_t link_index{ 0 };            /**< The index of the link transform */
+    std::size_t joint_index{ 0 };           /**< The index of the joint transform */
+    long joint_value_index{ -1 };           /**< The index of the joint value, -1 for a fixed joint */
+  };
+
   tesseract_scene_graph::SceneGraph::ConstPtr scene_graph_;    /**< Tesseract Scene Graph */
   EnvState::Ptr current_state_;                                /**< Current state of the environment */
   KDL::Tree kdl_tree_;                                         /**< KDL tree object */
@@ -70,6 +88,10 @@ private:
   KDL::JntArray kdl_jnt_array_;                                /**< The kdl joint array */
   tesseract_common::KinematicLimits limits_;                   /**< The kinematic limits */
   std::vector<std::string> joint_names_;                       /**< The active joint names */
+  EnvStateIndex::ConstPtr state_index_;                        /**< The name to index table of the dense states */
+  std::vector<DenseStep> dense_program_;                       /**< The steps in depth first order of the segments */
+  std::vector<unsigned int> dense_joint_qnrs_;                 /**< The kdl q index of each dense joint value */
+  DenseEnvState::ConstPtr dense_current_state_;                /**< Current dense state, never modified */
 
   /**
    * @brief This used by the clone method
@@ -89,9 +111,30 @@ private:
 
   bool setJointValuesHelper(KDL::JntArray& q, const std::string& joint_name, const double& joint_value) const;
 
+  /** @brief Create the program computing the dense states using the current name to index table */
+  void createDenseProgram();
+
+  /**
+   * @brief Add the steps of a segment and its subtree to the program computing the dense states
+   * @param it The segment to add
+   * @param parent_link_index The index of the parent link transform
+   */
+  void createDenseProgramHelper(const KDL::SegmentMap::const_iterator& it, std::size_t parent_link_index);
+
+  /**
+   * @brief Compute the transforms of a dense state from its joint values
+   * @param state The dense state
+   */
+  void updateDense(DenseEnvState& state) const;
+
+  /** @brief Publish a new dense current state computed from the current kdl joint values */
+  void updateDenseCurrentState();
+
   bool createKDETree();
 
   void onEnvironmentChanged(const Commands& commands) override;
+
+  void onSceneGraphReplaced(tesseract_scene_graph::SceneGraph::ConstPtr scene_graph) override;
 };
 
 }  // namespace tesseract_environment
@@ -34,7 +34,9 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -60,6 +62,30 @@ public:
   using Ptr = std::shared_ptr<OFKTStateSolver>;
   using ConstPtr = std::shared_ptr<const OFKTStateSolver>;
 
+  /**
+   * @brief A precompiled subset of links whose transforms are computed by getLinkTransforms()
+   *
+   * It only contains the steps of the links and their ancestors, so links which are not needed are not computed.
+   */
+  struct LinkSubset
+  {
+    using ConstPtr = std::shared_ptr<const LinkSubset>;
+
+    /** @brief A step computing the transform of a link from the transform of its parent */
+    struct Step
+    {
+      std::size_t program_step{ 0 }; /**< The step of the program computing the dense states */
+      long parent_slot{ -1 };        /**< The slot of the parent link transform, -1 for the root link */
+      std::size_t slot{ 0 };         /**< The slot of the link transform */
+    };
+
+    std::vector<std::string> link_names; /**< The requested links, stored in the first slots in the same order */
+    EnvStateIndex::ConstPtr index;       /**< The name to index table the subset was compiled for */
+    std::vector<Step> steps;             /**< The steps in depth first order of the links and their ancestors */
+    long root_slot{ -1 };                /**< The slot of the root link, -1 if it was not requested */
+    std::size_t size{ 0 };               /**< The number of slots, which includes the ancestors of the links */
+  };
+
   OFKTStateSolver() = default;
   ~OFKTStateSolver() override = default;
   OFKTStateSolver(const OFKTStateSolver&) = delete;
@@ -96,9 +122,42 @@ public:
                          const std::vector<double>& joint_values) const override;
   EnvState::Ptr getState(const std::vector<std::string>& joint_names,
                          const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override;
+  void getState(DenseEnvState& state,
+                const std::vector<std::string>& joint_names,
+                const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override;
+  void getState(DenseEnvState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const override;
+
+  /**
+   * @brief Get the compiled subset of links used by getLinkTransforms()
+   *
+   * The subsets are cached until the environment changes, so this should be called once per set of links.
+   *
+   * @param link_names The unique names of the links to compute
+   * @return The compiled link subset
+   */
+  LinkSubset::ConstPtr getLinkSubset(const std::vector<std::string>& link_names) const;
+
+  /**
+   * @brief Compute only the transforms of a subset of links and their ancestors for the given joint values.
+   *
+   * This does not change the internal state of the environment and does not allocate once link_transforms has been
+   * sized by a previous call.
+   *
+   * @param link_transforms The link transforms, the first ones are in the order of the subset link names and the
+   * remaining ones are the transforms of their ancestors
+   * @param subset The link subset compiled by this state solver or one of its clones
+   * @param joint_values The joint values ordered as getJointNames()
+   */
+  void getLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                         const LinkSubset& subset,
+                         const Eigen::Ref<const Eigen::VectorXd>& joint_values) const;
 
   EnvState::ConstPtr getCurrentState() const override;
 
+  EnvStateIndex::ConstPtr getStateIndex() const override;
+
+  DenseEnvState::ConstPtr getDenseCurrentState() const override;
+
   EnvState::Ptr getRandomState() const override;
 
   const std::vector<std::string>& getJointNames() const override;
@@ -106,6 +165,17 @@ public:
   const tesseract_common::KinematicLimits& getLimits() const override;
 
 private:
+  /** @brief A step of the program computing the dense states */
+  struct DenseStep
+  {
+    const OFKTNode* node{ nullptr };     /**< The node computed by the step */
+    std::size_t parent_link_index{ 0 };  /**< The index of the parent link transform */
+    std::size_t link_index{ 0 };         /**< The index of the link transform */
+    std::size_t joint_index{ 0 };        /**< The index of the joint transform */
+    long joint_value_index{ -1 };        /**< The index of the joint value, -1 for a fixed joint */
+    std::size_t subtree_end{ 0 };        /**< One past the last step of the node's subtree */
+  };
+
   EnvState::Ptr current_state_{ std::make_shared<EnvState>() }; /**< Current state of the environment */
   std::vector<std::string> joint_names_;                        /**< The active joint names */
   std::unordered_map<std::string, OFKTNode::UPtr> nodes_;       /**< The joint name map to node */
@@ -113,6 +183,12 @@ private:
   tesseract_common::KinematicLimits limits_;                    /**< The kinematic limits */
   OFKTNode::UPtr root_;                                         /**< The root node of the tree */
   int revision_{ 0 };                                           /**< The environment revision number */
+  EnvStateIndex::ConstPtr state_index_;                         /**< The name to index table of the dense states */
+  std::vector<DenseStep> dense_program_;                        /**< The steps in depth first order of the nodes */
+  std::vector<std::size_t> dense_joint_steps_;                  /**< The step of each joint value */
+  DenseEnvState::ConstPtr dense_current_state_;                 /**< Current dense state, never modified */
+  mutable std::map<std::vector<std::string>, LinkSubset::ConstPtr> link_subsets_; /**< The compiled link subsets */
+  mutable std::mutex link_subsets_mutex_;                                           /**< The link subsets mutex */
 
   void clear();
 
@@ -133,6 +209,48 @@ private:
    */
   void update(EnvState& state, const OFKTNode* node, Eigen::Isometry3d parent_world_tf, bool update_required) const;
 
+  /** @brief Create the program computing the dense states using the current name to index table */
+  void createDenseProgram();
+
+  /**
+   * @brief Add the steps of a node and its subtree to the program computing the dense states
+   * @param node The node to add
+   * @param parent_link_index The index of the parent link transform
+   */
+  void createDenseProgramHelper(const OFKTNode* node, std::size_t parent_link_index);
+
+  /**
+   * @brief Compile a subset of links using the program computing the dense states
+   * @param link_names The unique names of the links to compute
+   * @return The compiled link subset
+   */
+  LinkSubset::ConstPtr createLinkSubset(const std::vector<std::string>& link_names) const;
+
+  /**
+   * @brief Set a joint value of a dense state and extend the range of steps to compute if it changed
+   * @param state The dense state
+   * @param joint_value_index The index of the joint value
+   * @param joint_value The joint value
+   * @param begin The first step to compute
+   * @param end One past the last step to compute
+   */
+  void setDenseJointValue(DenseEnvState& state,
+                          std::size_t joint_value_index,
+                          double joint_value,
+                          std::size_t& begin,
+                          std::size_t& end) const;
+
+  /**
+   * @brief Compute the transforms of a range of steps of a dense state
+   * @param state The dense state
+   * @param begin The first step to compute
+   * @param end One past the last step to compute
+   */
+  void updateDense(DenseEnvState& state, std::size_t begin, std::size_t end) const;
+
+  /** @brief Publish a new dense current state computed from the joint values stored in the nodes */
+  void updateDenseCurrentState();
+
   /**
    * @brief A helper function used for cloning the OFKTStateSolver
    * @param cloned The cloned object
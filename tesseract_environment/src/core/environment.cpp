@@ -30,6 +30,7 @@
 #include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
 #include <tesseract_srdf/utils.h>
 
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
@@ -100,12 +101,12 @@ bool Environment::reset()
   std::unique_lock<std::shared_mutex> lock(mutex_);
 
   Commands init_command;
-  if (commands_.empty() || !initialized_)
+  if (commands_->empty() || !initialized_)
     return false;
 
   init_command.reserve(static_cast<std::size_t>(init_revision_));
   for (std::size_t i = 0; i < static_cast<std::size_t>(init_revision_); ++i)
-    init_command.push_back(commands_[i]);
+    init_command.push_back((*commands_)[i]);
 
   return initHelper(init_command);
 }
@@ -117,7 +118,8 @@ void Environment::clear()
   init_revision_ = 0;
   scene_graph_ = nullptr;
   scene_graph_const_ = nullptr;
-  commands_.clear();
+  scene_graph_shared_ = false;
+  commands_ = std::make_shared<Commands>();
   link_names_.clear();
   joint_names_.clear();
   active_link_names_.clear();
@@ -176,7 +178,7 @@ int Environment::getRevision() const
 Commands Environment::getCommandHistory() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
-  return commands_;
+  return *commands_;
 }
 
 bool Environment::applyCommands(const Commands& commands)
@@ -212,14 +214,15 @@ Eigen::Isometry3d Environment::findTCP(const tesseract_common::ManipulatorInfo&
       return manipulator_manager_->getGroupsTCP(manip_info.manipulator, tcp_name);
 
     // Check Environment for links and calculate TCP
-    auto link_it = current_state_->link_transforms.find(tcp_name);
-    if (link_it != current_state_->link_transforms.end())
+    auto link_it = current_state_->index->link_indices.find(tcp_name);
+    if (link_it != current_state_->index->link_indices.end())
     {
       // If it is external then the tcp is not attached to the robot
+      const Eigen::Isometry3d& link_tf = current_state_->link_transforms[link_it->second];
       if (manip_info.tcp.isExternal())
-        return link_it->second;
+        return link_tf;
       else
-        return current_state_->link_transforms.at(tip_link).inverse() * link_it->second;
+        return current_state_->getLinkTransform(tip_link).inverse() * link_tf;
     }
 
     // Check callbacks for TCP
@@ -272,6 +275,7 @@ tesseract_scene_graph::ResourceLocator::Ptr Environment::getResourceLocator() co
 void Environment::setName(const std::string& name)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
+  copySharedDataHelper();
   scene_graph_->setName(name);
 }
 
@@ -326,16 +330,24 @@ EnvState::Ptr Environment::getState(const std::vector<std::string>& joint_names,
   return state;
 }
 
+EnvSnapshot::ConstPtr Environment::getSnapshot() const { return std::atomic_load(&snapshot_); }
+
 EnvState::ConstPtr Environment::getCurrentState() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return current_state_;
+  EnvSnapshot::ConstPtr snapshot = getSnapshot();
+  if (snapshot == nullptr)
+    return nullptr;
+
+  return snapshot->getState();
 }
 
 std::chrono::high_resolution_clock::duration Environment::getCurrentStateTimestamp() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return current_state_timestamp_;
+  EnvSnapshot::ConstPtr snapshot = getSnapshot();
+  if (snapshot == nullptr)
+    return std::chrono::high_resolution_clock::duration(0);
+
+  return snapshot->timestamp;
 }
 
 tesseract_scene_graph::Link::ConstPtr Environment::getLink(const std::string& name) const
@@ -389,25 +401,26 @@ tesseract_scene_graph::Joint::ConstPtr Environment::getJoint(const std::string&
 
 Eigen::VectorXd Environment::getCurrentJointValues() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  Eigen::VectorXd jv;
-  jv.resize(static_cast<long int>(active_joint_names_.size()));
-  for (auto j = 0u; j < active_joint_names_.size(); ++j)
-  {
-    jv(j) = current_state_->joints[active_joint_names_[j]];
-  }
+  EnvSnapshot::ConstPtr snapshot = getSnapshot();
+  if (snapshot == nullptr)
+    return Eigen::VectorXd();
 
-  return jv;
+  return getCurrentJointValues(*snapshot->active_joint_names);
 }
 
 Eigen::VectorXd Environment::getCurrentJointValues(const std::vector<std::string>& joint_names) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  Eigen::VectorXd jv;
-  jv.resize(static_cast<long int>(joint_names.size()));
+  EnvSnapshot::ConstPtr snapshot = getSnapshot();
+  Eigen::VectorXd jv = Eigen::VectorXd::Zero(static_cast<long int>(joint_names.size()));
+  if (snapshot == nullptr)
+    return jv;
+
+  const DenseEnvState& state = *snapshot->dense_state;
   for (auto j = 0u; j < joint_names.size(); ++j)
   {
-    jv(j) = current_state_->joints[joint_names[j]];
+    auto it = state.index->joint_indices.find(joint_names[j]);
+    if (it != state.index->joint_indices.end())
+      jv(j) = state.joints(static_cast<Eigen::Index>(it->second));
   }
 
   return jv;
@@ -433,19 +446,35 @@ std::vector<std::string> Environment::getActiveLinkNames() const
 
 tesseract_common::VectorIsometry3d Environment::getLinkTransforms() const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
+  EnvSnapshot::ConstPtr snapshot = getSnapshot();
   tesseract_common::VectorIsometry3d link_tfs;
-  link_tfs.reserve(link_names_.size());
-  for (const auto& link_name : link_names_)
-    link_tfs.push_back(current_state_->link_transforms[link_name]);
+  if (snapshot == nullptr)
+    return link_tfs;
+
+  const DenseEnvState& state = *snapshot->dense_state;
+  link_tfs.reserve(snapshot->link_names->size());
+  for (const auto& link_name : *snapshot->link_names)
+  {
+    auto it = state.index->link_indices.find(link_name);
+    link_tfs.push_back((it != state.index->link_indices.end()) ? state.link_transforms[it->second] :
+                                                                 Eigen::Isometry3d::Identity());
+  }
 
   return link_tfs;
 }
 
 Eigen::Isometry3d Environment::getLinkTransform(const std::string& link_name) const
 {
-  std::shared_lock<std::shared_mutex> lock(mutex_);
-  return current_state_->link_transforms[link_name];
+  EnvSnapshot::ConstPtr snapshot = getSnapshot();
+  if (snapshot == nullptr)
+    return Eigen::Isometry3d::Identity();
+
+  const DenseEnvState& state = *snapshot->dense_state;
+  auto it = state.index->link_indices.find(link_name);
+  if (it == state.index->link_indices.end())
+    return Eigen::Isometry3d::Identity();
+
+  return state.link_transforms[it->second];
 }
 
 StateSolver::Ptr Environment::getStateSolver() const
@@ -509,6 +538,21 @@ Environment::getContinuousContactManager(const std::string& name) const
   return manager;
 }
 
+bool Environment::updateCollisionObjectGeometries(const std::string& link_name)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (scene_graph_->getLink(link_name) == nullptr)
+    return false;
+
+  if (discrete_manager_ != nullptr)
+    discrete_manager_->updateCollisionObjectGeometries(link_name);
+
+  if (continuous_manager_ != nullptr)
+    continuous_manager_->updateCollisionObjectGeometries(link_name);
+
+  return true;
+}
+
 tesseract_common::CollisionMarginData Environment::getCollisionMarginData() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -556,6 +600,9 @@ bool Environment::registerDefaultContactManagersHelper()
   success &= continuous_factory_.registar(tesseract_collision_bullet::BulletCastBVHManager::name(),
                                           &tesseract_collision_bullet::BulletCastBVHManager::create);
 
+  success &= continuous_factory_.registar(tesseract_collision_fcl::FCLCastBVHManager::name(),
+                                          &tesseract_collision_fcl::FCLCastBVHManager::create);
+
   // Set Active contact manager
   success &= setActiveDiscreteContactManagerHelper(tesseract_collision_bullet::BulletDiscreteBVHManager::name());
   success &= setActiveContinuousContactManagerHelper(tesseract_collision_bullet::BulletCastBVHManager::name());
@@ -683,23 +730,43 @@ void Environment::getCollisionObject(tesseract_collision::CollisionShapesConst&
 void Environment::currentStateChanged()
 {
   current_state_timestamp_ = std::chrono::high_resolution_clock::now().time_since_epoch();
-  current_state_ = std::make_shared<EnvState>(*(state_solver_->getCurrentState()));
+
+  // The dense state published by the state solver is never modified, so it is shared instead of copied
+  current_state_ = state_solver_->getDenseCurrentState();
+  const std::vector<std::string>& link_names = current_state_->index->link_names;
   if (discrete_manager_ != nullptr)
-    discrete_manager_->setCollisionObjectsTransform(current_state_->link_transforms);
+    discrete_manager_->setCollisionObjectsTransform(link_names, current_state_->link_transforms);
   if (continuous_manager_ != nullptr)
   {
-    for (const auto& tf : current_state_->link_transforms)
+    for (std::size_t i = 0; i < link_names.size(); ++i)
     {
-      if (std::find(active_link_names_.begin(), active_link_names_.end(), tf.first) != active_link_names_.end())
+      const Eigen::Isometry3d& tf = current_state_->link_transforms[i];
+      if (std::find(active_link_names_.begin(), active_link_names_.end(), link_names[i]) != active_link_names_.end())
       {
-        continuous_manager_->setCollisionObjectsTransform(tf.first, tf.second, tf.second);
+        continuous_manager_->setCollisionObjectsTransform(link_names[i], tf, tf);
       }
       else
       {
-        continuous_manager_->setCollisionObjectsTransform(tf.first, tf.second);
+        continuous_manager_->setCollisionObjectsTransform(link_names[i], tf);
       }
     }
   }
+
+  publishSnapshot();
+}
+
+void Environment::publishSnapshot()
+{
+  EnvSnapshot::ConstPtr previous = std::atomic_load(&snapshot_);
+
+  auto snapshot = std::make_shared<EnvSnapshot>();
+  snapshot->dense_state = current_state_;
+  snapshot->timestamp = current_state_timestamp_;
+  snapshot->revision = revision_;
+  snapshot->version = (previous != nullptr) ? previous->version + 1 : 1;
+  snapshot->link_names = snapshot_link_names_;
+  snapshot->active_joint_names = snapshot_active_joint_names_;
+  std::atomic_store(&snapshot_, EnvSnapshot::ConstPtr(std::move(snapshot)));
 }
 
 void Environment::environmentChanged()
@@ -731,13 +798,17 @@ void Environment::environmentChanged()
   active_link_names_.clear();
   getActiveLinkNamesRecursive(active_link_names_, scene_graph_, scene_graph_->getRoot(), false);
 
+  // The published snapshots share the names until the environment changes again
+  snapshot_link_names_ = std::make_shared<const std::vector<std::string>>(link_names_);
+  snapshot_active_joint_names_ = std::make_shared<const std::vector<std::string>>(active_joint_names_);
+
   if (discrete_manager_ != nullptr)
     discrete_manager_->setActiveCollisionObjects(active_link_names_);
   if (continuous_manager_ != nullptr)
     continuous_manager_->setActiveCollisionObjects(active_link_names_);
 
-  state_solver_->onEnvironmentChanged(commands_);
-  manipulator_manager_->onEnvironmentChanged(commands_);
+  state_solver_->onEnvironmentChanged(*commands_);
+  manipulator_manager_->onEnvironmentChanged(*commands_);
 
   currentStateChanged();
 }
@@ -783,14 +854,19 @@ Environment::Ptr Environment::clone() const
   if (!initialized_)
     return cloned_env;
 
+  // The scene graph and command history are shared until either environment is modified
+  scene_graph_shared_ = true;
+  cloned_env->scene_graph_shared_ = true;
+
   cloned_env->initialized_ = initialized_;
   cloned_env->init_revision_ = revision_;
   cloned_env->revision_ = revision_;
   cloned_env->commands_ = commands_;
-  cloned_env->scene_graph_ = scene_graph_->clone();
-  cloned_env->scene_graph_const_ = cloned_env->scene_graph_;
-  cloned_env->manipulator_manager_ = manipulator_manager_->clone(cloned_env->getSceneGraph());
-  cloned_env->current_state_ = std::make_shared<EnvState>(*current_state_);
+  cloned_env->scene_graph_ = scene_graph_;
+  cloned_env->scene_graph_const_ = scene_graph_const_;
+  cloned_env->manipulator_manager_ = manipulator_manager_->clone(scene_graph_const_);
+  cloned_env->current_state_ = current_state_;
+  cloned_env->current_state_timestamp_ = current_state_timestamp_;
   cloned_env->state_solver_ = state_solver_->clone();
   cloned_env->link_names_ = link_names_;
   cloned_env->joint_names_ = joint_names_;
@@ -798,32 +874,57 @@ Environment::Ptr Environment::clone() const
   cloned_env->active_joint_names_ = active_joint_names_;
   cloned_env->find_tcp_cb_ = find_tcp_cb_;
   cloned_env->collision_margin_data_ = collision_margin_data_;
-  cloned_env->is_contact_allowed_fn_ = std::bind(&tesseract_scene_graph::SceneGraph::isCollisionAllowed,
-                                                 cloned_env->scene_graph_,
-                                                 std::placeholders::_1,
-                                                 std::placeholders::_2);
+  cloned_env->is_contact_allowed_fn_ = is_contact_allowed_fn_;
 
+  // The contact managers are updated by every state change, so they are cloned rather than shared. The clones share the
+  // collision geometry with the original.
   if (discrete_manager_)
-  {
     cloned_env->discrete_manager_ = discrete_manager_->clone();
-    cloned_env->discrete_manager_->setIsContactAllowedFn(cloned_env->is_contact_allowed_fn_);
-  }
   if (continuous_manager_)
-  {
     cloned_env->continuous_manager_ = continuous_manager_->clone();
-    cloned_env->continuous_manager_->setIsContactAllowedFn(cloned_env->is_contact_allowed_fn_);
-  }
 
   cloned_env->discrete_manager_name_ = discrete_manager_name_;
   cloned_env->continuous_manager_name_ = continuous_manager_name_;
   cloned_env->discrete_factory_ = discrete_factory_;
   cloned_env->continuous_factory_ = continuous_factory_;
 
+  // The names are immutable so they are shared with the clone
+  cloned_env->snapshot_link_names_ = snapshot_link_names_;
+  cloned_env->snapshot_active_joint_names_ = snapshot_active_joint_names_;
+  cloned_env->publishSnapshot();
+
   return cloned_env;
 }
 
+void Environment::copySharedDataHelper()
+{
+  if (commands_.use_count() > 1)
+    commands_ = std::make_shared<Commands>(*commands_);
+
+  if (!scene_graph_shared_)
+    return;
+
+  scene_graph_ = scene_graph_->clone();
+  scene_graph_const_ = scene_graph_;
+  is_contact_allowed_fn_ = std::bind(&tesseract_scene_graph::SceneGraph::isCollisionAllowed,
+                                     scene_graph_,
+                                     std::placeholders::_1,
+                                     std::placeholders::_2);
+
+  if (discrete_manager_ != nullptr)
+    discrete_manager_->setIsContactAllowedFn(is_contact_allowed_fn_);
+  if (continuous_manager_ != nullptr)
+    continuous_manager_->setIsContactAllowedFn(is_contact_allowed_fn_);
+
+  manipulator_manager_->scene_graph_ = scene_graph_const_;
+  state_solver_->onSceneGraphReplaced(scene_graph_const_);
+  scene_graph_shared_ = false;
+}
+
 bool Environment::applyCommandsHelper(const Commands& commands)
 {
+  copySharedDataHelper();
+
   bool success = true;
   for (const auto& command : commands)
   {
@@ -1228,7 +1329,7 @@ bool Environment::applyAddCommand(AddLinkCommand::ConstPtr cmd)
   }
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1245,7 +1346,7 @@ bool Environment::applyMoveLinkCommand(const MoveLinkCommand::ConstPtr& cmd)
     return false;
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1256,7 +1357,7 @@ bool Environment::applyMoveJointCommand(const MoveJointCommand::ConstPtr& cmd)
     return false;
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1267,7 +1368,7 @@ bool Environment::applyRemoveLinkCommand(const RemoveLinkCommand::ConstPtr& cmd)
     return false;
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1286,7 +1387,7 @@ bool Environment::applyRemoveJointCommand(const RemoveJointCommand::ConstPtr& cm
     return false;
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1320,7 +1421,7 @@ bool Environment::applyReplaceJointCommand(const ReplaceJointCommand::ConstPtr&
   }
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1336,7 +1437,7 @@ bool Environment::applyChangeJointOriginCommand(const ChangeJointOriginCommand::
     return false;
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1365,7 +1466,7 @@ bool Environment::applyChangeLinkCollisionEnabledCommand(const ChangeLinkCollisi
     return false;
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1377,7 +1478,7 @@ bool Environment::applyChangeLinkVisibilityCommand(const ChangeLinkVisibilityCom
     return false;
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1387,7 +1488,7 @@ bool Environment::applyAddAllowedCollisionCommand(const AddAllowedCollisionComma
   scene_graph_->addAllowedCollision(cmd->getLinkName1(), cmd->getLinkName2(), cmd->getReason());
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1397,7 +1498,7 @@ bool Environment::applyRemoveAllowedCollisionCommand(const RemoveAllowedCollisio
   scene_graph_->removeAllowedCollision(cmd->getLinkName1(), cmd->getLinkName2());
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1407,7 +1508,7 @@ bool Environment::applyRemoveAllowedCollisionLinkCommand(const RemoveAllowedColl
   scene_graph_->removeAllowedCollision(cmd->getLinkName());
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1472,7 +1573,7 @@ bool Environment::applyAddSceneGraphCommand(AddSceneGraphCommand::ConstPtr cmd)
   }
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1498,7 +1599,7 @@ bool Environment::applyChangeJointPositionLimitsCommand(const ChangeJointPositio
   }
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1523,7 +1624,7 @@ bool Environment::applyChangeJointVelocityLimitsCommand(const ChangeJointVelocit
   }
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1548,7 +1649,7 @@ bool Environment::applyChangeJointAccelerationLimitsCommand(const ChangeJointAcc
   }
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1559,7 +1660,7 @@ bool Environment::applyAddKinematicsInformationCommand(const AddKinematicsInform
     return false;
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
@@ -1575,7 +1676,7 @@ bool Environment::applyChangeCollisionMarginsCommand(const ChangeCollisionMargin
     discrete_manager_->setCollisionMarginData(collision_margin_data_, CollisionMarginOverrideType::REPLACE);
 
   ++revision_;
-  commands_.push_back(cmd);
+  commands_->push_back(cmd);
 
   return true;
 }
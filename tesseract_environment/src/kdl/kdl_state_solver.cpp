@@ -58,6 +58,11 @@ bool KDLStateSolver::init(const KDLStateSolver& solver)
   kdl_jnt_array_ = solver.kdl_jnt_array_;
   limits_ = solver.limits_;
   joint_names_ = solver.joint_names_;
+  state_index_ = solver.state_index_;
+  dense_current_state_ = solver.dense_current_state_;
+
+  // The program refers to the segments of the copied tree
+  createDenseProgram();
 
   return true;
 }
@@ -73,6 +78,7 @@ void KDLStateSolver::setState(const std::unordered_map<std::string, double>& joi
   }
 
   calculateTransforms(*current_state_, kdl_jnt_array_, kdl_tree_.getRootSegment(), Eigen::Isometry3d::Identity());
+  updateDenseCurrentState();
 }
 
 void KDLStateSolver::setState(const std::vector<std::string>& joint_names, const std::vector<double>& joint_values)
@@ -87,6 +93,7 @@ void KDLStateSolver::setState(const std::vector<std::string>& joint_names, const
   }
 
   calculateTransforms(*current_state_, kdl_jnt_array_, kdl_tree_.getRootSegment(), Eigen::Isometry3d::Identity());
+  updateDenseCurrentState();
 }
 
 void KDLStateSolver::setState(const std::vector<std::string>& joint_names,
@@ -102,6 +109,7 @@ void KDLStateSolver::setState(const std::vector<std::string>& joint_names,
   }
 
   calculateTransforms(*current_state_, kdl_jnt_array_, kdl_tree_.getRootSegment(), Eigen::Isometry3d::Identity());
+  updateDenseCurrentState();
 }
 
 EnvState::Ptr KDLStateSolver::getState(const std::unordered_map<std::string, double>& joints) const
@@ -160,8 +168,45 @@ EnvState::Ptr KDLStateSolver::getState(const std::vector<std::string>& joint_nam
   return state;
 }
 
+void KDLStateSolver::getState(DenseEnvState& state,
+                              const std::vector<std::string>& joint_names,
+                              const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
+  if (state.index != state_index_)
+    state = *dense_current_state_;
+
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    auto it = state_index_->joint_indices.find(joint_names[i]);
+    if (it == state_index_->joint_indices.end())
+    {
+      CONSOLE_BRIDGE_logError("Tried to set joint name %s which does not exist!", joint_names[i].c_str());
+      continue;
+    }
+
+    state.joints(static_cast<Eigen::Index>(it->second)) = joint_values(static_cast<Eigen::Index>(i));
+  }
+
+  updateDense(state);
+}
+
+void KDLStateSolver::getState(DenseEnvState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<std::size_t>(joint_values.size()) == joint_names_.size());
+  if (state.index != state_index_)
+    state = *dense_current_state_;
+
+  state.joints = joint_values;
+  updateDense(state);
+}
+
 EnvState::ConstPtr KDLStateSolver::getCurrentState() const { return current_state_; }
 
+EnvStateIndex::ConstPtr KDLStateSolver::getStateIndex() const { return state_index_; }
+
+DenseEnvState::ConstPtr KDLStateSolver::getDenseCurrentState() const { return dense_current_state_; }
+
 EnvState::Ptr KDLStateSolver::getRandomState() const
 {
   return getState(joint_names_, tesseract_common::generateRandomNumber(limits_.joint_limits));
@@ -211,6 +256,9 @@ bool KDLStateSolver::createKDETree()
   }
 
   calculateTransforms(*current_state_, kdl_jnt_array_, kdl_tree_.getRootSegment(), Eigen::Isometry3d::Identity());
+  state_index_ = std::make_shared<EnvStateIndex>(joint_names_, *current_state_);
+  createDenseProgram();
+  dense_current_state_ = std::make_shared<DenseEnvState>(state_index_, *current_state_);
   return true;
 }
 
@@ -229,6 +277,66 @@ bool KDLStateSolver::setJointValuesHelper(KDL::JntArray& q,
   return false;
 }
 
+void KDLStateSolver::createDenseProgram()
+{
+  dense_program_.clear();
+  dense_program_.reserve(kdl_tree_.getNrOfSegments());
+
+  // The root link transform never changes so it does not have a step
+  const KDL::SegmentMap::const_iterator root = kdl_tree_.getRootSegment();
+  std::size_t root_link_index = state_index_->link_indices.at(GetTreeElementSegment(root->second).getName());
+  for (const auto& child : root->second.children)
+    createDenseProgramHelper(child, root_link_index);
+
+  dense_joint_qnrs_.clear();
+  dense_joint_qnrs_.reserve(state_index_->joint_names.size());
+  for (const auto& joint_name : state_index_->joint_names)
+    dense_joint_qnrs_.push_back(joint_to_qnr_.at(joint_name));
+}
+
+void KDLStateSolver::createDenseProgramHelper(const KDL::SegmentMap::const_iterator& it, std::size_t parent_link_index)
+{
+  const KDL::Segment& segment = GetTreeElementSegment(it->second);
+
+  DenseStep step;
+  step.segment = &segment;
+  step.parent_link_index = parent_link_index;
+  step.link_index = state_index_->link_indices.at(segment.getName());
+  step.joint_index = state_index_->joint_transform_indices.at(segment.getJoint().getName());
+  if (segment.getJoint().getType() != KDL::Joint::None)
+    step.joint_value_index = static_cast<long>(state_index_->joint_indices.at(segment.getJoint().getName()));
+  dense_program_.push_back(step);
+
+  for (const auto& child : it->second.children)
+    createDenseProgramHelper(child, step.link_index);
+}
+
+void KDLStateSolver::updateDense(DenseEnvState& state) const
+{
+  for (const DenseStep& step : dense_program_)
+  {
+    const double joint_value = (step.joint_value_index < 0) ? 0 : state.joints(step.joint_value_index);
+
+    Eigen::Isometry3d local_frame;
+    KDLToEigen(step.segment->pose(joint_value), local_frame);
+
+    const Eigen::Isometry3d world_tf = state.link_transforms[step.parent_link_index] * local_frame;
+    state.link_transforms[step.link_index] = world_tf;
+    state.joint_transforms[step.joint_index] = world_tf;
+  }
+}
+
+void KDLStateSolver::updateDenseCurrentState()
+{
+  // The published state may be shared, so the new one is computed in a copy
+  auto state = std::make_shared<DenseEnvState>(*dense_current_state_);
+  for (std::size_t i = 0; i < dense_joint_qnrs_.size(); ++i)
+    state->joints(static_cast<Eigen::Index>(i)) = kdl_jnt_array_(dense_joint_qnrs_[i]);
+
+  updateDense(*state);
+  dense_current_state_ = std::move(state);
+}
+
 void KDLStateSolver::calculateTransformsHelper(EnvState& state,
                                                const KDL::JntArray& q_in,
                                                const KDL::SegmentMap::const_iterator& it,
@@ -277,4 +385,9 @@ void KDLStateSolver::onEnvironmentChanged(const Commands& /*commands*/)
   setState(joints);
 }
 
+void KDLStateSolver::onSceneGraphReplaced(tesseract_scene_graph::SceneGraph::ConstPtr scene_graph)
+{
+  scene_graph_ = std::move(scene_graph);
+}
+
 }  // namespace tesseract_environment
@@ -142,7 +142,14 @@ StateSolver::Ptr OFKTStateSolver::clone() const
   cloned->link_map_[root_->getLinkName()] = cloned->root_.get();
   cloned->limits_ = limits_;
   cloned->revision_ = revision_;
+  cloned->state_index_ = state_index_;
+  cloned->dense_current_state_ = dense_current_state_;
   cloneHelper(*cloned, root_.get());
+  cloned->createDenseProgram();
+
+  // The clone has the same name to index table and program so the compiled link subsets are still valid
+  std::lock_guard<std::mutex> lock(link_subsets_mutex_);
+  cloned->link_subsets_ = link_subsets_;
   return cloned;
 }
 
@@ -155,6 +162,13 @@ void OFKTStateSolver::clear()
   limits_ = tesseract_common::KinematicLimits();
   root_ = nullptr;
   revision_ = 0;
+  state_index_ = nullptr;
+  dense_program_.clear();
+  dense_joint_steps_.clear();
+  dense_current_state_ = nullptr;
+
+  std::lock_guard<std::mutex> lock(link_subsets_mutex_);
+  link_subsets_.clear();
 }
 
 bool OFKTStateSolver::init(tesseract_scene_graph::SceneGraph::ConstPtr scene_graph, int revision)
@@ -201,6 +215,9 @@ bool OFKTStateSolver::init(tesseract_scene_graph::SceneGraph::ConstPtr scene_gra
   revision_ = revision;
 
   update(root_.get(), false);
+  state_index_ = std::make_shared<EnvStateIndex>(joint_names_, *current_state_);
+  createDenseProgram();
+  dense_current_state_ = std::make_shared<DenseEnvState>(state_index_, *current_state_);
 
   return true;
 }
@@ -214,6 +231,7 @@ void OFKTStateSolver::setState(const std::unordered_map<std::string, double>& jo
   }
 
   update(root_.get(), false);
+  updateDenseCurrentState();
 }
 
 void OFKTStateSolver::setState(const std::vector<std::string>& joint_names, const std::vector<double>& joint_values)
@@ -226,6 +244,7 @@ void OFKTStateSolver::setState(const std::vector<std::string>& joint_names, cons
   }
 
   update(root_.get(), false);
+  updateDenseCurrentState();
 }
 
 void OFKTStateSolver::setState(const std::vector<std::string>& joint_names,
@@ -240,6 +259,7 @@ void OFKTStateSolver::setState(const std::vector<std::string>& joint_names,
   }
 
   update(root_.get(), false);
+  updateDenseCurrentState();
 }
 
 EnvState::Ptr OFKTStateSolver::getState(const std::unordered_map<std::string, double>& joints) const
@@ -276,8 +296,86 @@ EnvState::Ptr OFKTStateSolver::getState(const std::vector<std::string>& joint_na
   return state;
 }
 
+void OFKTStateSolver::getState(DenseEnvState& state,
+                               const std::vector<std::string>& joint_names,
+                               const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<Eigen::Index>(joint_names.size()) == joint_values.size());
+  if (state.index != state_index_)
+    state = *dense_current_state_;
+
+  std::size_t begin = dense_program_.size();
+  std::size_t end = 0;
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+    setDenseJointValue(state,
+                       state_index_->joint_indices.at(joint_names[i]),
+                       joint_values(static_cast<Eigen::Index>(i)),
+                       begin,
+                       end);
+
+  updateDense(state, begin, end);
+}
+
+void OFKTStateSolver::getState(DenseEnvState& state, const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  assert(static_cast<std::size_t>(joint_values.size()) == dense_joint_steps_.size());
+  if (state.index != state_index_)
+    state = *dense_current_state_;
+
+  std::size_t begin = dense_program_.size();
+  std::size_t end = 0;
+  for (std::size_t i = 0; i < dense_joint_steps_.size(); ++i)
+    setDenseJointValue(state, i, joint_values(static_cast<Eigen::Index>(i)), begin, end);
+
+  updateDense(state, begin, end);
+}
+
+OFKTStateSolver::LinkSubset::ConstPtr OFKTStateSolver::getLinkSubset(const std::vector<std::string>& link_names) const
+{
+  std::lock_guard<std::mutex> lock(link_subsets_mutex_);
+  auto it = link_subsets_.find(link_names);
+  if (it != link_subsets_.end())
+    return it->second;
+
+  LinkSubset::ConstPtr subset = createLinkSubset(link_names);
+  link_subsets_[link_names] = subset;
+  return subset;
+}
+
+void OFKTStateSolver::getLinkTransforms(tesseract_common::VectorIsometry3d& link_transforms,
+                                        const LinkSubset& subset,
+                                        const Eigen::Ref<const Eigen::VectorXd>& joint_values) const
+{
+  if (subset.index != state_index_)
+    throw std::runtime_error("OFKTStateSolver: The link subset was compiled for a different environment revision!");
+
+  assert(static_cast<std::size_t>(joint_values.size()) == dense_joint_steps_.size());
+  link_transforms.resize(subset.size);
+
+  const Eigen::Isometry3d& root_world_tf = root_->getWorldTransformation();
+  if (subset.root_slot >= 0)
+    link_transforms[static_cast<std::size_t>(subset.root_slot)] = root_world_tf;
+
+  for (const auto& step : subset.steps)
+  {
+    const DenseStep& dense_step = dense_program_[step.program_step];
+    const Eigen::Isometry3d& parent_world_tf =
+        (step.parent_slot < 0) ? root_world_tf : link_transforms[static_cast<std::size_t>(step.parent_slot)];
+
+    if (dense_step.joint_value_index < 0)
+      link_transforms[step.slot] = parent_world_tf * dense_step.node->getLocalTransformation();
+    else
+      link_transforms[step.slot] =
+          parent_world_tf * dense_step.node->computeLocalTransformation(joint_values(dense_step.joint_value_index));
+  }
+}
+
 EnvState::ConstPtr OFKTStateSolver::getCurrentState() const { return current_state_; }
 
+EnvStateIndex::ConstPtr OFKTStateSolver::getStateIndex() const { return state_index_; }
+
+DenseEnvState::ConstPtr OFKTStateSolver::getDenseCurrentState() const { return dense_current_state_; }
+
 EnvState::Ptr OFKTStateSolver::getRandomState() const
 {
   return getState(joint_names_, tesseract_common::generateRandomNumber(limits_.joint_limits));
@@ -499,6 +597,9 @@ void OFKTStateSolver::onEnvironmentChanged(const Commands& commands)
   }
 
   update(root_.get(), false);
+  state_index_ = std::make_shared<EnvStateIndex>(joint_names_, *current_state_);
+  createDenseProgram();
+  dense_current_state_ = std::make_shared<DenseEnvState>(state_index_, *current_state_);
 }
 
 void OFKTStateSolver::update(OFKTNode* node, bool update_required)
@@ -556,6 +657,159 @@ void OFKTStateSolver::update(EnvState& state,
     update(state, child, parent_world_tf, update_required);
 }
 
+void OFKTStateSolver::createDenseProgram()
+{
+  {
+    // The compiled link subsets refer to the previous program
+    std::lock_guard<std::mutex> lock(link_subsets_mutex_);
+    link_subsets_.clear();
+  }
+
+  dense_program_.clear();
+  dense_program_.reserve(link_map_.size());
+  dense_joint_steps_.assign(state_index_->joint_names.size(), 0);
+
+  // The root link transform never changes so it does not have a step
+  std::size_t root_link_index = state_index_->link_indices.at(root_->getLinkName());
+  for (const auto* child : root_->getChildren())
+    createDenseProgramHelper(child, root_link_index);
+}
+
+void OFKTStateSolver::createDenseProgramHelper(const OFKTNode* node, std::size_t parent_link_index)
+{
+  std::size_t step_index = dense_program_.size();
+
+  DenseStep step;
+  step.node = node;
+  step.parent_link_index = parent_link_index;
+  step.link_index = state_index_->link_indices.at(node->getLinkName());
+  step.joint_index = state_index_->joint_transform_indices.at(node->getJointName());
+  if (node->getType() != tesseract_scene_graph::JointType::FIXED)
+  {
+    std::size_t joint_value_index = state_index_->joint_indices.at(node->getJointName());
+    step.joint_value_index = static_cast<long>(joint_value_index);
+    dense_joint_steps_[joint_value_index] = step_index;
+  }
+  dense_program_.push_back(step);
+
+  for (const auto* child : node->getChildren())
+    createDenseProgramHelper(child, step.link_index);
+
+  dense_program_[step_index].subtree_end = dense_program_.size();
+}
+
+OFKTStateSolver::LinkSubset::ConstPtr
+OFKTStateSolver::createLinkSubset(const std::vector<std::string>& link_names) const
+{
+  auto subset = std::make_shared<LinkSubset>();
+  subset->link_names = link_names;
+  subset->index = state_index_;
+
+  // The slot of each requested link by link transform index
+  const std::size_t root_link_index = state_index_->link_indices.at(root_->getLinkName());
+  std::vector<long> link_slots(state_index_->link_names.size(), -1);
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+  {
+    auto it = state_index_->link_indices.find(link_names[i]);
+    if (it == state_index_->link_indices.end())
+      throw std::runtime_error("OFKTStateSolver: The link subset has an unknown link '" + link_names[i] + "'!");
+
+    if (link_slots[it->second] >= 0)
+      throw std::runtime_error("OFKTStateSolver: The link subset has a duplicate link '" + link_names[i] + "'!");
+
+    link_slots[it->second] = static_cast<long>(i);
+    if (it->second == root_link_index)
+      subset->root_slot = static_cast<long>(i);
+  }
+
+  // A step is needed if its subtree contains a requested link, the steps of a subtree are contiguous
+  std::vector<bool> needed(dense_program_.size(), false);
+  for (std::size_t i = 0; i < dense_program_.size(); ++i)
+  {
+    if (link_slots[dense_program_[i].link_index] < 0)
+      continue;
+
+    for (std::size_t j = 0; j <= i; ++j)
+    {
+      if (!needed[j] && i < dense_program_[j].subtree_end)
+        needed[j] = true;
+    }
+  }
+
+  // The ancestors of the requested links are stored after them
+  std::size_t next_slot = link_names.size();
+  for (std::size_t i = 0; i < dense_program_.size(); ++i)
+  {
+    if (!needed[i])
+      continue;
+
+    const DenseStep& dense_step = dense_program_[i];
+    long& slot = link_slots[dense_step.link_index];
+    if (slot < 0)
+      slot = static_cast<long>(next_slot++);
+
+    LinkSubset::Step step;
+    step.program_step = i;
+    if (dense_step.parent_link_index != root_link_index)
+      step.parent_slot = link_slots[dense_step.parent_link_index];
+    step.slot = static_cast<std::size_t>(slot);
+    subset->steps.push_back(step);
+  }
+  subset->size = next_slot;
+
+  return subset;
+}
+
+void OFKTStateSolver::setDenseJointValue(DenseEnvState& state,
+                                         std::size_t joint_value_index,
+                                         double joint_value,
+                                         std::size_t& begin,
+                                         std::size_t& end) const
+{
+  // An exact comparison keeps the joint values and transforms consistent for any number of tiny increments
+  double& value = state.joints(static_cast<Eigen::Index>(joint_value_index));
+  if (value == joint_value)
+    return;
+
+  value = joint_value;
+
+  // The steps of a subtree are contiguous, so the range covers the subtrees of all changed joints
+  std::size_t step_index = dense_joint_steps_[joint_value_index];
+  begin = std::min(begin, step_index);
+  end = std::max(end, dense_program_[step_index].subtree_end);
+}
+
+void OFKTStateSolver::updateDense(DenseEnvState& state, std::size_t begin, std::size_t end) const
+{
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    const DenseStep& step = dense_program_[i];
+    const Eigen::Isometry3d& parent_world_tf = state.link_transforms[step.parent_link_index];
+
+    Eigen::Isometry3d world_tf;
+    if (step.joint_value_index < 0)
+      world_tf = parent_world_tf * step.node->getLocalTransformation();
+    else
+      world_tf = parent_world_tf * step.node->computeLocalTransformation(state.joints(step.joint_value_index));
+
+    state.link_transforms[step.link_index] = world_tf;
+    state.joint_transforms[step.joint_index] = world_tf;
+  }
+}
+
+void OFKTStateSolver::updateDenseCurrentState()
+{
+  // The published state may be shared, so the new one is computed in a copy
+  auto state = std::make_shared<DenseEnvState>(*dense_current_state_);
+  std::size_t begin = dense_program_.size();
+  std::size_t end = 0;
+  for (std::size_t i = 0; i < dense_joint_steps_.size(); ++i)
+    setDenseJointValue(*state, i, dense_program_[dense_joint_steps_[i]].node->getJointValue(), begin, end);
+
+  updateDense(*state, begin, end);
+  dense_current_state_ = std::move(state);
+}
+
 void OFKTStateSolver::moveLinkHelper(std::vector<tesseract_scene_graph::Joint::ConstPtr>& new_kinematic_joints,
                                      const tesseract_scene_graph::Joint::ConstPtr& joint)
 {
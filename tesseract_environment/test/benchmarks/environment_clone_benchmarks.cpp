@@ -57,6 +57,32 @@ static void BM_ENVIRONMENT_CLONE(benchmark::State& state, Environment::Ptr env)
   }
 };
 
+/** @brief Benchmark that checks the Tesseract clone method followed by a modification, which copies the shared data */
+static void BM_ENVIRONMENT_CLONE_MODIFY(benchmark::State& state, Environment::Ptr env)
+{
+  auto cmd = std::make_shared<AddAllowedCollisionCommand>("link_1", "link_6", "Benchmark");
+  Environment::Ptr clone;
+  for (auto _ : state)
+  {
+    clone = env->clone();
+    benchmark::DoNotOptimize(clone->applyCommand(cmd));
+  }
+};
+
+/** @brief Benchmark that checks the Tesseract clone method followed by setting the state of the clone */
+static void BM_ENVIRONMENT_CLONE_SET_STATE(benchmark::State& state, Environment::Ptr env)
+{
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.1);
+  Environment::Ptr clone;
+  for (auto _ : state)
+  {
+    clone = env->clone();
+    clone->setState(joint_names, joint_values);
+    benchmark::DoNotOptimize(clone);
+  }
+};
+
 int main(int argc, char** argv)
 {
   Environment::Ptr env = std::make_shared<Environment>();
@@ -74,6 +100,22 @@ int main(int argc, char** argv)
         ->Unit(benchmark::TimeUnit::kMicrosecond);
   }
 
+  {
+    std::function<void(benchmark::State&, Environment::Ptr)> BM_CLONE_MODIFY_FUNC = BM_ENVIRONMENT_CLONE_MODIFY;
+    std::string name = "BM_ENVIRONMENT_CLONE_MODIFY";
+    benchmark::RegisterBenchmark(name.c_str(), BM_CLONE_MODIFY_FUNC, env)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  {
+    std::function<void(benchmark::State&, Environment::Ptr)> BM_CLONE_SET_STATE_FUNC = BM_ENVIRONMENT_CLONE_SET_STATE;
+    std::string name = "BM_ENVIRONMENT_CLONE_SET_STATE";
+    benchmark::RegisterBenchmark(name.c_str(), BM_CLONE_SET_STATE_FUNC, env)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
   benchmark::Initialize(&argc, argv);
   benchmark::RunSpecifiedBenchmarks();
 }
@@ -0,0 +1,156 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <tesseract_urdf/urdf_parser.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/core/environment.h>
+#include <tesseract_environment/ofkt/ofkt_state_solver.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_collision;
+using namespace tesseract_environment;
+
+std::string locateResource(const std::string& url)
+{
+  std::string mod_url = url;
+  if (url.find("package://tesseract_support") == 0)
+  {
+    mod_url.erase(0, strlen("package://tesseract_support"));
+    size_t pos = mod_url.find('/');
+    if (pos == std::string::npos)
+    {
+      return std::string();
+    }
+
+    std::string package = mod_url.substr(0, pos);
+    mod_url.erase(0, pos);
+    std::string package_path = std::string(TESSERACT_SUPPORT_DIR);
+
+    if (package_path.empty())
+    {
+      return std::string();
+    }
+
+    mod_url = package_path + mod_url;
+  }
+
+  return mod_url;
+}
+
+SceneGraph::Ptr getSceneGraph()
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf";
+
+  tesseract_scene_graph::ResourceLocator::Ptr locator =
+      std::make_shared<tesseract_scene_graph::SimpleResourceLocator>(locateResource);
+  return tesseract_urdf::parseURDFFile(path, locator);
+}
+
+/** @brief A read of the environment which is measured under contention */
+using ReadFn = std::function<void(const Environment&)>;
+
+/**
+ * @brief Benchmark that reads the environment while other threads read it and one thread sets its state
+ * @param read_fn The read which is measured, the background readers perform the same read
+ * @param num_readers The number of background reader threads
+ * @param write_period The period of the writer thread, zero sets the state continuously
+ */
+static void BM_ENVIRONMENT_CONTENTION(benchmark::State& state,
+                                      Environment::Ptr env,
+                                      ReadFn read_fn,
+                                      int num_readers,
+                                      std::chrono::microseconds write_period)
+{
+  std::vector<std::unordered_map<std::string, double>> joint_states;
+  StateSolver::Ptr state_solver = env->getStateSolver();
+  for (int i = 0; i < 100; ++i)
+    joint_states.push_back(state_solver->getRandomState()->joints);
+
+  std::atomic<bool> done{ false };
+  std::atomic<long> num_writes{ 0 };
+  std::vector<std::thread> threads;
+  threads.reserve(static_cast<std::size_t>(num_readers) + 1);
+  for (int i = 0; i < num_readers; ++i)
+  {
+    threads.emplace_back([&env, &read_fn, &done]() {
+      while (!done)
+        read_fn(*env);
+    });
+  }
+
+  threads.emplace_back([&env, &joint_states, &done, &num_writes, write_period]() {
+    std::size_t i = 0;
+    while (!done)
+    {
+      env->setState(joint_states[i++ % joint_states.size()]);
+      ++num_writes;
+      if (write_period.count() > 0)
+        std::this_thread::sleep_for(write_period);
+    }
+  });
+
+  for (auto _ : state)
+    read_fn(*env);
+
+  done = true;
+  for (auto& thread : threads)
+    thread.join();
+
+  state.counters["readers"] = num_readers;
+  state.counters["writes"] = benchmark::Counter(static_cast<double>(num_writes), benchmark::Counter::kIsRate);
+};
+
+int main(int argc, char** argv)
+{
+  Environment::Ptr env = std::make_shared<Environment>();
+  env->init<OFKTStateSolver>(*getSceneGraph());
+
+  const std::string tip_link = env->getLinkNames().back();
+  const std::vector<std::pair<std::string, ReadFn>> read_fns = {
+    { "GET_CURRENT_STATE",
+      [](const Environment& env) { benchmark::DoNotOptimize(env.getCurrentState()); } },
+    { "GET_LINK_TRANSFORM",
+      [tip_link](const Environment& env) { benchmark::DoNotOptimize(env.getLinkTransform(tip_link)); } },
+    { "GET_CURRENT_JOINT_VALUES",
+      [](const Environment& env) { benchmark::DoNotOptimize(env.getCurrentJointValues()); } },
+    // A reference read which takes the environment lock
+    { "GET_ACTIVE_JOINT_NAMES",
+      [](const Environment& env) { benchmark::DoNotOptimize(env.getActiveJointNames()); } }
+  };
+
+  // The writer either sets the state continuously or at 500 Hz like a joint state monitor
+  const std::vector<std::chrono::microseconds> write_periods = { std::chrono::microseconds(0),
+                                                                 std::chrono::microseconds(2000) };
+
+  std::vector<int> num_readers = { 0, 1, 4 };
+  if (std::string(BENCHMARK_ARGS).compare("CI_ONLY") != 0)
+    num_readers = { 0, 1, 2, 4, 8, 16, 32 };
+
+  //////////////////////////////////////
+  // Contention
+  //////////////////////////////////////
+  {
+    std::function<void(benchmark::State&, Environment::Ptr, ReadFn, int, std::chrono::microseconds)>
+        BM_CONTENTION_FUNC = BM_ENVIRONMENT_CONTENTION;
+    for (const auto& read_fn : read_fns)
+    {
+      for (const auto& write_period : write_periods)
+      {
+        for (const auto& num : num_readers)
+        {
+          std::string name = "BM_ENVIRONMENT_CONTENTION_" + read_fn.first + "_READERS_" + std::to_string(num) +
+                             "_WRITE_PERIOD_" + std::to_string(write_period.count()) + "US";
+          benchmark::RegisterBenchmark(name.c_str(), BM_CONTENTION_FUNC, env, read_fn.second, num, write_period)
+              ->UseRealTime()
+              ->Unit(benchmark::TimeUnit::kNanosecond);
+        }
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,201 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <tesseract_urdf/urdf_parser.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract_environment/kdl/kdl_state_solver.h>
+#include <tesseract_environment/ofkt/ofkt_state_solver.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_environment;
+
+/** @brief The number of heap allocations made by the process */
+static std::atomic<std::size_t> allocation_count{ 0 };
+
+#ifdef __GLIBC__
+// Interpose the C allocation functions so the allocations of operator new and the Eigen aligned allocator are all
+// counted
+extern "C" {
+void* __libc_malloc(std::size_t size);                 // NOLINT
+void* __libc_calloc(std::size_t n, std::size_t size);  // NOLINT
+void* __libc_realloc(void* ptr, std::size_t size);     // NOLINT
+
+void* malloc(std::size_t size)  // NOLINT
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t n, std::size_t size)  // NOLINT
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(n, size);
+}
+
+void* realloc(void* ptr, std::size_t size)  // NOLINT
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+std::string locateResource(const std::string& url)
+{
+  std::string mod_url = url;
+  if (url.find("package://tesseract_support") == 0)
+  {
+    mod_url.erase(0, strlen("package://tesseract_support"));
+    size_t pos = mod_url.find('/');
+    if (pos == std::string::npos)
+    {
+      return std::string();
+    }
+
+    std::string package = mod_url.substr(0, pos);
+    mod_url.erase(0, pos);
+    std::string package_path = std::string(TESSERACT_SUPPORT_DIR);
+
+    if (package_path.empty())
+    {
+      return std::string();
+    }
+
+    mod_url = package_path + mod_url;
+  }
+
+  return mod_url;
+}
+
+SceneGraph::Ptr getSceneGraph(const std::string& name)
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/" + name + ".urdf";
+
+  tesseract_scene_graph::ResourceLocator::Ptr locator =
+      std::make_shared<tesseract_scene_graph::SimpleResourceLocator>(locateResource);
+  return tesseract_urdf::parseURDFFile(path, locator);
+}
+
+/** @brief Get two joint configurations so every iteration changes the joint values */
+std::array<Eigen::VectorXd, 2> getJointValues(const StateSolver& state_solver)
+{
+  auto size = static_cast<Eigen::Index>(state_solver.getJointNames().size());
+  return { Eigen::VectorXd::Constant(size, 0.1), Eigen::VectorXd::Constant(size, -0.1) };
+}
+
+/** @brief Report the average number of heap allocations per iteration */
+void setAllocationCounter(benchmark::State& state, std::size_t allocations)
+{
+  state.counters["allocations"] =
+      benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+/** @brief Benchmark that checks the getState method returning a new environment state */
+static void BM_GET_STATE(benchmark::State& state, StateSolver::Ptr state_solver)
+{
+  const std::vector<std::string>& joint_names = state_solver->getJointNames();
+  std::array<Eigen::VectorXd, 2> joint_values = getJointValues(*state_solver);
+  std::size_t i = 0;
+
+  std::size_t allocations = allocation_count;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(state_solver->getState(joint_names, joint_values[i++ % 2]));
+  }
+  setAllocationCounter(state, allocation_count - allocations);
+}
+
+/** @brief Benchmark that checks the getState method filling a preallocated dense environment state */
+static void BM_GET_STATE_DENSE(benchmark::State& state, StateSolver::Ptr state_solver)
+{
+  const std::vector<std::string>& joint_names = state_solver->getJointNames();
+  std::array<Eigen::VectorXd, 2> joint_values = getJointValues(*state_solver);
+  std::size_t i = 0;
+
+  // The first call sizes the state to the state solver
+  DenseEnvState dense_state;
+  state_solver->getState(dense_state, joint_names, joint_values[1]);
+
+  std::size_t allocations = allocation_count;
+  for (auto _ : state)
+  {
+    state_solver->getState(dense_state, joint_names, joint_values[i++ % 2]);
+    benchmark::DoNotOptimize(dense_state.link_transforms.data());
+  }
+  setAllocationCounter(state, allocation_count - allocations);
+}
+
+/** @brief Benchmark that checks the getLinkTransforms method computing a subset of links */
+static void BM_GET_LINK_TRANSFORMS(benchmark::State& state,
+                                   OFKTStateSolver::Ptr state_solver,
+                                   std::vector<std::string> link_names)
+{
+  std::array<Eigen::VectorXd, 2> joint_values = getJointValues(*state_solver);
+  std::size_t i = 0;
+
+  // The first call sizes the link transforms to the subset
+  OFKTStateSolver::LinkSubset::ConstPtr subset = state_solver->getLinkSubset(link_names);
+  tesseract_common::VectorIsometry3d link_transforms;
+  state_solver->getLinkTransforms(link_transforms, *subset, joint_values[1]);
+
+  std::size_t allocations = allocation_count;
+  for (auto _ : state)
+  {
+    state_solver->getLinkTransforms(link_transforms, *subset, joint_values[i++ % 2]);
+    benchmark::DoNotOptimize(link_transforms.data());
+  }
+  setAllocationCounter(state, allocation_count - allocations);
+}
+
+int main(int argc, char** argv)
+{
+  std::vector<std::string> robots = { "lbr_iiwa_14_r820", "abb_irb2400" };
+  for (const auto& robot : robots)
+  {
+    SceneGraph::Ptr scene_graph = getSceneGraph(robot);
+
+    std::vector<std::pair<std::string, StateSolver::Ptr>> state_solvers;
+    auto ofkt_state_solver = std::make_shared<OFKTStateSolver>();
+    ofkt_state_solver->init(scene_graph);
+    state_solvers.emplace_back("OFKT", ofkt_state_solver);
+
+    auto kdl_state_solver = std::make_shared<KDLStateSolver>();
+    kdl_state_solver->init(scene_graph);
+    state_solvers.emplace_back("KDL", kdl_state_solver);
+
+    for (const auto& state_solver : state_solvers)
+    {
+      {
+        std::function<void(benchmark::State&, StateSolver::Ptr)> BM_GET_STATE_FUNC = BM_GET_STATE;
+        std::string name = "BM_GET_STATE_" + state_solver.first + "_" + robot;
+        benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_FUNC, state_solver.second)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kNanosecond);
+      }
+
+      {
+        std::function<void(benchmark::State&, StateSolver::Ptr)> BM_GET_STATE_DENSE_FUNC = BM_GET_STATE_DENSE;
+        std::string name = "BM_GET_STATE_DENSE_" + state_solver.first + "_" + robot;
+        benchmark::RegisterBenchmark(name.c_str(), BM_GET_STATE_DENSE_FUNC, state_solver.second)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kNanosecond);
+      }
+    }
+
+    {
+      std::function<void(benchmark::State&, OFKTStateSolver::Ptr, std::vector<std::string>)>
+          BM_GET_LINK_TRANSFORMS_FUNC = BM_GET_LINK_TRANSFORMS;
+      std::string name = "BM_GET_LINK_TRANSFORMS_OFKT_" + robot;
+      std::vector<std::string> link_names = { "link_3", "tool0" };
+      benchmark::RegisterBenchmark(name.c_str(), BM_GET_LINK_TRANSFORMS_FUNC, ofkt_state_solver, link_names)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
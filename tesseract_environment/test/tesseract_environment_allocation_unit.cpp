@@ -0,0 +1,161 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <tesseract_urdf/urdf_parser.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/kdl/kdl_state_solver.h>
+#include <tesseract_environment/ofkt/ofkt_state_solver.h>
+
+using namespace tesseract_scene_graph;
+using namespace tesseract_environment;
+
+namespace
+{
+std::atomic<long> allocation_count{ 0 };
+std::atomic<bool> count_allocations{ false };
+}  // namespace
+
+#ifdef __GLIBC__
+// Interpose the C allocation functions so the allocations of operator new and the Eigen aligned allocator are all
+// counted
+extern "C" {
+void* __libc_malloc(std::size_t size);                 // NOLINT
+void* __libc_calloc(std::size_t n, std::size_t size);  // NOLINT
+void* __libc_realloc(void* ptr, std::size_t size);     // NOLINT
+
+void* malloc(std::size_t size)  // NOLINT
+{
+  if (count_allocations.load(std::memory_order_relaxed))
+    ++allocation_count;
+
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t n, std::size_t size)  // NOLINT
+{
+  if (count_allocations.load(std::memory_order_relaxed))
+    ++allocation_count;
+
+  return __libc_calloc(n, size);
+}
+
+void* realloc(void* ptr, std::size_t size)  // NOLINT
+{
+  if (count_allocations.load(std::memory_order_relaxed))
+    ++allocation_count;
+
+  return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+/** @brief Count the number of heap allocations made while running the function */
+template <typename Fn>
+long countAllocations(Fn fn)
+{
+  allocation_count = 0;
+  count_allocations = true;
+  fn();
+  count_allocations = false;
+  return allocation_count.load();
+}
+
+std::string locateResource(const std::string& url)
+{
+  std::string mod_url = url;
+  if (url.find("package://tesseract_support") == 0)
+  {
+    mod_url.erase(0, strlen("package://tesseract_support"));
+    size_t pos = mod_url.find('/');
+    if (pos == std::string::npos)
+    {
+      return std::string();
+    }
+
+    std::string package = mod_url.substr(0, pos);
+    mod_url.erase(0, pos);
+    std::string package_path = std::string(TESSERACT_SUPPORT_DIR);
+
+    if (package_path.empty())
+    {
+      return std::string();
+    }
+
+    mod_url = package_path + mod_url;
+  }
+
+  return mod_url;
+}
+
+SceneGraph::Ptr getSceneGraph()
+{
+  std::string path = std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf";
+
+  tesseract_scene_graph::ResourceLocator::Ptr locator =
+      std::make_shared<tesseract_scene_graph::SimpleResourceLocator>(locateResource);
+  return tesseract_urdf::parseURDFFile(path, locator);
+}
+
+/** @brief Check getState into a dense state which has been sized by a previous call does not allocate */
+void runDenseGetStateAllocationTest(const StateSolver& state_solver)
+{
+  const std::vector<std::string>& joint_names = state_solver.getJointNames();
+  auto size = static_cast<Eigen::Index>(joint_names.size());
+  Eigen::VectorXd joint_values0 = Eigen::VectorXd::Constant(size, 0.1);
+  Eigen::VectorXd joint_values1 = Eigen::VectorXd::Constant(size, -0.1);
+
+  // The first call sizes the state to the state solver
+  DenseEnvState dense_state;
+  state_solver.getState(dense_state, joint_names, joint_values0);
+  ASSERT_TRUE(dense_state.index != nullptr);
+  EXPECT_EQ(dense_state.link_transforms.size(), dense_state.index->link_names.size());
+
+  long allocations = countAllocations([&]() {
+    for (int i = 0; i < 10; ++i)
+    {
+      state_solver.getState(dense_state, joint_names, joint_values1);
+      state_solver.getState(dense_state, joint_names, joint_values0);
+      state_solver.getState(dense_state, joint_values1);
+      state_solver.getState(dense_state, joint_values0);
+    }
+  });
+  EXPECT_EQ(allocations, 0);
+
+  // The dense state matches the map based state
+  EnvState::Ptr state = state_solver.getState(joint_names, joint_values0);
+  for (std::size_t i = 0; i < dense_state.link_transforms.size(); ++i)
+  {
+    const std::string& link_name = dense_state.index->link_names[i];
+    EXPECT_TRUE(dense_state.link_transforms[i].isApprox(state->link_transforms.at(link_name), 1e-8));
+  }
+}
+
+TEST(TesseractEnvironmentUnit, OFKTDenseGetStateAllocationUnit)  // NOLINT
+{
+  SceneGraph::Ptr scene_graph = getSceneGraph();
+  ASSERT_TRUE(scene_graph != nullptr);
+
+  OFKTStateSolver state_solver;
+  ASSERT_TRUE(state_solver.init(scene_graph));
+  runDenseGetStateAllocationTest(state_solver);
+}
+
+TEST(TesseractEnvironmentUnit, KDLDenseGetStateAllocationUnit)  // NOLINT
+{
+  SceneGraph::Ptr scene_graph = getSceneGraph();
+  ASSERT_TRUE(scene_graph != nullptr);
+
+  KDLStateSolver state_solver;
+  ASSERT_TRUE(state_solver.init(scene_graph));
+  runDenseGetStateAllocationTest(state_solver);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
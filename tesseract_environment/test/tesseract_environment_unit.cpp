@@ -2,13 +2,17 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <vector>
 #include <tesseract_urdf/urdf_parser.h>
 #include <tesseract_collision/bullet/bullet_discrete_bvh_manager.h>
 #include <tesseract_collision/fcl/fcl_discrete_managers.h>
+#include <tesseract_collision/fcl/fcl_cast_managers.h>
 #include <tesseract_collision/bullet/bullet_cast_bvh_manager.h>
 #include <tesseract_scene_graph/resource_locator.h>
 #include <tesseract_geometry/impl/box.h>
+#include <tesseract_geometry/impl/octree.h>
 #include <tesseract_common/utils.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -129,6 +133,32 @@ void runCompareEnvStates(const std::vector<std::string>& base_joint_names,
   }
 }
 
+void runCompareDenseEnvState(const StateSolver& solver)
+{
+  EnvState::ConstPtr state = solver.getCurrentState();
+  DenseEnvState::ConstPtr dense_state = solver.getDenseCurrentState();
+  ASSERT_TRUE(dense_state->index != nullptr);
+  EXPECT_TRUE(dense_state->index == solver.getStateIndex());
+  EXPECT_EQ(dense_state->index->joint_names, solver.getJointNames());
+  EXPECT_EQ(state->joints.size(), static_cast<std::size_t>(dense_state->joints.size()));
+  EXPECT_EQ(state->link_transforms.size(), dense_state->link_transforms.size());
+  EXPECT_EQ(state->joint_transforms.size(), dense_state->joint_transforms.size());
+
+  for (const auto& joint : state->joints)
+    EXPECT_NEAR(joint.second, dense_state->getJointValue(joint.first), 1e-6);
+
+  for (const auto& link : state->link_transforms)
+    EXPECT_TRUE(link.second.isApprox(dense_state->getLinkTransform(link.first), 1e-6));
+
+  for (const auto& joint : state->joint_transforms)
+    EXPECT_TRUE(joint.second.isApprox(dense_state->getJointTransform(joint.first), 1e-6));
+
+  // Copies share the name to index table
+  DenseEnvState copied_state = *dense_state;
+  EXPECT_TRUE(copied_state.index == dense_state->index);
+  runCompareEnvStates(solver.getJointNames(), *state, copied_state.toEnvState());
+}
+
 void runGetLinkTransformsTest(Environment& env)
 {
   StateSolver::Ptr state_solver = env.getStateSolver();
@@ -177,6 +207,8 @@ void runCompareStateSolvers(StateSolver& base_solver, StateSolver& compare_solve
   }
 
   runCompareEnvStates(base_joint_names, *base_solver.getCurrentState(), *compare_solver.getCurrentState());
+  runCompareDenseEnvState(base_solver);
+  runCompareDenseEnvState(compare_solver);
 
   for (int i = 0; i < 20; ++i)
   {
@@ -187,10 +219,55 @@ void runCompareStateSolvers(StateSolver& base_solver, StateSolver& compare_solve
 
   for (int i = 0; i < 20; ++i)
   {
+    // Setting the state publishes a new dense state and leaves the previous one unchanged
+    DenseEnvState::ConstPtr previous_dense_state = compare_solver.getDenseCurrentState();
+    EnvState previous_state = previous_dense_state->toEnvState();
+
     EnvState::Ptr random_state = base_solver.getRandomState();
     compare_solver.setState(random_state->joints);
     runCompareEnvStates(base_joint_names, *random_state, *compare_solver.getCurrentState());
+    runCompareDenseEnvState(compare_solver);
+    EXPECT_TRUE(compare_solver.getDenseCurrentState() != previous_dense_state);
+    runCompareEnvStates(base_joint_names, previous_state, previous_dense_state->toEnvState());
+  }
+
+  // The dense state is reused and joints which are not provided keep their values
+  DenseEnvState dense_state;
+  DenseEnvState base_dense_state;
+  for (int i = 0; i < 20; ++i)
+  {
+    EnvState::Ptr random_state = base_solver.getRandomState();
+    std::vector<std::string> joint_names = base_joint_names;
+    if (i % 2 == 1)
+    {
+      joint_names.resize(1);
+      random_state->joints = dense_state.toEnvState().joints;
+      random_state->joints[joint_names[0]] = base_solver.getRandomState()->joints[joint_names[0]];
+      random_state = base_solver.getState(random_state->joints);
+    }
+
+    Eigen::VectorXd joint_values = random_state->getJointValues(joint_names);
+    compare_solver.getState(dense_state, joint_names, joint_values);
+    EXPECT_TRUE(dense_state.index == compare_solver.getStateIndex());
+    runCompareEnvStates(base_joint_names, *random_state, dense_state.toEnvState());
+
+    base_solver.getState(base_dense_state, joint_names, joint_values);
+    EXPECT_TRUE(base_dense_state.index == base_solver.getStateIndex());
+    runCompareEnvStates(base_joint_names, *random_state, base_dense_state.toEnvState());
+  }
+
+  // Many tiny changes of a joint value add up in the transforms
+  const std::vector<std::string> joint_name{ base_joint_names.front() };
+  Eigen::VectorXd joint_value = dense_state.getJointValues(joint_name);
+  for (int i = 0; i < 4000; ++i)
+  {
+    joint_value(0) += 5e-9;
+    compare_solver.getState(dense_state, joint_name, joint_value);
+    base_solver.getState(base_dense_state, joint_name, joint_value);
   }
+  EnvState::Ptr incremented_state = base_solver.getState(dense_state.toEnvState().joints);
+  runCompareEnvStates(base_joint_names, *incremented_state, dense_state.toEnvState());
+  runCompareEnvStates(base_joint_names, *incremented_state, base_dense_state.toEnvState());
 }
 
 enum class EnvRegisterMethod
@@ -285,6 +362,7 @@ Environment::Ptr getEnvironment(EnvRegisterMethod register_contact_managers = En
                 nullptr);
     EXPECT_TRUE(env->getContinuousContactManager(tesseract_collision_bullet::BulletCastBVHManager::name()) != nullptr);
     EXPECT_TRUE(env->getDiscreteContactManager(tesseract_collision_fcl::FCLDiscreteBVHManager::name()) != nullptr);
+    EXPECT_TRUE(env->getContinuousContactManager(tesseract_collision_fcl::FCLCastBVHManager::name()) != nullptr);
 
     EXPECT_TRUE(env->getDiscreteContactManager() != nullptr);
     EXPECT_TRUE(env->getContinuousContactManager() != nullptr);
@@ -366,6 +444,64 @@ void runContactManagerCloneTest()
   }
 }
 
+template <typename S>
+void runUpdateCollisionObjectGeometriesTest()
+{
+  // Get the environment
+  auto env = getEnvironment<S>();
+
+  // An octree with a voxel away from the box
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  ot->updateNode(-0.95, 0.05, 0.05, true);
+  auto octree = std::make_shared<tesseract_geometry::Octree>(ot, tesseract_geometry::Octree::BOX);
+
+  Link octree_link("octree_link");
+  auto octree_collision = std::make_shared<Collision>();
+  octree_collision->geometry = octree;
+  octree_link.collision.push_back(octree_collision);
+
+  Link box_link("box_link");
+  auto box_collision = std::make_shared<Collision>();
+  box_collision->origin.translation() = Eigen::Vector3d(0.15, 0.15, 0.15);
+  box_collision->geometry = std::make_shared<tesseract_geometry::Box>(0.05, 0.05, 0.05);
+  box_link.collision.push_back(box_collision);
+
+  // Both links are far away from the robot
+  for (const auto& link : { &octree_link, &box_link })
+  {
+    Joint joint("joint_" + link->getName());
+    joint.parent_link_name = "base_link";
+    joint.child_link_name = link->getName();
+    joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(5, 0, 0);
+    joint.type = JointType::FIXED;
+    EXPECT_TRUE(env->addLink(*link, joint));
+  }
+
+  auto hasContact = [&env]() {
+    tesseract_collision::DiscreteContactManager::Ptr manager = env->getDiscreteContactManager();
+    manager->setActiveCollisionObjects({ "octree_link" });
+    tesseract_collision::ContactResultMap result;
+    manager->contactTest(result, tesseract_collision::ContactRequest(tesseract_collision::ContactTestType::FIRST));
+    return !result.empty();
+  };
+
+  EXPECT_FALSE(hasContact());
+  EXPECT_FALSE(env->updateCollisionObjectGeometries("missing_link"));
+
+  // Publish an octomap with a voxel at the box
+  auto new_ot = std::make_shared<octomap::OcTree>(*ot);
+  octomap::OcTreeKey key = new_ot->coordToKey(0.15, 0.15, 0.15);
+  new_ot->updateNode(key, true);
+  octomap::KeySet changed_keys;
+  changed_keys.insert(key);
+  octree->update(new_ot, changed_keys);
+
+  int revision = env->getRevision();
+  EXPECT_TRUE(env->updateCollisionObjectGeometries("octree_link"));
+  EXPECT_EQ(env->getRevision(), revision);
+  EXPECT_TRUE(hasContact());
+}
+
 template <typename S>
 void runFindTCPTest()
 {
@@ -2151,6 +2287,62 @@ void runEnvCloneTest()
   EXPECT_EQ(env->getCollisionMarginData(), clone->getCollisionMarginData());
 }
 
+template <typename S>
+void runEnvCloneCopyOnWriteTest()
+{
+  auto env = getEnvironment<S>();
+  auto clone = env->clone();
+
+  // The scene graph is shared until either environment is modified
+  EXPECT_TRUE(clone->getSceneGraph() == env->getSceneGraph());
+  tesseract_scene_graph::SceneGraph::ConstPtr env_scene_graph = env->getSceneGraph();
+
+  // Modify the clone
+  Link link_1("link_n1");
+  auto collision = std::make_shared<Collision>();
+  collision->geometry = std::make_shared<tesseract_geometry::Box>(1, 1, 1);
+  link_1.collision.push_back(collision);
+  EXPECT_TRUE(clone->applyCommand(std::make_shared<AddLinkCommand>(link_1)));
+  EXPECT_TRUE(clone->getSceneGraph() != env->getSceneGraph());
+  EXPECT_TRUE(env->getSceneGraph() == env_scene_graph);
+
+  EXPECT_TRUE(clone->getLink("link_n1") != nullptr);
+  EXPECT_TRUE(env->getLink("link_n1") == nullptr);
+  EXPECT_EQ(clone->getCommandHistory().size(), env->getCommandHistory().size() + 1);
+  EXPECT_TRUE(clone->getDiscreteContactManager()->hasCollisionObject("link_n1"));
+  EXPECT_FALSE(env->getDiscreteContactManager()->hasCollisionObject("link_n1"));
+  EXPECT_TRUE(clone->getContinuousContactManager()->hasCollisionObject("link_n1"));
+  EXPECT_FALSE(env->getContinuousContactManager()->hasCollisionObject("link_n1"));
+
+  // Modify the original, the scene graph it shared is copied as well
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddAllowedCollisionCommand>("link_1", "link_6", "Test")));
+  EXPECT_TRUE(env->getSceneGraph() != env_scene_graph);
+  EXPECT_TRUE(env->getAllowedCollisionMatrix()->isCollisionAllowed("link_1", "link_6"));
+  EXPECT_FALSE(clone->getAllowedCollisionMatrix()->isCollisionAllowed("link_1", "link_6"));
+  EXPECT_FALSE(env_scene_graph->getAllowedCollisionMatrix()->isCollisionAllowed("link_1", "link_6"));
+  EXPECT_EQ(clone->getCommandHistory().size(), env->getCommandHistory().size());
+  EXPECT_EQ(clone->getCommandHistory().back()->getType(), CommandType::ADD_LINK);
+  EXPECT_EQ(env->getCommandHistory().back()->getType(), CommandType::ADD_ALLOWED_COLLISION);
+
+  // Setting the state of a clone does not change the original
+  auto state_clone = env->clone();
+  std::vector<std::string> joint_names = env->getActiveJointNames();
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.5);
+  state_clone->setState(joint_names, joint_values);
+
+  Eigen::Isometry3d env_tf = env->getLinkTransform("link_7");
+  Eigen::Isometry3d clone_tf = state_clone->getLinkTransform("link_7");
+  EXPECT_FALSE(env_tf.isApprox(clone_tf, 1e-6));
+  EXPECT_TRUE(env->getCurrentJointValues(joint_names).isZero());
+
+  // The kinematics of a modified clone use its own scene graph
+  EXPECT_TRUE(state_clone->applyCommand(std::make_shared<AddLinkCommand>(link_1)));
+  EXPECT_TRUE(state_clone->getCurrentJointValues(joint_names).isApprox(joint_values, 1e-6));
+  EXPECT_TRUE(state_clone->getLinkTransform("link_7").isApprox(clone_tf, 1e-6));
+  EXPECT_TRUE(state_clone->getLinkTransform("link_n1").isApprox(Eigen::Isometry3d::Identity(), 1e-6));
+  EXPECT_TRUE(env->getLink("link_n1") == nullptr);
+}
+
 template <typename S>
 void runEnvSetStateTest()
 {
@@ -2395,12 +2587,96 @@ TEST(TesseractEnvironmentUnit, EnvCloneContactManagerUnit)  // NOLINT
   runContactManagerCloneTest<OFKTStateSolver>();
 }
 
+TEST(TesseractEnvironmentUnit, EnvUpdateCollisionObjectGeometriesUnit)  // NOLINT
+{
+  runUpdateCollisionObjectGeometriesTest<KDLStateSolver>();
+  runUpdateCollisionObjectGeometriesTest<OFKTStateSolver>();
+}
+
 TEST(TesseractEnvironmentUnit, EnvInitFailuresUnit)  // NOLINT
 {
   runEnvInitFailuresTest<KDLStateSolver>();
   runEnvInitFailuresTest<OFKTStateSolver>();
 }
 
+template <typename S>
+void runEnvSnapshotTest()
+{
+  // Get the environment
+  auto env = getEnvironment<S>();
+
+  EnvSnapshot::ConstPtr snapshot = env->getSnapshot();
+  ASSERT_TRUE(snapshot != nullptr);
+  EXPECT_EQ(snapshot->getState(), env->getCurrentState());
+  EXPECT_EQ(snapshot->dense_state, env->getStateSolver()->getDenseCurrentState());
+  EXPECT_EQ(snapshot->timestamp, env->getCurrentStateTimestamp());
+  EXPECT_EQ(snapshot->revision, env->getRevision());
+  EXPECT_EQ(*snapshot->link_names, env->getLinkNames());
+  EXPECT_EQ(*snapshot->active_joint_names, env->getActiveJointNames());
+
+  // Setting the state publishes a new snapshot and does not modify the previous one
+  std::vector<std::string> active_joint_names = env->getActiveJointNames();
+  Eigen::VectorXd jvals = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(active_joint_names.size()), 0.1);
+  EnvState previous_state = *snapshot->getState();
+  env->setState(active_joint_names, jvals);
+  EnvSnapshot::ConstPtr new_snapshot = env->getSnapshot();
+  EXPECT_EQ(new_snapshot->version, snapshot->version + 1);
+  EXPECT_EQ(new_snapshot->link_names, snapshot->link_names);
+  EXPECT_TRUE(new_snapshot->dense_state->getJointValues(active_joint_names).isApprox(jvals, 1e-6));
+  EXPECT_TRUE(new_snapshot->getState()->getJointValues(active_joint_names).isApprox(jvals, 1e-6));
+  EXPECT_TRUE(snapshot->dense_state->getJointValues(active_joint_names)
+                  .isApprox(previous_state.getJointValues(active_joint_names), 1e-6));
+  EXPECT_TRUE(env->getCurrentJointValues().isApprox(jvals, 1e-6));
+
+  // Unknown links return identity
+  EXPECT_TRUE(env->getLinkTransform("missing_link").isApprox(Eigen::Isometry3d::Identity()));
+
+  // Changing the environment publishes the new link names
+  Link link("link_n1");
+  Joint joint("joint_n1");
+  joint.parent_link_name = env->getRootLinkName();
+  joint.child_link_name = "link_n1";
+  joint.type = JointType::FIXED;
+  env->addLink(link, joint);
+  snapshot = env->getSnapshot();
+  EXPECT_EQ(snapshot->revision, env->getRevision());
+  EXPECT_TRUE(std::find(snapshot->link_names->begin(), snapshot->link_names->end(), "link_n1") !=
+              snapshot->link_names->end());
+  EXPECT_TRUE(snapshot->dense_state->getJointValues(active_joint_names).isApprox(jvals, 1e-6));
+
+  // The clone publishes its own snapshot, sharing the immutable dense state
+  Environment::Ptr clone = env->clone();
+  EnvSnapshot::ConstPtr clone_snapshot = clone->getSnapshot();
+  ASSERT_TRUE(clone_snapshot != nullptr);
+  EXPECT_NE(clone_snapshot, snapshot);
+  EXPECT_EQ(clone_snapshot->dense_state, snapshot->dense_state);
+  EXPECT_EQ(clone_snapshot->revision, snapshot->revision);
+  EXPECT_EQ(*clone_snapshot->link_names, *snapshot->link_names);
+  EXPECT_TRUE(clone_snapshot->getState()->getJointValues(active_joint_names).isApprox(jvals, 1e-6));
+
+  // Readers see consistent snapshots while the state is updated
+  std::atomic<bool> done{ false };
+  std::thread reader([&env, &done, &active_joint_names]() {
+    unsigned long version = 0;
+    while (!done)
+    {
+      EnvSnapshot::ConstPtr current = env->getSnapshot();
+      EXPECT_GE(current->version, version);
+      version = current->version;
+
+      // All joints of a snapshot are set by the same call to setState
+      Eigen::VectorXd current_jvals = current->dense_state->getJointValues(active_joint_names);
+      EXPECT_TRUE(current_jvals.isApprox(Eigen::VectorXd::Constant(current_jvals.size(), current_jvals(0)), 1e-8));
+    }
+  });
+
+  for (int i = 0; i < 100; ++i)
+    env->setState(active_joint_names, Eigen::VectorXd::Constant(jvals.size(), 0.001 * i));
+
+  done = true;
+  reader.join();
+}
+
 TEST(TesseractEnvironmentUnit, EnvChangeNameUnit)  // NOLINT
 {
   runEnvironmentChangeNameTest<KDLStateSolver>();
@@ -2548,6 +2824,18 @@ TEST(TesseractEnvironmentUnit, EnvClone)  // NOLINT
   runEnvCloneTest<OFKTStateSolver>();
 }
 
+TEST(TesseractEnvironmentUnit, EnvCloneCopyOnWrite)  // NOLINT
+{
+  runEnvCloneCopyOnWriteTest<KDLStateSolver>();
+  runEnvCloneCopyOnWriteTest<OFKTStateSolver>();
+}
+
+TEST(TesseractEnvironmentUnit, EnvSnapshot)  // NOLINT
+{
+  runEnvSnapshotTest<KDLStateSolver>();
+  runEnvSnapshotTest<OFKTStateSolver>();
+}
+
 TEST(TesseractEnvironmentUnit, EnvSetState)  // NOLINT
 {
   runEnvSetStateTest<KDLStateSolver>();
@@ -2557,6 +2845,55 @@ TEST(TesseractEnvironmentUnit, EnvSetState)  // NOLINT
   runEnvSetStateTest2<OFKTStateSolver>();
 }
 
+TEST(TesseractEnvironmentUnit, OFKTLinkSubsetUnit)  // NOLINT
+{
+  auto state_solver = std::make_shared<OFKTStateSolver>();
+  EXPECT_TRUE(state_solver->init(getSceneGraph()));
+
+  std::vector<std::string> link_names = { "tool0", "link_4", "base_link" };
+  OFKTStateSolver::LinkSubset::ConstPtr subset = state_solver->getLinkSubset(link_names);
+  EXPECT_TRUE(subset == state_solver->getLinkSubset(link_names));
+  EXPECT_EQ(subset->link_names, link_names);
+  EXPECT_EQ(subset->size, 9u);
+
+  // Only the ancestors of link_4 are computed
+  OFKTStateSolver::LinkSubset::ConstPtr partial_subset = state_solver->getLinkSubset({ "link_4" });
+  EXPECT_EQ(partial_subset->size, 4u);
+  EXPECT_EQ(partial_subset->steps.size(), 4u);
+
+  tesseract_common::VectorIsometry3d link_transforms;
+  tesseract_common::VectorIsometry3d partial_link_transforms;
+  const std::vector<std::string>& joint_names = state_solver->getJointNames();
+  for (int i = 0; i < 20; ++i)
+  {
+    EnvState::Ptr random_state = state_solver->getRandomState();
+    Eigen::VectorXd joint_values = random_state->getJointValues(joint_names);
+    state_solver->getLinkTransforms(link_transforms, *subset, joint_values);
+    state_solver->getLinkTransforms(partial_link_transforms, *partial_subset, joint_values);
+
+    ASSERT_EQ(link_transforms.size(), subset->size);
+    for (std::size_t j = 0; j < link_names.size(); ++j)
+      EXPECT_TRUE(random_state->link_transforms.at(link_names[j]).isApprox(link_transforms[j], 1e-6));
+
+    EXPECT_TRUE(random_state->link_transforms.at("link_4").isApprox(partial_link_transforms[0], 1e-6));
+  }
+
+  // The clone shares the compiled subsets
+  auto cloned_state_solver = std::static_pointer_cast<OFKTStateSolver>(state_solver->clone());
+  EXPECT_TRUE(subset == cloned_state_solver->getLinkSubset(link_names));
+
+  // Unknown and duplicate links
+  EXPECT_ANY_THROW(state_solver->getLinkSubset({ "missing_link" }));  // NOLINT
+  EXPECT_ANY_THROW(state_solver->getLinkSubset({ "tool0", "tool0" }));  // NOLINT
+
+  // The subset is no longer valid once the environment changes
+  EXPECT_TRUE(state_solver->init(getSceneGraph()));
+  Eigen::VectorXd joint_values = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+  EXPECT_ANY_THROW(state_solver->getLinkTransforms(link_transforms, *subset, joint_values));  // NOLINT
+  EXPECT_NO_THROW(  // NOLINT
+      state_solver->getLinkTransforms(link_transforms, *state_solver->getLinkSubset(link_names), joint_values));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -29,7 +29,10 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <octomap/octomap.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -41,6 +44,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_geometry
 {
+/** @brief The number of octree updates for which the keys of the changed voxels are kept */
+static const std::size_t OCTREE_MAX_CHANGE_LOG_SIZE = 16;
+
 #ifdef SWIG
 %nodefaultctor Octree;
 #endif  // SWIG
@@ -86,17 +92,90 @@ public:
   Octree& operator=(Octree&&) = delete;
 
 #ifndef SWIG
-  const std::shared_ptr<const octomap::OcTree>& getOctree() const { return octree_; }
+  /**
+   * @brief Get the current octomap
+   *
+   * The octomap is never modified once it is given to the octree, an update publishes a new octomap instead. The
+   * returned pointer keeps the octomap valid while the octree is updated by another thread.
+   */
+  std::shared_ptr<const octomap::OcTree> getOctree() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return octree_;
+  }
 #endif  // SWIG
   SubType getSubType() const { return sub_type_; }
 
-  Geometry::Ptr clone() const override { return std::make_shared<Octree>(octree_, sub_type_); }
+  Geometry::Ptr clone() const override { return std::make_shared<Octree>(getOctree(), sub_type_); }
 
+#ifndef SWIG
   /**
    * @brief Octrees are typically generated from 3D sensor data so this method
    * should be used to efficiently update the collision shape.
+   *
+   * The octomap is shared with the contact managers and the clones of the environment, so it must not be changed in
+   * place. Copy the current octomap, change the occupancy of some of its voxels and publish the copy here with the keys
+   * of the changed voxels at the maximum depth of the octomap. The contact managers then only process the changed
+   * voxels when their collision objects using this octree are updated.
+   *
+   * @param octree The new octomap, which must have the same resolution and depth as the previous one
+   * @param changed_keys The keys of the voxels whose occupancy differs from the previous octomap, including voxels
+   * merged or split by pruning
    */
-  void update() { assert(false); }
+  void update(std::shared_ptr<const octomap::OcTree> octree, const octomap::KeySet& changed_keys)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    octree_ = std::move(octree);
+    ++revision_;
+    change_log_.emplace_back(revision_, changed_keys);
+    if (change_log_.size() > OCTREE_MAX_CHANGE_LOG_SIZE)
+      change_log_.pop_front();
+  }
+
+  /**
+   * @brief Get the current octomap and the keys of the voxels changed since an earlier revision
+   *
+   * Only the keys of the last OCTREE_MAX_CHANGE_LOG_SIZE updates are kept, so the changes since an older revision are
+   * not available and the whole octomap must be processed instead.
+   *
+   * @param since_revision The revision to get the changes since
+   * @param changed_keys The keys of the voxels changed by the updates after since_revision
+   * @param octree The current octomap
+   * @param revision The current revision
+   * @return False if the changes since the revision are not available, then changed_keys is empty
+   */
+  bool getChangedKeys(std::size_t since_revision,
+                      octomap::KeySet& changed_keys,
+                      std::shared_ptr<const octomap::OcTree>& octree,
+                      std::size_t& revision) const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    octree = octree_;
+    revision = revision_;
+    changed_keys.clear();
+    if (since_revision > revision_)
+      return false;
+
+    if (since_revision == revision_)
+      return true;
+
+    if (change_log_.empty() || change_log_.front().first > since_revision + 1)
+      return false;
+
+    for (const auto& change : change_log_)
+      if (change.first > since_revision)
+        changed_keys.insert(change.second.begin(), change.second.end());
+
+    return true;
+  }
+#endif  // SWIG
+
+  /** @brief Get the number of times the octree was updated, used by the contact managers to detect changes */
+  std::size_t getRevision() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return revision_;
+  }
 
   /**
    * @brief Calculate the number of sub shapes that would get generated for this octree
@@ -107,9 +186,10 @@ public:
    */
   long calcNumSubShapes() const
   {
+    std::shared_ptr<const octomap::OcTree> octree = getOctree();
     long cnt = 0;
-    double occupancy_threshold = octree_->getOccupancyThres();
-    for (auto it = octree_->begin(static_cast<unsigned char>(octree_->getTreeDepth())), end = octree_->end(); it != end;
+    double occupancy_threshold = octree->getOccupancyThres();
+    for (auto it = octree->begin(static_cast<unsigned char>(octree->getTreeDepth())), end = octree->end(); it != end;
          ++it)
       if (it->getOccupancy() >= occupancy_threshold)
         ++cnt;
@@ -120,6 +200,9 @@ public:
 private:
   std::shared_ptr<const octomap::OcTree> octree_;
   SubType sub_type_;
+  std::size_t revision_{ 0 };
+  std::deque<std::pair<std::size_t, octomap::KeySet>> change_log_; /**< @brief The keys changed by each revision */
+  mutable std::mutex mutex_; /**< @brief Guards the octomap, revision and change log against concurrent updates */
 
   static bool isNodeCollapsible(octomap::OcTree& octree, octomap::OcTreeNode* node)
   {
@@ -144,8 +144,8 @@ inline bool isIdentical(const Geometry& geom1, const Geometry& geom2)
       const Octree& s1 = static_cast<const Octree&>(geom1);
       const Octree& s2 = static_cast<const Octree&>(geom2);
 
-      const std::shared_ptr<const octomap::OcTree>& octree1 = s1.getOctree();
-      const std::shared_ptr<const octomap::OcTree>& octree2 = s2.getOctree();
+      std::shared_ptr<const octomap::OcTree> octree1 = s1.getOctree();
+      std::shared_ptr<const octomap::OcTree> octree2 = s2.getOctree();
 
       if (octree1->getTreeType() != octree2->getTreeType())
         return false;
@@ -244,6 +244,50 @@ TEST(TesseractGeometryUnit, Octree)  // NOLINT
   auto geom_clone = geom->clone();
   EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getOctree() != nullptr);
   EXPECT_TRUE(std::static_pointer_cast<T>(geom_clone)->getSubType() == tesseract_geometry::Octree::SubType::BOX);
+
+  // Updates publish a new octomap and record the changed voxels
+  EXPECT_EQ(geom->getRevision(), 0u);
+  std::shared_ptr<const octomap::OcTree> previous = geom->getOctree();
+  auto octree = std::make_shared<octomap::OcTree>(*previous);
+  octomap::OcTreeKey key = octree->coordToKey(0, 0, 0);
+  octree->updateNode(key, true);
+  octomap::KeySet changed_keys;
+  changed_keys.insert(key);
+  geom->update(octree, changed_keys);
+  EXPECT_EQ(geom->getRevision(), 1u);
+  EXPECT_TRUE(geom->getOctree() == octree);
+  EXPECT_TRUE(previous != octree);
+
+  octomap::KeySet keys;
+  std::shared_ptr<const octomap::OcTree> current;
+  std::size_t revision = 0;
+  EXPECT_TRUE(geom->getChangedKeys(0, keys, current, revision));
+  EXPECT_EQ(keys.size(), 1u);
+  EXPECT_TRUE(current == octree);
+  EXPECT_EQ(revision, 1u);
+
+  EXPECT_TRUE(geom->getChangedKeys(1, keys, current, revision));
+  EXPECT_TRUE(keys.empty());
+
+  // The changes of the updates are merged
+  changed_keys.clear();
+  changed_keys.insert(octree->coordToKey(1, 0, 0));
+  geom->update(octree, changed_keys);
+  EXPECT_TRUE(geom->getChangedKeys(0, keys, current, revision));
+  EXPECT_EQ(keys.size(), 2u);
+  EXPECT_EQ(revision, 2u);
+  EXPECT_TRUE(geom->getChangedKeys(1, keys, current, revision));
+  EXPECT_EQ(keys.size(), 1u);
+
+  // Only the changes of the last updates are kept
+  for (std::size_t i = 0; i < tesseract_geometry::OCTREE_MAX_CHANGE_LOG_SIZE; ++i)
+    geom->update(octree, octomap::KeySet());
+
+  EXPECT_EQ(geom->getRevision(), tesseract_geometry::OCTREE_MAX_CHANGE_LOG_SIZE + 2);
+  EXPECT_FALSE(geom->getChangedKeys(1, keys, current, revision));
+  EXPECT_TRUE(keys.empty());
+  EXPECT_TRUE(geom->getChangedKeys(2, keys, current, revision));
+  EXPECT_TRUE(keys.empty());
 }
 
 TEST(TesseractGeometryUnit, LoadMeshUnit)  // NOLINT